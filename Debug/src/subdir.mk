@@ -5,18 +5,78 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 CPP_SRCS += \
 ../src/FamilyMemberClass.cpp \
+../src/FamilyRelationshipClass.cpp \
+../src/FamilyTreeArena.cpp \
+../src/FamilyTreeAttributeCollection.cpp \
+../src/FamilyTreeAttributeColumns.cpp \
 ../src/FamilyTreeClass.cpp \
-../src/FamilyTreeMain.cpp 
+../src/FamilyTreeConnectedFamilies.cpp \
+../src/FamilyTreeCountIndex.cpp \
+../src/FamilyTreeFamilyUnits.cpp \
+../src/FamilyTreeGedcomReader.cpp \
+../src/FamilyTreeGraphWriter.cpp \
+../src/FamilyTreeKinship.cpp \
+../src/FamilyTreeMain.cpp \
+../src/FamilyTreeMaterializedView.cpp \
+../src/FamilyTreeMemberBitmap.cpp \
+../src/FamilyTreeMemberSet.cpp \
+../src/FamilyTreeNameDictionary.cpp \
+../src/FamilyTreeNameFilter.cpp \
+../src/FamilyTreeParallel.cpp \
+../src/FamilyTreePathExpression.cpp \
+../src/FamilyTreeResultCache.cpp \
+../src/FamilyTreeScanKernels.cpp \
+../src/FamilyTreeTrigramIndex.cpp 
 
 OBJS += \
 ./src/FamilyMemberClass.o \
+./src/FamilyRelationshipClass.o \
+./src/FamilyTreeArena.o \
+./src/FamilyTreeAttributeCollection.o \
+./src/FamilyTreeAttributeColumns.o \
 ./src/FamilyTreeClass.o \
-./src/FamilyTreeMain.o 
+./src/FamilyTreeConnectedFamilies.o \
+./src/FamilyTreeCountIndex.o \
+./src/FamilyTreeFamilyUnits.o \
+./src/FamilyTreeGedcomReader.o \
+./src/FamilyTreeGraphWriter.o \
+./src/FamilyTreeKinship.o \
+./src/FamilyTreeMain.o \
+./src/FamilyTreeMaterializedView.o \
+./src/FamilyTreeMemberBitmap.o \
+./src/FamilyTreeMemberSet.o \
+./src/FamilyTreeNameDictionary.o \
+./src/FamilyTreeNameFilter.o \
+./src/FamilyTreeParallel.o \
+./src/FamilyTreePathExpression.o \
+./src/FamilyTreeResultCache.o \
+./src/FamilyTreeScanKernels.o \
+./src/FamilyTreeTrigramIndex.o 
 
 CPP_DEPS += \
 ./src/FamilyMemberClass.d \
+./src/FamilyRelationshipClass.d \
+./src/FamilyTreeArena.d \
+./src/FamilyTreeAttributeCollection.d \
+./src/FamilyTreeAttributeColumns.d \
 ./src/FamilyTreeClass.d \
-./src/FamilyTreeMain.d 
+./src/FamilyTreeConnectedFamilies.d \
+./src/FamilyTreeCountIndex.d \
+./src/FamilyTreeFamilyUnits.d \
+./src/FamilyTreeGedcomReader.d \
+./src/FamilyTreeGraphWriter.d \
+./src/FamilyTreeKinship.d \
+./src/FamilyTreeMain.d \
+./src/FamilyTreeMaterializedView.d \
+./src/FamilyTreeMemberBitmap.d \
+./src/FamilyTreeMemberSet.d \
+./src/FamilyTreeNameDictionary.d \
+./src/FamilyTreeNameFilter.d \
+./src/FamilyTreeParallel.d \
+./src/FamilyTreePathExpression.d \
+./src/FamilyTreeResultCache.d \
+./src/FamilyTreeScanKernels.d \
+./src/FamilyTreeTrigramIndex.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -0,0 +1,351 @@
+/**
+ *  @file    FamilyTreeBenchmark.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Ingest benchmark for the FamilyTreeClass
+ *
+ *  @section DESCRIPTION
+ *
+ *  Generates a synthetic input file and compares the time and
+ *  peak RSS needed to load it with:
+ *
+ *  - opengt:  the original OpenGT Graph storage where every member
+ *             and relationship is a separately heap-allocated
+ *             Vertex/Edge with its own attribute collection
+ *  - arena:   FamilyTreeClass::initialize, which allocates members,
+ *             relationships and attributes from the tree's arena
+ *
+ *  Each case runs in its own child process so that the peak RSS
+ *  of one case does not hide the other.
+ *
+ *  It then compares the throughput (members/second) of a child
+ *  count range scan ("between 1 and 4 children") done:
+ *
+ *  - per vertex: the original OpenGT path that collects and filters
+ *                the outgoing edges of every vertex
+ *  - with each FamilyTreeScanKernels kernel that the CPU supports
+ *                over a dense child count column
+ *
+ *  The OpenGT load time grows much faster than linearly with the
+ *  number of members, so keep the member count moderate.
+ *
+ *  Usage: FamilyTreeBenchmark [number of members] [input file path]
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "libs/boost/algorithm/string.hpp"	// local boost libs
+#include "libs/opengt/opengt.h"
+
+#include "FamilyTreeClass.h"
+#include "FamilyTreeOpResultCode.h"
+#include "FamilyTreeScanKernels.h"
+
+using namespace std;
+using namespace FamilyTree;
+
+// Number of children of each parent in the generated tree
+static const uint32_t CHILDREN_PER_PARENT = 4;
+
+static string memberName(uint32_t index) {
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "M%u", index);
+	return string(buffer);
+}
+
+// Writes a complete CHILDREN_PER_PARENT-ary tree with the given
+// number of members: one MEMBERS line followed by a PARENT and a
+// SIBLINGS line for every parent.
+static bool generateInputFile(string const & fileName, uint32_t numberOfMembers) {
+	ofstream outfile(fileName.c_str());
+	if(outfile.is_open() == false) {
+		return false;
+	}
+
+	outfile << "MEMBERS";
+	for(uint32_t i = 0; i < numberOfMembers; i++) {
+		outfile << ":" << memberName(i);
+	}
+	outfile << "\n";
+
+	for(uint32_t parent = 0; parent * CHILDREN_PER_PARENT + 1 < numberOfMembers; parent++) {
+		string children;
+		for(uint32_t child = parent * CHILDREN_PER_PARENT + 1;
+			child <= parent * CHILDREN_PER_PARENT + CHILDREN_PER_PARENT && child < numberOfMembers; child++) {
+			children += ":" + memberName(child);
+		}
+		outfile << "PARENT:" << memberName(parent) << ":CHILDREN" << children << "\n";
+		outfile << "SIBLINGS" << children << "\n";
+	}
+
+	return true;
+}
+
+// Adds a relationship the way the original FamilyTreeClass did
+static void addOpenGTRelationship(OpenGraphtheory::Graph & graph, OpenGraphtheory::Vertex * from,
+	OpenGraphtheory::Vertex * to, FamilyTreeClass::relationship_t relationship) {
+	OpenGraphtheory::Edge * newEdge = *graph.AddArc(from, to);
+	IntAttribute * relationshipAttribute =
+		(IntAttribute *)newEdge->AddAttribute("Relationship", "int");
+	relationshipAttribute->Value = relationship;
+}
+
+// Loads the input file into an OpenGT Graph the way the original
+// FamilyTreeClass::constructTreeFromFile did.  Members are looked
+// up through a map so that only the storage is compared.
+static bool buildOpenGTGraph(string const & fileName, OpenGraphtheory::Graph & graph) {
+	map<string, OpenGraphtheory::Vertex *> members;
+
+	ifstream infile(fileName.c_str());
+	string currentLine;
+	while(getline(infile, currentLine)) {
+		vector<string> tokens;
+		boost::split(tokens, currentLine, boost::is_any_of(":"));
+
+		if(tokens[0] == "MEMBERS") {
+			for(unsigned int i = 1; i < tokens.size(); i++) {
+				OpenGraphtheory::Vertex * vertex = *graph.AddVertex();
+				vertex->SetLabel(tokens[i], "Member_Name");
+				StringAttribute * nameAttribute =
+					(StringAttribute *)vertex->AddAttribute("Member_FirstName", "string");
+				nameAttribute->Value = tokens[i];
+				members[tokens[i]] = vertex;
+			}
+		}
+		else if(tokens[0] == "PARENT") {
+			OpenGraphtheory::Vertex * parent = members[tokens[1]];
+			for(unsigned int i = 3; i < tokens.size(); i++) {
+				OpenGraphtheory::Vertex * child = members[tokens[i]];
+				addOpenGTRelationship(graph, parent, child, FamilyTreeClass::Parent_Child);
+				addOpenGTRelationship(graph, child, parent, FamilyTreeClass::Child_Parent);
+			}
+		}
+		else if(tokens[0] == "SIBLINGS") {
+			for(unsigned int i = 1; i < tokens.size(); i++) {
+				for(unsigned int j = 1; j < tokens.size(); j++) {
+					if(i != j) {
+						addOpenGTRelationship(graph, members[tokens[i]], members[tokens[j]], FamilyTreeClass::Sibling);
+					}
+				}
+			}
+		}
+	}
+
+	return graph.NumberOfVertices() > 0;
+}
+
+static bool loadOpenGT(string const & fileName) {
+	OpenGraphtheory::Graph graph;
+	return buildOpenGTGraph(fileName, graph);
+}
+
+static bool loadArena(string const & fileName) {
+	FamilyTreeClass familyTree;
+	return familyTree.initialize(fileName) == SUCCESS;
+}
+
+// Runs the load function in a child process and prints its
+// elapsed time and peak RSS
+static void runCase(const char * caseName, bool (*loadFunction)(string const &), string const & fileName) {
+	struct timeval start, end;
+	gettimeofday(&start, NULL);
+
+	pid_t pid = fork();
+	if(pid == 0) {
+		_exit(loadFunction(fileName) ? 0 : 1);
+	}
+
+	int status = 0;
+	struct rusage usage;
+	if(pid < 0 || wait4(pid, &status, 0, &usage) != pid) {
+		printf("%-8s failed to run\n", caseName);
+		return;
+	}
+	gettimeofday(&end, NULL);
+
+	double elapsedMs = (end.tv_sec - start.tv_sec) * 1000.0 + (end.tv_usec - start.tv_usec) / 1000.0;
+	printf("%-8s %s  time %10.1f ms  peak RSS %10ld KB\n", caseName,
+		(WIFEXITED(status) && WEXITSTATUS(status) == 0) ? "ok    " : "FAILED",
+		elapsedMs, usage.ru_maxrss);
+}
+
+// Child count range used by the scan benchmark
+static const uint32_t SCAN_MIN_CHILDREN = 1;
+static const uint32_t SCAN_MAX_CHILDREN = 4;
+
+// Minimum number of member visits per scan measurement
+static const uint64_t SCAN_MIN_VISITS = 200000000ULL;
+
+static double elapsedSeconds(struct timeval const & start) {
+	struct timeval end;
+	gettimeofday(&end, NULL);
+	return (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1000000.0;
+}
+
+// Counts the children of every vertex the way the original
+// FamilyTreeClass did (CollectIncidentEdges and the Relationship
+// attribute of every edge) and stores the members in range
+static uint32_t scanOpenGT(OpenGraphtheory::Graph & graph, vector<uint32_t> & childCounts, uint32_t * pPositions) {
+	uint32_t numberOfMatches = 0;
+	uint32_t position = 0;
+	for(OpenGraphtheory::VertexIterator it = graph.BeginVertices(); it != graph.EndVertices(); it++, position++) {
+		OpenGraphtheory::EdgeSet edges = (*it)->CollectIncidentEdges(false, true, false);
+		uint32_t numberOfChildren = 0;
+		for(unsigned int i = 0; i < edges.size(); i++) {
+			IntAttribute * pRelationshipAttr = (IntAttribute *)edges[i]->GetAttribute("Relationship");
+			if(pRelationshipAttr->Value == FamilyTreeClass::Parent_Child) {
+				numberOfChildren++;
+			}
+		}
+
+		childCounts[position] = numberOfChildren;
+		if(numberOfChildren >= SCAN_MIN_CHILDREN && numberOfChildren <= SCAN_MAX_CHILDREN) {
+			pPositions[numberOfMatches++] = position;
+		}
+	}
+
+	return numberOfMatches;
+}
+
+static void runScanBenchmark(string const & fileName, uint32_t numberOfMembers) {
+	OpenGraphtheory::Graph graph;
+	if(buildOpenGTGraph(fileName, graph) == false) {
+		printf("Could not load the input file: %s\n", fileName.c_str());
+		return;
+	}
+
+	vector<uint32_t> childCounts(numberOfMembers);
+	vector<uint32_t> positions(numberOfMembers + FamilyTreeScanKernels::OUTPUT_PADDING);
+
+	printf("Child count range scan [%u, %u] of %u members\n", SCAN_MIN_CHILDREN, SCAN_MAX_CHILDREN, numberOfMembers);
+
+	// The per vertex path is slow, so a single pass is measured.
+	// It also fills the child count column for the kernels.
+	struct timeval start;
+	gettimeofday(&start, NULL);
+	uint32_t expectedMatches = scanOpenGT(graph, childCounts, &positions[0]);
+	double seconds = elapsedSeconds(start);
+	printf("%-10s matches %8u  %14.0f members/s\n", "per-vertex", expectedMatches, numberOfMembers / seconds);
+
+	FamilyTreeScanKernels::kernel_t kernels[] = {
+		FamilyTreeScanKernels::Kernel_Scalar,
+		FamilyTreeScanKernels::Kernel_SSE41,
+		FamilyTreeScanKernels::Kernel_AVX2
+	};
+
+	uint32_t repetitions = (uint32_t)(SCAN_MIN_VISITS / numberOfMembers) + 1;
+	for(unsigned int k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+		if(FamilyTreeScanKernels::setKernel(kernels[k]) == false) {
+			printf("%-10s not supported by this CPU\n", FamilyTreeScanKernels::getKernelName(kernels[k]));
+			continue;
+		}
+
+		uint32_t numberOfMatches = 0;
+		gettimeofday(&start, NULL);
+		for(uint32_t r = 0; r < repetitions; r++) {
+			numberOfMatches = FamilyTreeScanKernels::scanRange(&childCounts[0], numberOfMembers,
+				SCAN_MIN_CHILDREN, SCAN_MAX_CHILDREN, &positions[0]);
+		}
+		seconds = elapsedSeconds(start);
+
+		printf("%-10s matches %8u  %14.0f members/s%s\n", FamilyTreeScanKernels::getKernelName(kernels[k]),
+			numberOfMatches, ((double)numberOfMembers * repetitions) / seconds,
+			(numberOfMatches == expectedMatches) ? "" : "  MISMATCH");
+	}
+
+	FamilyTreeScanKernels::setKernel(FamilyTreeScanKernels::Kernel_Auto);
+}
+
+// Skewed query workload: most queries go to a small set of hot members
+static const uint32_t CACHE_HOT_MEMBERS = 1000;
+static const uint32_t CACHE_HOT_PERCENT = 90;
+static const uint32_t CACHE_QUERIES = 2000000;
+static const uint32_t CACHE_RUNS = 5;
+
+static void runCacheBenchmark(string const & fileName, uint32_t numberOfMembers) {
+	FamilyTreeClass familyTree;
+	if(familyTree.initialize(fileName) != SUCCESS) {
+		printf("Could not load the input file: %s\n", fileName.c_str());
+		return;
+	}
+
+	// Pick the queried member of each query up front
+	vector<string> queries;
+	queries.reserve(CACHE_QUERIES);
+	uint32_t seed = 12345;
+	uint32_t hotMembers = (CACHE_HOT_MEMBERS < numberOfMembers) ? CACHE_HOT_MEMBERS : numberOfMembers;
+	for(uint32_t i = 0; i < CACHE_QUERIES; i++) {
+		seed = seed * 1103515245 + 12345;
+		uint32_t index = ((seed >> 16) % 100 < CACHE_HOT_PERCENT) ? (seed % hotMembers) : (seed % numberOfMembers);
+		queries.push_back(memberName(numberOfMembers - 1 - index));
+	}
+
+	printf("Grandparent queries (%u%% to %u hot members)\n", CACHE_HOT_PERCENT, hotMembers);
+
+	// Each capacity is measured with the name lists copied into a
+	// vector and with the name lists shared with the cache.  The
+	// fastest of CACHE_RUNS runs (each from an empty cache) is reported.
+	uint32_t capacities[] = { 0, 4096, 65536 };
+	for(unsigned int c = 0; c < sizeof(capacities) / sizeof(capacities[0]); c++) {
+		for(unsigned int shared = 0; shared < 2; shared++) {
+			double bestSeconds = 0;
+			FamilyTreeClass::result_cache_stats_t stats;
+			for(uint32_t run = 0; run < CACHE_RUNS; run++) {
+				familyTree.enableResultCache(capacities[c], 16);
+
+				vector<string> nameList;
+				FamilyTreeClass::name_list_row_t sharedNameList;
+				struct timeval start;
+				gettimeofday(&start, NULL);
+				for(uint32_t i = 0; i < CACHE_QUERIES; i++) {
+					if(shared) {
+						familyTree.getGrandparentNameList(queries[i], sharedNameList);
+					}
+					else {
+						familyTree.getGrandparentNameList(queries[i], nameList);
+					}
+				}
+				double seconds = elapsedSeconds(start);
+				if(run == 0 || seconds < bestSeconds) {
+					bestSeconds = seconds;
+				}
+
+				familyTree.getResultCacheStats(stats);
+			}
+
+			printf("cache %-5u %-6s %14.0f queries/s  hits %llu  misses %llu\n", capacities[c], shared ? "shared" : "copy",
+				CACHE_QUERIES / bestSeconds, (unsigned long long)stats.hits, (unsigned long long)stats.misses);
+		}
+	}
+}
+
+int main(int argc, char ** argv) {
+	uint32_t numberOfMembers = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+	string fileName = (argc > 2) ? argv[2] : "/tmp/family_tree_benchmark_input.txt";
+
+	if(generateInputFile(fileName, numberOfMembers) == false) {
+		printf("Could not write the input file: %s\n", fileName.c_str());
+		return EXIT_FAILURE;
+	}
+
+	printf("Ingest of %u members (%s)\n", numberOfMembers, fileName.c_str());
+	runCase("opengt", loadOpenGT, fileName);
+	runCase("arena", loadArena, fileName);
+
+	runScanBenchmark(fileName, numberOfMembers);
+	runCacheBenchmark(fileName, numberOfMembers);
+
+	return EXIT_SUCCESS;
+}
@@ -10,17 +10,27 @@
  *  This file details the definition of the
  *  FamilyMemberClass class.
  *
- *  FamilyMemberClass inherits from the Vertex class
- *  in the OpenGraphTheory library.
+ *  A FamilyMemberClass object holds the member ID and name
+ *  of a family member along with the lists of relationships
+ *  directed from and to the member.
  *
  *  The class is very basic for now but can easily
  *  be expanded to accomodate the gender and age of
  *  family members as well as other attributes that
  *  can be defined.
  *
- *  Since this class inherits from the Vertex class
- *  many attributes can be stored as Attributes
- *  associated with the Vertex.
+ *  Other attributes can be stored in the attribute
+ *  collection of the member.
+ *
+ *  The children, parents and siblings of the member are also
+ *  kept in separate arrays (the adjacency cache) so that
+ *  traversals can read them as FamilyMemberSpan views without
+ *  walking and filtering the relationship list.  The arrays are
+ *  kept up to date by the FamilyTreeClass whenever a relationship
+ *  is added or removed.
+ *
+ *  Family members are allocated in the FamilyTreeArena of
+ *  the tree and are never destroyed one by one.
  *
  */
 
@@ -30,48 +40,131 @@
 #include <stdint.h>
 #include <string>
 
-#include "libs/opengt/opengt.h"
+#include "FamilyMemberSpan.h"
+#include "FamilyRelationshipClass.h"
+#include "FamilyTreeArena.h"
+#include "FamilyTreeAttributeCollection.h"
 
 #include "gtest/gtest_prod.h" // For testing
 
 namespace FamilyTree {
 
-using namespace OpenGraphtheory;
-    
-class FamilyMemberClass : public Vertex {
+class FamilyMemberClass {
+	friend class FamilyTreeClass;
+
     // Constants and enums
     public:
         //! @brief Default value for age
         uint8_t INVALID_AGE = UINT8_MAX;
-        
+
         //! @brief Gender value
         typedef enum {
             Male,
             Female,
-            Other
+            Other,
+            Unknown
         } gender_t;
-    
+
     // Member variables
     private:
+        // Growable array of neighbor pointers (stored in the arena)
+        typedef struct {
+            FamilyMemberClass ** pMembers;
+            uint32_t size;
+            uint32_t capacity;
+        } neighbor_list_t;
+
+        //! @brief Capacity of a neighbor list when its first neighbor is added
+        static const uint32_t INITIAL_NEIGHBOR_CAPACITY = 4;
+
+        // Member ID of the family member
+        uint32_t m_Id;
+
+        // Name of the family member (stored in the arena)
+        const char * m_pName;
+        uint32_t m_NameLength;
+
+        // Lists of relationships directed from and to this member
+        FamilyRelationshipClass * m_pOutgoing;
+        FamilyRelationshipClass * m_pIncoming;
+
+        // Adjacency cache: the members at the other end of the
+        // Parent_Child, Child_Parent and Sibling relationships
+        // directed from this member
+        neighbor_list_t m_Children;
+        neighbor_list_t m_Parents;
+        neighbor_list_t m_Siblings;
+
+        // Other attributes of the family member
+        FamilyTreeAttributeCollection m_Attributes;
 
     // Constructors/Destructors
     public:
         //! @brief Default constructor
         FamilyMemberClass();
 
-        //! @brief Destructor
-        ~FamilyMemberClass();
-
     // Class methods
+    private:
+        //! @brief Link a relationship into the outgoing relationship list
+        void addOutgoingRelationship(FamilyRelationshipClass * pRelationship);
+
+        //! @brief Unlink a relationship from the outgoing relationship list
+        void removeOutgoingRelationship(FamilyRelationshipClass * pRelationship);
+
+        //! @brief Link a relationship into the incoming relationship list
+        void addIncomingRelationship(FamilyRelationshipClass * pRelationship);
+
+        //! @brief Unlink a relationship from the incoming relationship list
+        void removeIncomingRelationship(FamilyRelationshipClass * pRelationship);
+
+        //! @brief Retrieves the neighbor list for a kind of relationship
+        //! @return Neighbor list or NULL if the relationship is not cached
+        neighbor_list_t * getNeighborList(int32_t relationship);
+
+        //! @brief Add a member to the neighbor list of a kind of relationship
+        //! @param[in] relationship Relationship directed from this member
+        //! @param[in] pMember Member the relationship is directed to
+        //! @param[in] arena Arena used to grow the neighbor list
+        //! @return false if the neighbor list could not be grown
+        bool addNeighbor(int32_t relationship, FamilyMemberClass * pMember, FamilyTreeArena & arena);
+
+        //! @brief Remove a member from the neighbor list of a kind of relationship
+        //!		  The order of the remaining neighbors is kept.
+        void removeNeighbor(int32_t relationship, FamilyMemberClass * pMember);
+
     public:
+        //! @brief Retrieves the member ID of this family member
+        uint32_t getId() const { return m_Id; }
+
+        //! @brief Retrieves the name of this family member
+        std::string getName() const { return std::string(m_pName, m_NameLength); }
+
+        //! @brief Retrieves the first relationship directed from this family member
+        FamilyRelationshipClass * getFirstOutgoingRelationship() const { return m_pOutgoing; }
+
+        //! @brief Retrieves the first relationship directed to this family member
+        FamilyRelationshipClass * getFirstIncomingRelationship() const { return m_pIncoming; }
+
+        //! @brief Retrieves the attributes of this family member
+        FamilyTreeAttributeCollection & getAttributes() { return m_Attributes; }
+
+        //! @brief Retrieves the children of this family member
+        FamilyMemberSpan getChildren() const { return FamilyMemberSpan(m_Children.pMembers, m_Children.size); }
+
+        //! @brief Retrieves the parents of this family member
+        FamilyMemberSpan getParents() const { return FamilyMemberSpan(m_Parents.pMembers, m_Parents.size); }
+
+        //! @brief Retrieves the siblings of this family member
+        FamilyMemberSpan getSiblings() const { return FamilyMemberSpan(m_Siblings.pMembers, m_Siblings.size); }
+
         //! @brief Retrieves the number of siblings for this family member
 		//! @return Number of siblings
-        uint32_t getNumberOfSiblings();
+        uint32_t getNumberOfSiblings() const { return m_Siblings.size; }
 
         //! @brief Retrieves the number of children for this family member
 		//! @return Number of children
-        uint32_t getNumberOfChildren();
-        
+        uint32_t getNumberOfChildren() const { return m_Children.size; }
+
 };
 
 } /* namespace FamilyTree */
@@ -0,0 +1,68 @@
+/**
+ *  @file    FamilyMemberSpan.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyMemberSpan object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyMemberSpan class.
+ *
+ *  A FamilyMemberSpan is a non-owning view of a contiguous
+ *  array of family member pointers, such as the children,
+ *  parents or siblings of a family member.  It is only valid
+ *  until the relationships of that family member change.
+ *
+ */
+
+#ifndef FAMILYMEMBERSPAN_H_
+#define FAMILYMEMBERSPAN_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace FamilyTree {
+
+class FamilyMemberClass;
+
+class FamilyMemberSpan {
+	// Types
+	public:
+		typedef FamilyMemberClass * const * const_iterator;
+
+	// Member variables
+	private:
+		FamilyMemberClass * const * m_pMembers;
+		uint32_t m_Size;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty span.
+		FamilyMemberSpan() : m_pMembers(NULL), m_Size(0) {}
+
+		//! @brief Creates a span over size members starting at pMembers
+		FamilyMemberSpan(FamilyMemberClass * const * pMembers, uint32_t size) : m_pMembers(pMembers), m_Size(size) {}
+
+	// Class methods
+	public:
+		//! @brief Iterator to the first member of the span
+		const_iterator begin() const { return m_pMembers; }
+
+		//! @brief Iterator past the last member of the span
+		const_iterator end() const { return m_pMembers + m_Size; }
+
+		//! @brief Retrieves the number of members in the span
+		uint32_t size() const { return m_Size; }
+
+		//! @brief Returns true if the span has no members
+		bool empty() const { return m_Size == 0; }
+
+		//! @brief Retrieves the member at index
+		FamilyMemberClass * operator[](uint32_t index) const { return m_pMembers[index]; }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYMEMBERSPAN_H_ */
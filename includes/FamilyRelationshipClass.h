@@ -0,0 +1,129 @@
+/**
+ *  @file    FamilyRelationshipClass.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyRelationshipClass object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyRelationshipClass class.
+ *
+ *  A FamilyRelationshipClass object is a directed relationship
+ *  from one family member to another.  The kind of relationship
+ *  and its flags are bit-packed into an inline tag so that
+ *  traversals can filter relationships with a mask test.  The
+ *  attribute collection is left for rarely used user metadata.
+ *
+ *  Tag layout:
+ *  - bits 0-7:  one-hot relationship type (1 << relationship_t)
+ *  - bits 8-15: relationship flags (FLAG_BIOLOGICAL, ...)
+ *
+ *  Each relationship is linked into the list of outgoing
+ *  relationships of its from member and the list of incoming
+ *  relationships of its to member so that it can be added and
+ *  removed in constant time.  Relationships are allocated in the
+ *  FamilyTreeArena of the tree and are never destroyed one by one.
+ *
+ */
+
+#ifndef FAMILYRELATIONSHIPCLASS_H_
+#define FAMILYRELATIONSHIPCLASS_H_
+
+#include <stdint.h>
+
+#include "FamilyTreeAttributeCollection.h"
+
+#include "libs/gtest/gtest_prod.h" // For testing
+
+namespace FamilyTree {
+
+class FamilyMemberClass;
+
+class FamilyRelationshipClass {
+	friend class FamilyMemberClass;
+	friend class FamilyTreeClass;
+	FRIEND_TEST(FamilyTreeTest, FamilyRelationshipClass);
+
+	// Constants and enums
+	public:
+		//! @brief Mask of the one-hot relationship type bits of the tag
+		static const uint32_t TYPE_MASK = 0x000000FF;
+
+		//! @brief Mask of the flag bits of the tag
+		static const uint32_t FLAGS_MASK = 0x0000FF00;
+
+		//! @brief Relationship flags
+		static const uint32_t FLAG_BIOLOGICAL = 0x00000100;
+		static const uint32_t FLAG_ADOPTIVE   = 0x00000200;
+		static const uint32_t FLAG_STEP       = 0x00000400;
+
+	// Member variables
+	private:
+		// Family members the relationship is directed from and to
+		FamilyMemberClass * m_pFrom;
+		FamilyMemberClass * m_pTo;
+
+		// Relationship type and flags (see the tag layout above)
+		uint32_t m_Tag;
+
+		// Links in the outgoing relationship list of m_pFrom
+		FamilyRelationshipClass * m_pPrevOutgoing;
+		FamilyRelationshipClass * m_pNextOutgoing;
+
+		// Links in the incoming relationship list of m_pTo
+		FamilyRelationshipClass * m_pPrevIncoming;
+		FamilyRelationshipClass * m_pNextIncoming;
+
+		// Attributes of the relationship
+		FamilyTreeAttributeCollection m_Attributes;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor
+		FamilyRelationshipClass();
+
+	// Class methods
+	private:
+		//! @brief Set the relationship type and flags of the relationship
+		void setTag(int32_t relationship, uint32_t flags) { m_Tag = typeBit(relationship) | (flags & FLAGS_MASK); }
+
+	public:
+		//! @brief Retrieves the tag bit of a relationship type
+		//!		  Type bits can be or'ed together to match several types.
+		static uint32_t typeBit(int32_t relationship) { return 1u << relationship; }
+
+		//! @brief Retrieves the relationship type (a FamilyTreeClass::relationship_t)
+		int32_t getRelationship() const { return __builtin_ctz(m_Tag | ~TYPE_MASK); }
+
+		//! @brief Retrieves the relationship flags
+		uint32_t getFlags() const { return m_Tag & FLAGS_MASK; }
+
+		//! @brief Returns true if the tag has any of the bits in mask
+		//!		  (e.g. typeBit(Parent_Child) | typeBit(Sibling))
+		bool matchesAny(uint32_t mask) const { return (m_Tag & mask) != 0; }
+
+		//! @brief Returns true if the tag has all of the bits in mask
+		//!		  (e.g. typeBit(Parent_Child) | FLAG_ADOPTIVE)
+		bool matchesAll(uint32_t mask) const { return (m_Tag & mask) == mask; }
+
+		//! @brief Retrieves the family member the relationship is directed from
+		FamilyMemberClass * getFrom() const { return m_pFrom; }
+
+		//! @brief Retrieves the family member the relationship is directed to
+		FamilyMemberClass * getTo() const { return m_pTo; }
+
+		//! @brief Retrieves the next relationship directed from the same member
+		FamilyRelationshipClass * getNextOutgoing() const { return m_pNextOutgoing; }
+
+		//! @brief Retrieves the next relationship directed to the same member
+		FamilyRelationshipClass * getNextIncoming() const { return m_pNextIncoming; }
+
+		//! @brief Retrieves the attributes of the relationship
+		FamilyTreeAttributeCollection & getAttributes() { return m_Attributes; }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYRELATIONSHIPCLASS_H_ */
@@ -0,0 +1,115 @@
+/**
+ *  @file    FamilyTreeArena.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeArena object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeArena class.
+ *
+ *  FamilyTreeArena is a bump allocator that owns all of the
+ *  member, relationship and attribute storage of a family tree.
+ *  Memory is handed out from large chunks and is never freed
+ *  object by object.  Destroying or resetting the arena frees
+ *  the whole tree at once by releasing its (few) chunks.
+ *
+ *  Objects created in the arena must not need their destructor
+ *  to run.
+ *
+ */
+
+#ifndef FAMILYTREEARENA_H_
+#define FAMILYTREEARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+#include <string>
+
+namespace FamilyTree {
+
+class FamilyTreeArena {
+	// Constants and enums
+	public:
+		//! @brief Size of the first chunk.  Each new chunk doubles in size.
+		static const size_t INITIAL_CHUNK_SIZE = 64 * 1024;
+
+		//! @brief Largest chunk size
+		static const size_t MAX_CHUNK_SIZE = 64 * 1024 * 1024;
+
+	// Member variables
+	private:
+		// Header at the start of every chunk
+		typedef struct chunk_s {
+			struct chunk_s * pNext;
+			size_t size;
+		} chunk_t;
+
+		// List of chunks, most recent first
+		chunk_t * m_pChunks;
+
+		// Free space in the current chunk
+		char * m_pCurrent;
+		char * m_pEnd;
+
+		// Size of the next chunk to allocate
+		size_t m_NextChunkSize;
+
+		// Statistics
+		size_t m_BytesReserved;
+		size_t m_BytesUsed;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor
+		FamilyTreeArena();
+
+		//! @brief Destructor.  Frees every chunk.
+		~FamilyTreeArena();
+
+	private:
+		// The arena owns its chunks and cannot be copied
+		FamilyTreeArena(const FamilyTreeArena & orig);
+		FamilyTreeArena & operator=(const FamilyTreeArena & orig);
+
+	// Member functions
+	private:
+		//! @brief Allocate a new chunk that can hold at least size bytes
+		//! @return true if the chunk was allocated
+		bool addChunk(size_t size);
+
+	public:
+		//! @brief Allocate memory from the arena
+		//! @param[in] size Number of bytes
+		//! @param[in] alignment Alignment of the memory (power of 2)
+		//! @return Pointer to the memory or NULL if out of memory
+		void * allocate(size_t size, size_t alignment);
+
+		//! @brief Create an object in the arena
+		//! @return Pointer to the object or NULL if out of memory
+		template<class T> T * create() {
+			void * pMemory = allocate(sizeof(T), __alignof__(T));
+			return (pMemory == NULL) ? NULL : new (pMemory) T();
+		}
+
+		//! @brief Copy a string into the arena
+		//! @param[in] value String to copy
+		//! @return Null terminated copy of the string or NULL if out of memory
+		const char * copyString(std::string const & value);
+
+		//! @brief Free all of the memory handed out by the arena
+		void reset();
+
+		//! @brief Retrieves the number of bytes reserved from the system
+		size_t getBytesReserved() const { return m_BytesReserved; }
+
+		//! @brief Retrieves the number of bytes handed out
+		size_t getBytesUsed() const { return m_BytesUsed; }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEARENA_H_ */
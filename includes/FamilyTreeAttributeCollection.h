@@ -0,0 +1,65 @@
+/**
+ *  @file    FamilyTreeAttributeCollection.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeAttributeCollection object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeAttributeCollection class.
+ *
+ *  A small list of named integer attributes that can be
+ *  attached to family members and relationships.  The
+ *  attributes are allocated in the FamilyTreeArena of
+ *  the tree that owns the object.
+ *
+ */
+
+#ifndef FAMILYTREEATTRIBUTECOLLECTION_H_
+#define FAMILYTREEATTRIBUTECOLLECTION_H_
+
+#include <stdint.h>
+
+#include "FamilyTreeArena.h"
+
+namespace FamilyTree {
+
+class FamilyTreeAttributeCollection {
+	// Member variables
+	private:
+		// A single named attribute
+		typedef struct attribute_s {
+			const char * pName;
+			int32_t value;
+			struct attribute_s * pNext;
+		} attribute_t;
+
+		// List of attributes
+		attribute_t * m_pAttributes;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor
+		FamilyTreeAttributeCollection();
+
+	// Member functions
+	public:
+		//! @brief Retrieves an integer attribute
+		//! @param[in] name Name of the attribute
+		//! @return Pointer to the value of the attribute or NULL if it is not set
+		int32_t * getIntAttribute(const char * name);
+
+		//! @brief Set an integer attribute, adding it if it is not set
+		//! @param[in] name Name of the attribute.  Must stay valid for
+		//!				   the lifetime of the arena (string literal or arena copy)
+		//! @param[in] value Value of the attribute
+		//! @param[in] arena Arena to allocate a new attribute from
+		//! @return true if the attribute was set
+		bool setIntAttribute(const char * name, int32_t value, FamilyTreeArena & arena);
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEATTRIBUTECOLLECTION_H_ */
@@ -0,0 +1,144 @@
+/**
+ *  @file    FamilyTreeAttributeColumns.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeAttributeColumns object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeAttributeColumns class.
+ *
+ *  FamilyTreeAttributeColumns stores the typed attributes of
+ *  the family members (age, gender, birth year) as one dense
+ *  array (column) per attribute, indexed by member ID.  Filters
+ *  over the attributes are evaluated as a single branch-free loop
+ *  over the columns that the compiler can vectorize.
+ *
+ */
+
+#ifndef FAMILYTREEATTRIBUTECOLUMNS_H_
+#define FAMILYTREEATTRIBUTECOLUMNS_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include "FamilyMemberClass.h"
+#include "FamilyTreeMemberBitmap.h"
+
+namespace FamilyTree {
+
+class FamilyTreeAttributeColumns {
+	// Constants and enums
+	public:
+		//! @brief Age of a member whose age is not known
+		static const uint8_t INVALID_AGE = UINT8_MAX;
+
+		//! @brief Birth year of a member whose birth year is not known
+		static const int16_t INVALID_BIRTH_YEAR = INT16_MIN;
+
+		//! @brief Gender mask that matches every gender
+		static const uint32_t ALL_GENDERS = 0xFFFFFFFF;
+
+		//! @brief Attribute columns
+		typedef enum {
+			Attribute_Age,
+			Attribute_Gender,
+			Attribute_BirthYear
+		} attribute_t;
+
+		//! @brief Typed attributes of one family member
+		typedef struct {
+			uint8_t age;
+			FamilyMemberClass::gender_t gender;
+			int16_t birthYear;
+		} member_attributes_t;
+
+		//! @brief Conjunction of range conditions over the columns.
+		//!		  A member matches if every one of its values is within
+		//!		  the inclusive ranges.  Members with an unknown value
+		//!		  only match a condition that is left at its default.
+		typedef struct member_filter_s {
+			uint8_t minAge = 0;
+			uint8_t maxAge = INVALID_AGE;
+
+			//! Bit (1 << gender_t) is set for each gender that matches
+			uint32_t genderMask = ALL_GENDERS;
+
+			int16_t minBirthYear = INVALID_BIRTH_YEAR;
+			int16_t maxBirthYear = INT16_MAX;
+
+			uint32_t minChildren = 0;
+			uint32_t maxChildren = UINT32_MAX;
+		} member_filter_t;
+
+	// Member variables
+	private:
+		// 1 if the member ID is in use, 0 otherwise
+		std::vector<uint8_t> m_InUse;
+
+		// Attribute columns
+		std::vector<uint8_t> m_Ages;
+		std::vector<uint8_t> m_Genders;
+		std::vector<int16_t> m_BirthYears;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor
+		FamilyTreeAttributeColumns();
+
+		//! @brief Destructor
+		~FamilyTreeAttributeColumns();
+
+	// Member functions
+	public:
+		//! @brief Remove all members from the columns
+		void clear();
+
+		//! @brief Add a member with unknown attributes
+		//! @param[in] memberId ID of the member
+		void addMember(uint32_t memberId);
+
+		//! @brief Remove a member from the columns
+		//! @param[in] memberId ID of the member
+		void removeMember(uint32_t memberId);
+
+		//! @brief Set the attributes of a member
+		//! @param[in] memberId ID of the member
+		//! @param[in] attributes New attributes of the member
+		void setAttributes(uint32_t memberId, member_attributes_t const & attributes);
+
+		//! @brief Retrieves the attributes of a member
+		//! @param[in] memberId ID of the member
+		//! @param[out] attributes Attributes of the member
+		void getAttributes(uint32_t memberId, member_attributes_t & attributes) const;
+
+		//! @brief Set the age of a member
+		void setAge(uint32_t memberId, uint8_t age) { m_Ages[memberId] = age; }
+
+		//! @brief Set the gender of a member
+		void setGender(uint32_t memberId, FamilyMemberClass::gender_t gender) { m_Genders[memberId] = (uint8_t)gender; }
+
+		//! @brief Set the birth year of a member
+		void setBirthYear(uint32_t memberId, int16_t birthYear) { m_BirthYears[memberId] = birthYear; }
+
+		//! @brief Find the members that match a filter
+		//! @param[in] filter Filter to evaluate
+		//! @param[in] pChildCounts Child count column indexed by member ID
+		//! @param[out] memberIds IDs of the matching members (in member ID order)
+		void findMembers(member_filter_t const & filter, const uint32_t * pChildCounts, std::vector<uint32_t> & memberIds) const;
+
+		//! @brief Build the bitmap of the members whose attribute is within
+		//!		  [minValue, maxValue].  Members with an unknown value only
+		//!		  match if the unknown value is within the range.
+		//! @param[in] attribute Attribute column to scan
+		//! @param[in] minValue Smallest value that matches
+		//! @param[in] maxValue Largest value that matches
+		//! @param[out] bitmap Bitmap of the matching members (resized to the number of member IDs)
+		void findMembersInRange(attribute_t attribute, int64_t minValue, int64_t maxValue, FamilyTreeMemberBitmap & bitmap) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEATTRIBUTECOLUMNS_H_ */
@@ -12,10 +12,13 @@
  *
  *  This class contains the members and methods to store
  *  and perform operations on the family tree.  The family
- *  tree is implemented as a graph leveraging the
- *  OpenGraphTheory library.  Family members are represented
- *  as Vertex objects in the graph while relationships are
- *  represented as edges.
+ *  tree is implemented as a directed graph.  Family members
+ *  are represented as FamilyMemberClass objects while
+ *  relationships are represented as FamilyRelationshipClass
+ *  objects linked into the relationship lists of both members.
+ *  All members, relationships and attributes are allocated from
+ *  the arena of the tree, so the whole tree is freed at once when
+ *  it is reloaded or destroyed.
  *
  *  The public member methods can be used to retrieve information
  *  from the family tree.  THe public methods are defined in a
@@ -33,16 +36,34 @@
 
 #include <stdint.h>
 #include <string>
-
-#include "libs/opengt/opengt.h"
+#include <vector>
+#include <ios>
+#include <map>
+#include <unordered_map>
 
 #include "FamilyTreeOpResultCode.h"
 #include "FamilyMemberClass.h"
+#include "FamilyRelationshipClass.h"
+#include "FamilyTreeArena.h"
+#include "FamilyTreeAttributeColumns.h"
+#include "FamilyTreeConnectedFamilies.h"
+#include "FamilyTreeCountIndex.h"
+#include "FamilyTreeFamilyUnits.h"
+#include "FamilyTreeGedcomReader.h"
+#include "FamilyTreeGraphWriter.h"
+#include "FamilyTreeKinship.h"
+#include "FamilyTreeMaterializedView.h"
+#include "FamilyTreeMemberBitmap.h"
+#include "FamilyTreeMemberSet.h"
+#include "FamilyTreeNameDictionary.h"
+#include "FamilyTreeNameFilter.h"
+#include "FamilyTreePathExpression.h"
+#include "FamilyTreeResultCache.h"
+#include "FamilyTreeTrigramIndex.h"
 
 #include "libs/gtest/gtest_prod.h" // For testing
 
 using namespace std;
-using namespace OpenGraphtheory;
 
 namespace FamilyTree {
 
@@ -56,14 +77,213 @@ class FamilyTreeClass {
 			Sibling
 		} relationship_t;
 
+		//! @brief Member ID used when a family member does not exist
+		static const uint32_t INVALID_MEMBER_ID = UINT32_MAX;
+
+		//! @brief A relationship between two family members
+		//!		  Parent_Child means from is the parent of to
+		typedef struct {
+			string from;
+			string to;
+			relationship_t relationship;
+			uint32_t flags;		//!< FamilyRelationshipClass::FLAG_* bits (0 if left out)
+		} relationship_record_t;
+
+		//! @brief Typed attributes (age, gender, birth year) of a family member
+		typedef FamilyTreeAttributeColumns::member_attributes_t member_attributes_t;
+
+		//! @brief Range conditions over the member attributes and child count
+		typedef FamilyTreeAttributeColumns::member_filter_t member_filter_t;
+
+		//! @brief Generation of a member that is part of (or descends from) a parent->child cycle
+		static const uint32_t INVALID_GENERATION = UINT32_MAX;
+
+		//! @brief Kinds of siblings that sibling counts can be taken over
+		typedef enum {
+			Siblings_Declared,		//!< Declared sibling relationships
+			Siblings_Full,			//!< Members with the same set of parents
+			Siblings_Half			//!< Members that share some but not all of the parents
+		} sibling_kind_t;
+
+		//! @brief Member statistics and attributes that predicates can test
+		typedef enum {
+			Field_ChildCount,
+			Field_SiblingCount,
+			Field_GrandchildCount,
+			Field_Generation,		//!< 0 for members without parents, otherwise 1 + generation of the youngest parent
+			Field_Age,
+			Field_Gender,			//!< FamilyMemberClass::gender_t value
+			Field_BirthYear
+		} member_field_t;
+
+		//! @brief Condition minValue <= field <= maxValue
+		typedef struct {
+			member_field_t field;
+			int64_t minValue;
+			int64_t maxValue;
+		} range_condition_t;
+
+		//! @brief Conditions that must all match (AND)
+		typedef vector<range_condition_t> condition_conjunction_t;
+
+		//! @brief Conjunctions of which at least one must match (OR of ANDs)
+		typedef vector<condition_conjunction_t> member_predicate_t;
+
+		//! @brief Hit and miss counters of the result cache
+		typedef FamilyTreeResultCache::cache_stats_t result_cache_stats_t;
+
+		//! @brief Read-only name list shared with the result cache
+		typedef FamilyTreeResultCache::name_list_row_t name_list_row_t;
+
+		//! @brief A family (members connected by any relationships)
+		typedef struct {
+			string representative;	//!< Name of one member of the family
+			uint32_t size;			//!< Number of members of the family
+		} family_info_t;
+
+		//! @brief Result of a structural validation of the tree.  Counts cover
+		//!		  the whole tree and issues describes the first few problems.
+		typedef struct {
+			bool valid;							//!< No problem was found
+			uint32_t members;					//!< Members checked
+			uint64_t relationships;				//!< Relationships checked
+			uint32_t cycleMembers;				//!< Members on a parent->child cycle
+			uint32_t duplicateRelationships;	//!< Relationships that repeat another one
+			uint32_t duplicatesSkipped;			//!< Duplicate input records skipped while the tree was built
+			uint32_t siblingConflicts;			//!< Sibling pairs that contradict the parent relationships
+			uint32_t orphanRelationships;		//!< Relationships without an inverse or to a removed member
+			vector<string> issues;				//!< Up to MAX_VALIDATION_ISSUES descriptions
+		} validation_report_t;
+
+		//! @brief Largest number of issue descriptions in a validation report
+		static const uint32_t MAX_VALIDATION_ISSUES = 32;
+
+		//! @brief Depth of a graph file export without a depth limit
+		static const uint32_t NO_DEPTH_LIMIT = UINT32_MAX;
+
+		//! @brief Size and memory of the family units
+		typedef FamilyTreeFamilyUnits::unit_stats_t family_unit_stats_t;
+
+		//! @brief Size, memory and state of a materialized view
+		typedef FamilyTreeMaterializedView::view_stats_t materialized_view_stats_t;
+
+		//! @brief Two family members whose common ancestors to retrieve
+		typedef struct {
+			string first;
+			string second;
+		} member_pair_t;
+
+		//! @brief How a descendant (or ancestor) search expanded its frontier
+		typedef struct {
+			uint32_t levels;			//!< Number of levels expanded
+			uint32_t bottomUpLevels;	//!< Levels that were expanded bottom-up
+			uint32_t parallelLevels;	//!< Levels that were split over more than one thread
+		} descendant_search_stats_t;
+
+	private:
+		// A descendant or ancestor search switches from top-down to bottom-up when the
+		// frontier has more than 1/DESCENDANT_ALPHA of the unexplored
+		// edges, and back when it has less than 1/DESCENDANT_BETA of the members
+		static const uint32_t DESCENDANT_ALPHA = 14;
+		static const uint32_t DESCENDANT_BETA = 24;
+
+		// Smallest number of frontier members (top-down) or member IDs
+		// (bottom-up) that a descendant or ancestor search gives to a thread
+		static const uint32_t PARALLEL_CHUNK_MIN = 4096;
+
+		// Smallest number of pairs that getCommonAncestorsForPairs gives to a thread
+		static const uint32_t PARALLEL_PAIRS_CHUNK_MIN = 256;
+
+		// Smallest number of rows of a materialized view that are given to a thread
+		static const uint32_t PARALLEL_ROWS_CHUNK_MIN = 256;
+
 	// Member variables
     private:
-        // Graph that will represent the family tree
-        Graph m_Graph;
-        
+        // Arena that holds all of the family members,
+        // relationships and attributes of the tree
+        FamilyTreeArena m_Arena;
+
+        // Removed relationships that can be reused
+        FamilyRelationshipClass * m_pFreeRelationships;
+
         // Name of the input file containing the data for the tree
         string m_inputFileName;
 
+        // Byte offset into the input file up to which
+        // records have been applied to the tree
+        streamoff m_inputFileOffset;
+
+        // Number of duplicate relationships skipped while reading input records
+        uint32_t m_DuplicatesSkipped;
+
+        // Family members indexed by member ID.  The entry
+        // of a removed member is NULL until the ID is reused.
+        vector<FamilyMemberClass *> m_Members;
+
+        // Member IDs of removed members that can be reused
+        vector<uint32_t> m_FreeMemberIds;
+
+        // Index of member name -> member ID
+        unordered_map<string, uint32_t> m_MemberIndex;
+
+        // Bloom filter over the member names.  Unknown names
+        // are rejected by it without a lookup in m_MemberIndex.
+        FamilyTreeNameFilter m_NameFilter;
+
+        // Derived counts indexed by member ID.  These are kept
+        // up to date as relationships are added and removed so
+        // that count queries do not need to walk the graph.
+        FamilyTreeCountIndex m_ChildCounts;
+        FamilyTreeCountIndex m_SiblingCounts;
+        FamilyTreeCountIndex m_GrandchildCounts;
+
+        // Typed member attributes stored as columns indexed by member ID
+        FamilyTreeAttributeColumns m_AttributeColumns;
+
+        // Incremented whenever a member or relationship is added or
+        // removed.  Attribute changes leave it alone, so the state
+        // derived from the relationships is kept across them.
+        uint64_t m_StructureVersion;
+
+        // Generation of each member indexed by member ID and
+        // the structure version it was computed for
+        vector<uint32_t> m_Generations;
+        uint64_t m_GenerationsVersion;
+
+        // Incremented whenever a member is added or removed, and
+        // the sorted name dictionary with the names version it
+        // was built for
+        uint64_t m_NamesVersion;
+        uint64_t m_NameDictionaryVersion;
+        FamilyTreeNameDictionary m_NameDictionary;
+
+        // Trigram index of the member names and the names
+        // version it was built for
+        uint64_t m_TrigramIndexVersion;
+        FamilyTreeTrigramIndex m_TrigramIndex;
+
+        // Kinship engine and the structure version it was built for
+        uint64_t m_KinshipVersion;
+        FamilyTreeKinship m_Kinship;
+
+        // Family units and the full and half sibling counts derived
+        // from them.  Every parent that is added or removed updates
+        // them right away.
+        FamilyTreeFamilyUnits m_FamilyUnits;
+
+        // Families of connected members.  Relationships that are
+        // added join families right away.  Removing a relationship
+        // or member marks them stale until the next family query.
+        FamilyTreeConnectedFamilies m_Families;
+        bool m_FamiliesStale;
+
+        // Registered materialized views by name
+        map<string, FamilyTreeMaterializedView> m_MaterializedViews;
+
+        // Results of recent grandparent, children and sibling
+        // name list queries (disabled until enableResultCache)
+        FamilyTreeResultCache m_ResultCache;
+
     public:
         // Default Constructor
 
@@ -82,12 +302,268 @@ class FamilyTreeClass {
     
     // Member functions
     private:
+        //! @brief Remove all family members and relationships from the tree
+        void clearTree();
+
+        //! @brief Record that members or relationships have changed
+        void bumpStructureVersion() { m_StructureVersion++; }
+
+        //! @brief Rebuild m_NameDictionary if members have been added or
+        //!		  removed since it was last built
+        void updateNameDictionary();
+
+        //! @brief Rebuild m_TrigramIndex if members have been added or
+        //!		  removed since it was last built
+        void updateTrigramIndex();
+
+        //! @brief Rebuild m_Kinship if members or relationships have changed since it was last built
+        void updateKinship();
+
+        //! @brief Rebuild m_Families if a relationship or member has been removed
+        void updateFamilies();
+
+        //! @brief Count the members on parent->child cycles for validateTree
+        //!		  (the members that remain after peeling the members without
+        //!		  parents from the top and without children from the bottom)
+        void validateCycles(validation_report_t & report);
+
+        //! @brief Find the member ID of a family member whose kinship to compute
+        //!		  and bring m_Kinship up to date
+        //! @param[in] memberName Name of the family member
+        //! @param[out] memberId ID of the family member
+        //! @return SUCCESS, FAMILY_MEMBER_NOT_FOUND, or INVALID_ARG if the member
+        //!			is part of or descends from a parent->child cycle
+        FamilyTreeOpResultCode getKinshipMemberId(string const & memberName, uint32_t & memberId);
+
+        //! @brief Retrieves up to maxCount names with ranks [first + offset, end)
+        //!		  of the name dictionary
+        void getDictionaryPage
+        (
+            uint32_t first,
+            uint32_t end,
+            uint32_t offset,
+            uint32_t maxCount,
+            vector<string> & nameList
+        );
+
+        //! @brief Recompute m_Generations if members or relationships have
+        //!		  changed since it was last computed
+        void updateGenerations();
+
+        //! @brief Build the bitmap of the members that match a condition
+        //! @param[in] condition Condition to evaluate
+        //! @param[out] bitmap Bitmap of the matching members
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode buildConditionBitmap(range_condition_t const & condition, FamilyTreeMemberBitmap & bitmap);
+
+        //! @brief Build the bitmap of the members that match a predicate
+        //! @param[in] predicate Predicate to evaluate
+        //! @param[out] bitmap Bitmap of the matching members
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode buildPredicateBitmap(member_predicate_t const & predicate, FamilyTreeMemberBitmap & bitmap);
+
+        //! @brief Add the members in the neighbor list of each member of a set
+        //! @param[in] members Members whose neighbors to add
+        //! @param[in] relationship Parent_Child (children), Child_Parent (parents) or Sibling
+        //! @param[in/out] neighbors Set the neighbors are added to
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode addNeighborsToSet
+        (
+            FamilyTreeMemberSet const & members,
+            relationship_t relationship,
+            FamilyTreeMemberSet & neighbors
+        );
+
+        //! @brief Multi-source breadth first search over the parent->child
+        //!		  (descendants) or child->parent (ancestors) relationships
+        //! @param[in] founderIds Member IDs to start from (all in the tree)
+        //! @param[in] relationship Parent_Child (descendants) or Child_Parent (ancestors)
+        //! @param[out] relatives Bitmap of the members reachable by at least one
+        //!						  step from a founder
+        //! @param[out] stats How the frontier was expanded
+        void expandRelatives
+        (
+            vector<uint32_t> const & founderIds,
+            relationship_t relationship,
+            FamilyTreeMemberBitmap & relatives,
+            descendant_search_stats_t & stats
+        );
+
+        //! @brief Build the bitmap of the ancestors that all of a list of members share
+        //! @param[in] memberNames Names of the family members (at least one)
+        //! @param[out] commonAncestors Bitmap of the common ancestors
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode buildCommonAncestorBitmap(vector<string> const & memberNames, FamilyTreeMemberBitmap & commonAncestors);
+
+        //! @brief Clear the common ancestors that have a child in the bitmap.  The
+        //!		  ancestors of a member are closed under parents, so the members left
+        //!		  are the ones that are not an ancestor of another common ancestor.
+        //! @param[in/out] commonAncestors Bitmap of the common ancestors
+        void removeNonMinimalAncestors(FamilyTreeMemberBitmap & commonAncestors);
+
+        //! @brief Retrieves the member IDs of the ancestors of a member
+        //! @param[in] memberId ID of the family member (in the tree)
+        //! @param[in/out] visited Scratch bitmap of every member ID.  All bits are 0
+        //!						   before and after the call.
+        //! @param[out] ancestorIds Member IDs of the ancestors in increasing order
+        void getAncestorIds(uint32_t memberId, FamilyTreeMemberBitmap & visited, vector<uint32_t> & ancestorIds) const;
+
+        //! @brief Retrieves the members at the end of the paths from a member
+        //!		  that an automaton accepts (breadth first search over the product
+        //!		  of the automaton and the tree)
+        //! @param[in] automaton Compiled path expression
+        //! @param[in] memberId ID of the family member to start from
+        //! @param[in/out] visited One empty bitmap of every member ID per state of
+        //!						   the automaton.  They are empty again on return.
+        //! @param[in/out] queue Scratch queue of the search
+        //! @param[out] memberIds Member IDs at the end of the paths in increasing
+        //!						  order, without memberId
+        void evaluatePath
+        (
+            FamilyTreePathExpression const & automaton,
+            uint32_t memberId,
+            vector<FamilyTreeMemberBitmap> & visited,
+            vector<uint64_t> & queue,
+            vector<uint32_t> & memberIds
+        ) const;
+
+        //! @brief Compute every row of a materialized view, splitting the
+        //!		  member IDs over the threads
+        void buildMaterializedView(FamilyTreeMaterializedView & view);
+
+        //! @brief Build the materialized views that are stale
+        void buildStaleMaterializedViews();
+
+        //! @brief Mark the materialized view rows that use a relationship as
+        //!		  dirty.  Called while the relationship is linked, after it is
+        //!		  added and before it is removed.
+        //! @param[in] fromId Member ID the relationship starts from
+        //! @param[in] relationship Type of the relationship
+        void invalidateMaterializedViews(uint32_t fromId, relationship_t relationship);
+
+        //! @brief Retrieves the row of a member in a materialized view, recomputing
+        //!		  the row or the view first if it is out of date
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode getMaterializedViewRow
+        (
+            string const & viewName,
+            string const & memberName,
+            const uint32_t * & pMemberIds,
+            uint32_t & count
+        );
+
         //! @brief Create the family tree based on the input file
         //! @param[in] inputFileName File name of the input file
         //! @return SUCCESS or error
         FamilyTreeOpResultCode constructTreeFromFile(string const & inputFileName);
-        
-        //! @brief Create the relationship between the from and to family members
+
+        //! @brief Create the family tree from the INDI and FAM records of a GEDCOM file
+        //!		  in a single pass
+        //! @param[in] inputFileName File name of the GEDCOM file
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode constructTreeFromGedcom(string const & inputFileName);
+
+        //! @brief Add the individual of a GEDCOM INDI record to the tree.  A name
+        //!		  that is already in the tree is followed by the cross reference.
+        //! @param[in] record INDI record
+        //! @param[in/out] xrefIds Member ID of each cross reference read so far
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode addGedcomIndividual
+        (
+            FamilyTreeGedcomReader::record_t const & record,
+            unordered_map<string, uint32_t> & xrefIds
+        );
+
+        //! @brief Add the parent->child relationships and the sibling relationships
+        //!		  of the children of a GEDCOM FAM record to the tree
+        //! @param[in] record FAM record
+        //! @param[in] xrefIds Member ID of each cross reference read so far
+        //! @param[out] resolved false if some of the individuals have not been
+        //!						read yet.  Nothing is added in that case.
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode addGedcomFamily
+        (
+            FamilyTreeGedcomReader::record_t const & record,
+            unordered_map<string, uint32_t> const & xrefIds,
+            bool & resolved
+        );
+
+        //! @brief Create the family tree from a graph file read by an OpenGT
+        //!		  import filter.  The whole file is imported into a single Graph
+        //!		  that is then converted in one pass over its vertices and edges.
+        //! @param[in] inputFileName File name of the graph file
+        //! @param[in] format OpenGT import format (graphml, gml, tgf, dot, xgmml)
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode constructTreeFromGraph(string const & inputFileName, string const & format);
+
+        //! @brief Retrieves the relationship of a graph edge from its label
+        //! @param[in] label Label of the edge ("parent", "child" or "sibling",
+        //!					 any case).  An edge without a label is a parent->child
+        //!					 relationship if it is directed and a sibling relationship
+        //!					 if it is not.
+        //! @param[in] directed true if the edge is directed
+        //! @param[out] relationship Relationship from the source to the target
+        //! @return false if the label is not a relationship
+        static bool getGraphEdgeRelationship(string const & label, bool directed, relationship_t & relationship);
+
+        //! @brief Apply a single MEMBERS, PARENT, SIBLINGS or ATTRIBUTES record to the tree
+        //! @param[in] currentLine Line read from the input file
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode processInputLine(string const & currentLine);
+
+        //! @brief Apply the AGE, GENDER and BIRTH_YEAR fields of an ATTRIBUTES record
+        //! @param[in] tokens Tokens of the record (ATTRIBUTES:<name>:<field>:<value>...)
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode processAttributesRecord(vector<string> const & tokens);
+
+        //! @brief Add a new family member to the tree
+        //! @param[in] name Name of the family member
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode addFamilyMember(string const & name);
+
+        //! @brief Remove a family member and all of its relationships from the tree
+        //! @param[in] memberId ID of the family member
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode removeFamilyMember(uint32_t memberId);
+
+        //! @brief Rebuild the name filter with room for twice the current number of members
+        void rebuildNameFilter();
+
+        //! @brief Find the member ID of a family member
+        //! @param[in] name Name of the family member to find
+        //! @return Member ID of name or INVALID_MEMBER_ID
+        uint32_t findFamilyMemberId(string const & name) const;
+
+        //! @brief Find the member ID of a family member in the name index only,
+        //!		  for callers that have already checked the name filter
+        //! @param[in] name Name of the family member to find
+        //! @return Member ID of name or INVALID_MEMBER_ID
+        uint32_t findIndexedMemberId(string const & name) const;
+
+        //! @brief Find the directed relationship from -> to
+        //! @return The relationship or NULL
+        FamilyRelationshipClass * findRelationship(uint32_t fromId, uint32_t toId, relationship_t relationship);
+
+        //! @brief Update the derived counts for a parent->child
+        //!		  edge that was added (delta = 1) or removed (delta = -1)
+        void updateCountsForParentChild(uint32_t parentId, uint32_t childId, int64_t delta);
+
+        //! @brief Remove the directed relationship from -> to
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode removeRelationship(uint32_t fromId, uint32_t toId, relationship_t relationship);
+
+        //! @brief Add both directions of a family relationship
+        //! @param[in] flags FamilyRelationshipClass::FLAG_* bits of both directions
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode addFamilyRelationship(uint32_t fromId, uint32_t toId, relationship_t relationship, uint32_t flags = 0);
+
+        //! @brief Remove both directions of a family relationship
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode removeFamilyRelationship(uint32_t fromId, uint32_t toId, relationship_t relationship);
+
+        //! @brief Create the relationship between the from and to family members.
+        //!		  A relationship that is already in the tree is skipped and counted
+        //!		  in m_DuplicatesSkipped.
         //! @return SUCCESS or error
         FamilyTreeOpResultCode addRelationship
         (
@@ -95,51 +571,211 @@ class FamilyTreeClass {
             string const & to,
             relationship_t relationship
         );
+
+        //! @brief Create the directed relationship from -> to
+        //! @param[in] flags FamilyRelationshipClass::FLAG_* bits of the relationship
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode addRelationship(uint32_t fromId, uint32_t toId, relationship_t relationship, uint32_t flags = 0);
+
+        //! @brief Find both directions of a family relationship by member name
+        //! @param[in/out] pForward Relationship from -> to
+        //! @param[in/out] pReverse Relationship to -> from
+        //! @return SUCCESS, FAMILY_MEMBER_NOT_FOUND or RELATIONSHIP_NOT_FOUND
+        FamilyTreeOpResultCode findFamilyRelationship
+        (
+            string const & from,
+            string const & to,
+            relationship_t relationship,
+            FamilyRelationshipClass * & pForward,
+            FamilyRelationshipClass * & pReverse
+        );
         
-        //! @brief Find a family member
-        //! @param[in] name Name of the family member to find
-        //! @return FamilyMemberClass object for name or NULL
-        FamilyMemberClass * findFamilyMember(string const & name);
+        //! @brief Retrieves the names of the members whose count in
+        //!		  countIndex is within [minCount, maxCount]
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode getMembersWithCountInRange
+        (
+            FamilyTreeCountIndex const & countIndex,
+            uint32_t minCount,
+            uint32_t maxCount,
+            vector<string> & nameList
+        );
 
-        //! @brief Retrieves the list of grandparents for memberName
-        //! @param[in] memberName Name of the family member whose grandparents list to retrieve
+        //! @brief Retrieves the list of grandparents of a family member
+        //! @param[in] memberId ID of a family member in the tree
         //! @param[in/out] list A vector containing pointers to the
         //!					   FamilyMemberClass objects that are grandparents of the specified member
-        //! @return SUCCESS or error
-        FamilyTreeOpResultCode getGrandparentsList
+        void getGrandparentsList
 		(
-			string const & memberName,
+			uint32_t memberId,
 			vector<FamilyMemberClass *> & list
 		);
 
-        //! @brief Retrieves the list of children for memberName
-		//! @param[in] memberName Name of the family member whose children list to retrieve
-		//! @param[in/out] list A vector containing pointers to the
-		//!					   FamilyMemberClass objects that are children of the specified member
-		//! @return SUCCESS or error
-        FamilyTreeOpResultCode getChildrenList
+        //! @brief Retrieves the list of children of a family member
+        //! @param[in] memberId ID of a family member in the tree
+        //! @param[in/out] list A vector containing pointers to the
+        //!					   FamilyMemberClass objects that are children of the specified member
+        void getChildrenList
 		(
-			string const & memberName,
+			uint32_t memberId,
 			vector<FamilyMemberClass *> & list
 		);
 
-        //! @brief Retrieves the list of children for memberName
-		//! @param[in] memberName Name of the family member whose sibling list to retrieve
-		//! @param[in/out] list A vector containing pointers to the
-		//!					   FamilyMemberClass objects that are siblings of the specified member
-		//! @return SUCCESS or error
-        FamilyTreeOpResultCode getSiblingList
+        //! @brief Retrieves the list of siblings of a family member
+        //! @param[in] memberId ID of a family member in the tree
+        //! @param[in/out] list A vector containing pointers to the
+        //!					   FamilyMemberClass objects that are siblings of the specified member
+        void getSiblingList
 		(
-			string const & memberName,
+			uint32_t memberId,
 			vector<FamilyMemberClass *> & list
 		);
 
+        //! @brief Retrieves the names of the members a name list query returns
+        //! @param[in] queryKind Grandparents, children or siblings
+        //! @param[in] memberId ID of a family member in the tree
+        //! @param[in/out] nameList A vector containing the names
+        void buildQueryNameList
+		(
+			FamilyTreeResultCache::query_kind_t queryKind,
+			uint32_t memberId,
+			vector<string> & nameList
+		);
+
+        //! @brief Retrieves the result of a name list query from the
+        //!		  result cache, or builds it and adds it to the cache
+        //! @param[in] queryKind Grandparents, children or siblings
+        //! @param[in] memberName Name of the family member the query is about
+        //! @param[in/out] nameList The names, shared with the result cache
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode getQueryNameList
+		(
+			FamilyTreeResultCache::query_kind_t queryKind,
+			string const & memberName,
+			name_list_row_t & nameList
+		);
+
+        //! @brief Retrieves the result of a name list query into a vector
+        //! @param[in] queryKind Grandparents, children or siblings
+        //! @param[in] memberName Name of the family member the query is about
+        //! @param[in/out] nameList A vector containing the names
+        //! @return SUCCESS or error
+        FamilyTreeOpResultCode getQueryNameList
+		(
+			FamilyTreeResultCache::query_kind_t queryKind,
+			string const & memberName,
+			vector<string> & nameList
+		);
+
     public:
         //! @brief Initialize the family tree
 		//! @param[in] inputFileName Name of the input file that has the family tree data
 		//! @return SUCCESS or error
         FamilyTreeOpResultCode initialize(string const & inputFileName);
 
+        //! @brief Initialize the family tree from a GEDCOM file.  Individuals (INDI)
+		//!		  become family members with their sex and birth year, and families
+		//!		  (FAM) become parent->child relationships between the husband and
+		//!		  wife and each child, and sibling relationships between the children.
+		//!		  The file is read in a single pass with a bounded buffer.
+		//! @param[in] inputFileName Name of the GEDCOM file
+		//! @return SUCCESS or error
+        FamilyTreeOpResultCode initializeFromGedcom(string const & inputFileName);
+
+        //! @brief Initialize the family tree from a graph file in any format with
+		//!		  an OpenGT import filter.  Vertices become family members named by
+		//!		  their label (or their ID if they have none) and edges become
+		//!		  relationships typed by their label: "parent" (the source is the
+		//!		  parent of the target), "child" (the source is the child of the
+		//!		  target) or "sibling".
+		//! @param[in] inputFileName Name of the graph file
+		//! @param[in] format OpenGT import format (graphml, gml, tgf, dot, xgmml).
+		//!					  If empty the extension of the file name is used.
+		//! @return SUCCESS or error
+        FamilyTreeOpResultCode initializeFromGraphFile(string const & inputFileName, string const & format = "");
+
+        //! @brief Apply the records that have been appended to the input file
+		//!		  since it was last read.  Only complete (newline terminated)
+		//!		  lines are applied so a record that is still being written
+		//!		  is picked up by the next call.  A record that cannot be
+		//!		  applied is skipped: its error is returned and the next
+		//!		  call continues with the line that follows it.
+		//! @param[in] maxLines Maximum number of lines to apply in this batch (0 = no limit)
+		//! @param[in/out] linesApplied Number of lines that were applied
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode followInputFile(uint32_t maxLines, uint32_t & linesApplied);
+
+        //! @brief Add family members to the tree.  Names that are
+		//!		  already in the tree are skipped.
+		//! @param[in] names Names of the family members to add
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode addFamilyMembers(vector<string> const & names);
+
+        //! @brief Remove family members and all of their relationships from the tree.
+		//!		  Nothing is removed if any of the names is not in the tree.
+		//! @param[in] names Names of the family members to remove
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode removeFamilyMembers(vector<string> const & names);
+
+        //! @brief Add relationships to the tree.  Both directions of each relationship
+		//!		  are added (a parent->child relationship also adds child->parent).
+		//!		  Relationships that are already in the tree are skipped.
+		//!		  Nothing is added if any of the members is not in the tree.
+		//!		  The flags of a record are set on both directions of a new
+		//!		  relationship; a relationship that is already in the tree
+		//!		  keeps its flags.
+		//! @param[in] relationships Relationships to add
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode addRelationships(vector<relationship_record_t> const & relationships);
+
+        //! @brief Retrieves the flags (FamilyRelationshipClass::FLAG_*) of a relationship
+		//! @param[in] from Name of the member the relationship is from
+		//! @param[in] to Name of the member the relationship is to
+		//! @param[in] relationship Type of the relationship
+		//! @param[in/out] flags Flags of the relationship
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getRelationshipFlags(string const & from, string const & to, relationship_t relationship, uint32_t & flags);
+
+        //! @brief Set an integer attribute (user metadata) of both directions of a relationship
+		//! @param[in] from Name of the member the relationship is from
+		//! @param[in] to Name of the member the relationship is to
+		//! @param[in] relationship Type of the relationship
+		//! @param[in] name Name of the attribute
+		//! @param[in] value Value of the attribute
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode setRelationshipAttribute
+		(
+			string const & from,
+			string const & to,
+			relationship_t relationship,
+			string const & name,
+			int32_t value
+		);
+
+        //! @brief Retrieves an integer attribute of a relationship
+		//! @param[in] from Name of the member the relationship is from
+		//! @param[in] to Name of the member the relationship is to
+		//! @param[in] relationship Type of the relationship
+		//! @param[in] name Name of the attribute
+		//! @param[in/out] value Value of the attribute (unchanged if it is not set)
+		//! @param[in/out] isSet true if the attribute is set
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getRelationshipAttribute
+		(
+			string const & from,
+			string const & to,
+			relationship_t relationship,
+			string const & name,
+			int32_t & value,
+			bool & isSet
+		);
+
+        //! @brief Remove relationships (both directions) from the tree.
+		//!		  Nothing is removed if any of the relationships is not in the tree.
+		//! @param[in] relationships Relationships to remove
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode removeRelationships(vector<relationship_record_t> const & relationships);
+
         //! @brief Retrieves the list of names of the grandparents for the specified family member
 		//! @param[in] memberName Name of the family member whose grandparent list to retrieve
 		//! @param[in/out] nameList A vector containing the names of the grandparents of the specified member
@@ -158,6 +794,27 @@ class FamilyTreeClass {
 		//! @return SUCCESS or error
 		FamilyTreeOpResultCode getSiblingNameList(string const & memberName, vector<string> & nameList);
 
+        //! @brief Retrieves the names of the grandparents of the specified family member.
+		//!		  A result that is in the result cache is shared instead of copied.
+		//! @param[in] memberName Name of the family member whose grandparents list to retrieve
+		//! @param[in/out] nameList Read-only list of the names of the grandparents
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getGrandparentNameList(string const & memberName, name_list_row_t & nameList);
+
+        //! @brief Retrieves the names of the children of the specified family member.
+		//!		  A result that is in the result cache is shared instead of copied.
+		//! @param[in] memberName Name of the family member whose children list to retrieve
+		//! @param[in/out] nameList Read-only list of the names of the children
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getChildrenNameList(string const & memberName, name_list_row_t & nameList);
+
+        //! @brief Retrieves the names of the siblings of the specified family member.
+		//!		  A result that is in the result cache is shared instead of copied.
+		//! @param[in] memberName Name of the family member whose siblings list to retrieve
+		//! @param[in/out] nameList Read-only list of the names of the siblings
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getSiblingNameList(string const & memberName, name_list_row_t & nameList);
+
 		//! @brief Retrieves the list of names of all members of the family tree
 		//! @param[in/out] nameList A vector containing the names of the family members
 		//!				   in the family tree
@@ -180,6 +837,15 @@ class FamilyTreeClass {
 		//! @return SUCCESS or error
 		FamilyTreeOpResultCode getMembersWithSiblingCount(uint32_t count, vector<string> & nameList);
 
+        //! @brief Retrieves the list of names of the family members who
+		//!		  have the specified number of siblings of a kind
+		//! @param[in] count Specified number of siblings
+		//! @param[in] kind Declared, full or half siblings
+		//! @param[in/out] nameList A vector containing the names of the members who
+		//!						   have the specified number of siblings
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersWithSiblingCount(uint32_t count, sibling_kind_t kind, vector<string> & nameList);
+
         //! @brief Retrieves the list of names of the family members who
 		//!		  have the most grandchildren
 		//! @param[in/out] nameList A vector containing the names of the members who
@@ -187,6 +853,465 @@ class FamilyTreeClass {
 		//! @return SUCCESS or error
 		FamilyTreeOpResultCode getMembersWithMostGrandchildren(vector<string> & nameList);
 
+        //! @brief Retrieves the list of names of the family members who
+		//!		  have between minCount and maxCount children (inclusive)
+		//! @param[in] minCount Smallest number of children
+		//! @param[in] maxCount Largest number of children
+		//! @param[in/out] nameList A vector containing the names of the matching members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersWithChildCountInRange(uint32_t minCount, uint32_t maxCount, vector<string> & nameList);
+
+        //! @brief Retrieves the list of names of the family members who
+		//!		  have between minCount and maxCount siblings (inclusive)
+		//! @param[in] minCount Smallest number of siblings
+		//! @param[in] maxCount Largest number of siblings
+		//! @param[in/out] nameList A vector containing the names of the matching members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersWithSiblingCountInRange(uint32_t minCount, uint32_t maxCount, vector<string> & nameList);
+
+        //! @brief Retrieves the list of names of the family members who
+		//!		  have between minCount and maxCount grandchildren (inclusive)
+		//! @param[in] minCount Smallest number of grandchildren
+		//! @param[in] maxCount Largest number of grandchildren
+		//! @param[in/out] nameList A vector containing the names of the matching members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersWithGrandchildCountInRange(uint32_t minCount, uint32_t maxCount, vector<string> & nameList);
+
+        //! @brief Set the typed attributes of a family member
+		//! @param[in] memberName Name of the family member
+		//! @param[in] attributes New attributes of the member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode setMemberAttributes(string const & memberName, member_attributes_t const & attributes);
+
+        //! @brief Retrieves the typed attributes of a family member
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] attributes Attributes of the member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMemberAttributes(string const & memberName, member_attributes_t & attributes);
+
+        //! @brief Retrieves the list of names of the family members who
+		//!		  match every range condition of the filter
+		//!		  (e.g. female members over 60 with 3 or more children)
+		//! @param[in] filter Conditions the members must match
+		//! @param[in/out] nameList A vector containing the names of the matching members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersMatchingFilter(member_filter_t const & filter, vector<string> & nameList);
+
+        //! @brief Retrieves the generation of a family member
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] generation 0 for members without parents, otherwise
+		//!							  1 + the generation of the youngest parent
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMemberGeneration(string const & memberName, uint32_t & generation);
+
+        //! @brief Retrieves the list of names of the family members who match
+		//!		  a predicate.  The predicate is an OR of conjunctions (ANDs) of
+		//!		  range conditions, e.g. (2 <= children <= 5 AND generation == 1)
+		//!		  OR (age >= 60).  An empty conjunction matches every member.
+		//! @param[in] predicate Predicate the members must match
+		//! @param[in/out] nameList A vector containing the names of the matching members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersMatchingPredicate(member_predicate_t const & predicate, vector<string> & nameList);
+
+        //! @brief Retrieves the list of family members who match a predicate
+		//!		  as a member set (see getMembersMatchingPredicate above)
+		//! @param[in] predicate Predicate the members must match
+		//! @param[in/out] members Set of the matching members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersMatchingPredicate(member_predicate_t const & predicate, FamilyTreeMemberSet & members);
+
+        //! @brief Retrieves the member set of a list of family members
+		//! @param[in] nameList Names of the family members
+		//! @param[in/out] members Set of the family members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMemberSet(vector<string> const & nameList, FamilyTreeMemberSet & members);
+
+        //! @brief Retrieves the list of names of the members of a member set
+		//! @param[in] members Set of family members
+		//! @param[in/out] nameList A vector containing the names of the members
+		//!						   in increasing member ID order
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getNameList(FamilyTreeMemberSet const & members, vector<string> & nameList);
+
+		//! @brief Retrieves the set of all members of the family tree
+		//! @param[in/out] members Set of the family members in the family tree
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getFamilyMembersSet(FamilyTreeMemberSet & members);
+
+        //! @brief Retrieves the set of grandparents for the specified family member
+		//! @param[in] memberName Name of the family member whose grandparents to retrieve
+		//! @param[in/out] grandparents Set of the grandparents of the specified member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getGrandparentSet(string const & memberName, FamilyTreeMemberSet & grandparents);
+
+        //! @brief Retrieves the set of children for the specified family member
+		//! @param[in] memberName Name of the family member whose children to retrieve
+		//! @param[in/out] children Set of the children of the specified member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getChildrenSet(string const & memberName, FamilyTreeMemberSet & children);
+
+        //! @brief Retrieves the set of children of any member of a member set
+		//! @param[in] members Set of family members
+		//! @param[in/out] children Set of the children of the members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getChildrenSet(FamilyTreeMemberSet const & members, FamilyTreeMemberSet & children);
+
+        //! @brief Retrieves the set of siblings for the specified family member
+		//! @param[in] memberName Name of the family member whose siblings to retrieve
+		//! @param[in/out] siblings Set of the siblings of the specified member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getSiblingSet(string const & memberName, FamilyTreeMemberSet & siblings);
+
+        //! @brief Retrieves the set of siblings of any member of a member set
+		//! @param[in] members Set of family members
+		//! @param[in/out] siblings Set of the siblings of the members
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getSiblingSet(FamilyTreeMemberSet const & members, FamilyTreeMemberSet & siblings);
+
+        //! @brief Retrieves the set of all descendants (children, grandchildren, ...)
+		//!		  of any member of a set of founders.  A founder is only a
+		//!		  descendant if it descends from another founder.
+		//! @param[in] founders Set of family members to start from
+		//! @param[in/out] descendants Set of the descendants of the founders
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getDescendantSet(FamilyTreeMemberSet const & founders, FamilyTreeMemberSet & descendants);
+
+        //! @brief Retrieves the set of all descendants of any member of a set of
+		//!		  founders (see getDescendantSet above), and how the search
+		//!		  expanded its frontier
+		//! @param[in] founders Set of family members to start from
+		//! @param[in/out] descendants Set of the descendants of the founders
+		//! @param[in/out] stats How the frontier was expanded
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getDescendantSet
+		(
+			FamilyTreeMemberSet const & founders,
+			FamilyTreeMemberSet & descendants,
+			descendant_search_stats_t & stats
+		);
+
+        //! @brief Retrieves the set of all descendants of any of a list of family
+		//!		  members (see getDescendantSet above)
+		//! @param[in] founderNames Names of the family members to start from
+		//! @param[in/out] descendants Set of the descendants of the founders
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getDescendantSet(vector<string> const & founderNames, FamilyTreeMemberSet & descendants);
+
+        //! @brief Retrieves the set of family members reached from a family member
+		//!		  by a relationship path expression, e.g. "parent.sibling" (aunts
+		//!		  and uncles), "parent.sibling.child" (cousins), "parent+"
+		//!		  (ancestors) or "child.child|sibling.child" (grandchildren,
+		//!		  nieces and nephews).  See FamilyTreePathExpression for the
+		//!		  grammar.  The member itself is never part of the result.
+		//! @param[in] memberName Name of the family member to start from
+		//! @param[in] expression Path expression
+		//! @param[in/out] members Set of the family members at the end of a matching path
+		//! @return SUCCESS, INVALID_ARG if the expression is not valid, or error
+		FamilyTreeOpResultCode getMembersByPath
+		(
+			string const & memberName,
+			string const & expression,
+			FamilyTreeMemberSet & members
+		);
+
+        //! @brief Retrieves the members that share at least one parent with a
+		//!		  family member, derived from the family units (one record per
+		//!		  set of parents with its children) rather than from the declared
+		//!		  sibling relationships
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] siblings Set of the full and half siblings of the member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getFamilyUnitSiblingSet(string const & memberName, FamilyTreeMemberSet & siblings);
+
+        //! @brief Retrieves the full and half siblings of a family member,
+		//!		  derived from the family units
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] fullSiblings Set of the members with the same parents
+		//! @param[in/out] halfSiblings Set of the members that share some but
+		//!							   not all of the parents
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getFullAndHalfSiblingSets
+		(
+			string const & memberName,
+			FamilyTreeMemberSet & fullSiblings,
+			FamilyTreeMemberSet & halfSiblings
+		);
+
+        //! @brief Retrieves the children of a family member, derived from the
+		//!		  family units the member is a parent of
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] children Set of the children of the member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getFamilyUnitChildrenSet(string const & memberName, FamilyTreeMemberSet & children);
+
+        //! @brief Retrieves the number of family units and their parent and
+		//!		  child entries
+		//! @param[in/out] stats Size and memory of the family units
+		//! @return SUCCESS
+		FamilyTreeOpResultCode getFamilyUnitStats(family_unit_stats_t & stats);
+
+        //! @brief Checks whether two family members are connected by any
+		//!		  chain of relationships
+		//! @param[in] firstMemberName Name of the first family member
+		//! @param[in] secondMemberName Name of the second family member
+		//! @param[out] sameFamily true if they are in the same family
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode isSameFamily
+		(
+			string const & firstMemberName,
+			string const & secondMemberName,
+			bool & sameFamily
+		);
+
+        //! @brief Retrieves the number of members in the family of a family member
+		//! @param[in] memberName Name of the family member
+		//! @param[out] size Number of members of the family, including the member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getFamilySize(string const & memberName, uint32_t & size);
+
+        //! @brief Retrieves the members of the family of a family member
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] members Set of the members of the family, including the member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getFamilySet(string const & memberName, FamilyTreeMemberSet & members);
+
+        //! @brief Retrieves every family of the tree by decreasing size
+		//! @param[in/out] families One member and the size of each family
+		//! @return SUCCESS
+		FamilyTreeOpResultCode getFamilyList(vector<family_info_t> & families);
+
+        //! @brief Check the structure of the tree in one linear pass over the
+		//!		  relationships, split over the threads: parent->child cycles,
+		//!		  duplicate relationships, declared siblings that contradict the
+		//!		  parent relationships (no common parent, or also a parent or child)
+		//!		  and relationships without an inverse or to a removed member
+		//! @param[out] report Counts of every kind of problem and the first few
+		//!					   descriptions
+		//! @return SUCCESS
+		FamilyTreeOpResultCode validateTree(validation_report_t & report);
+
+        //! @brief Export the family tree, or a member and its descendants, to a
+		//!		  DOT, GraphML or TGF file.  The members and relationships are
+		//!		  written straight from the tree through a fixed size buffer, so
+		//!		  no graph is built in memory.  Parent->child relationships are
+		//!		  "parent" edges and sibling relationships are "sibling" edges
+		//!		  between members that are both exported.  Only a whole tree
+		//!		  export uses constant extra memory.  A subtree export also
+		//!		  keeps one bit per member of the tree (the exported members)
+		//!		  and the member IDs of the exported members.
+		//! @param[in] outputFileName Name of the graph file
+		//! @param[in] format dot, graphml or tgf.  If empty the extension of the
+		//!					  file name is used.
+		//! @param[in] rootName Member whose descendants are exported (the whole
+		//!						tree if empty)
+		//! @param[in] maxDepth Number of generations below the root to export
+		//!						(NO_DEPTH_LIMIT for all of the descendants)
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode exportGraphFile
+		(
+			string const & outputFileName,
+			string const & format = "",
+			string const & rootName = "",
+			uint32_t maxDepth = NO_DEPTH_LIMIT
+		);
+
+        //! @brief Register a materialized view of a relationship path expression
+		//!		  (see getMembersByPath).  The result of the expression is stored
+		//!		  for every member and kept up to date as the tree changes.  A view
+		//!		  with the same name is replaced.
+		//! @param[in] viewName Name of the view
+		//! @param[in] expression Path expression of the view, e.g. "parent.sibling"
+		//! @return SUCCESS, INVALID_ARG if the expression is not valid, or error
+		FamilyTreeOpResultCode registerMaterializedView(string const & viewName, string const & expression);
+
+        //! @brief Remove a materialized view
+		//! @param[in] viewName Name of the view
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode unregisterMaterializedView(string const & viewName);
+
+        //! @brief Retrieves the row of a family member in a materialized view
+		//! @param[in] viewName Name of the view
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] members Set of the family members in the row
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMaterializedViewSet
+		(
+			string const & viewName,
+			string const & memberName,
+			FamilyTreeMemberSet & members
+		);
+
+        //! @brief Retrieves the row of a family member in a materialized view
+		//! @param[in] viewName Name of the view
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] nameList A vector containing the names of the family
+		//!						   members in the row in increasing member ID order
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMaterializedViewNameList
+		(
+			string const & viewName,
+			string const & memberName,
+			vector<string> & nameList
+		);
+
+        //! @brief Retrieves the size and memory used by a materialized view
+		//! @param[in] viewName Name of the view
+		//! @param[in/out] stats Size, memory and state of the view
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMaterializedViewStats(string const & viewName, materialized_view_stats_t & stats);
+
+        //! @brief Retrieves the set of all ancestors (parents, grandparents, ...)
+		//!		  of the specified family member
+		//! @param[in] memberName Name of the family member whose ancestors to retrieve
+		//! @param[in/out] ancestors Set of the ancestors of the specified member
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getAncestorSet(string const & memberName, FamilyTreeMemberSet & ancestors);
+
+        //! @brief Retrieves the set of ancestors that all of a group of family
+		//!		  members share.  A member of the group is not its own ancestor.
+		//! @param[in] memberNames Names of the family members (at least one)
+		//! @param[in/out] commonAncestors Set of the common ancestors
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getCommonAncestorSet(vector<string> const & memberNames, FamilyTreeMemberSet & commonAncestors);
+
+        //! @brief Retrieves the minimal (lowest) common ancestors of a group of
+		//!		  family members: the common ancestors that are not an ancestor
+		//!		  of another common ancestor
+		//! @param[in] memberNames Names of the family members (at least one)
+		//! @param[in/out] minimalAncestors Set of the minimal common ancestors
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMinimalCommonAncestorSet(vector<string> const & memberNames, FamilyTreeMemberSet & minimalAncestors);
+
+        //! @brief Retrieves the common ancestors of many pairs of family members.
+		//!		  The ancestors of every distinct member are found once and the
+		//!		  pairs are split over the threads.
+		//! @param[in] pairs Pairs of family members
+		//! @param[in] minimalOnly true to retrieve only the minimal common ancestors
+		//! @param[in/out] commonAncestors A vector containing the common ancestors of each pair
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getCommonAncestorsForPairs
+		(
+			vector<member_pair_t> const & pairs,
+			bool minimalOnly,
+			vector<FamilyTreeMemberSet> & commonAncestors
+		);
+
+        //! @brief Retrieves the kinship coefficient of two family members: the
+		//!		  probability that alleles taken at random from each are identical
+		//!		  by descent.  Only the first two parents of a member are used.
+		//! @param[in] firstMemberName Name of the first family member
+		//! @param[in] secondMemberName Name of the second family member
+		//! @param[in/out] kinship Kinship coefficient (0.5 for a member and itself
+		//!						   when it is not inbred)
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getKinshipCoefficient
+		(
+			string const & firstMemberName,
+			string const & secondMemberName,
+			double & kinship
+		);
+
+        //! @brief Retrieves the coefficient of relationship of two family members
+		//!		  (0.5 for a parent and child or full siblings)
+		//! @param[in] firstMemberName Name of the first family member
+		//! @param[in] secondMemberName Name of the second family member
+		//! @param[in/out] relationship Coefficient of relationship
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getRelationshipCoefficient
+		(
+			string const & firstMemberName,
+			string const & secondMemberName,
+			double & relationship
+		);
+
+        //! @brief Retrieves the inbreeding coefficient of a family member (the
+		//!		  kinship coefficient of its parents)
+		//! @param[in] memberName Name of the family member
+		//! @param[in/out] inbreeding Inbreeding coefficient
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getInbreedingCoefficient(string const & memberName, double & inbreeding);
+
+        //! @brief Retrieves the kinship coefficients of every pair of a cohort
+		//!		  of family members.  The matrix is computed in tiles that are
+		//!		  split over the threads.
+		//! @param[in] cohortNames Names of the family members of the cohort
+		//! @param[in/out] matrix Kinship of cohortNames[i] and cohortNames[j] at
+		//!						  i * cohortNames.size() + j
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getKinshipMatrix(vector<string> const & cohortNames, vector<double> & matrix);
+
+        //! @brief Retrieves one page of the names that start with a prefix, in
+		//!		  sorted order.  An empty prefix pages through every member.
+		//! @param[in] prefix Prefix of the names
+		//! @param[in] offset Number of matching names to skip
+		//! @param[in] maxCount Largest number of names to return
+		//! @param[in/out] nameList A vector containing the names of the page
+		//! @param[in/out] numberOfMatches Number of names that start with prefix
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersWithNamePrefix
+		(
+			string const & prefix,
+			uint32_t offset,
+			uint32_t maxCount,
+			vector<string> & nameList,
+			uint32_t & numberOfMatches
+		);
+
+        //! @brief Retrieves one page of the names between firstName and
+		//!		  lastName (inclusive), in sorted order
+		//! @param[in] firstName Smallest name of the range
+		//! @param[in] lastName Largest name of the range
+		//! @param[in] offset Number of names in the range to skip
+		//! @param[in] maxCount Largest number of names to return
+		//! @param[in/out] nameList A vector containing the names of the page
+		//! @param[in/out] numberOfMatches Number of names in the range
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getMembersInNameRange
+		(
+			string const & firstName,
+			string const & lastName,
+			uint32_t offset,
+			uint32_t maxCount,
+			vector<string> & nameList,
+			uint32_t & numberOfMatches
+		);
+
+        //! @brief Retrieves the member names closest to a name (for "did you mean"
+		//!		  suggestions).  Names are ranked by edit distance ignoring case,
+		//!		  then by name.  Candidates are first pruned by the number of
+		//!		  trigrams they share with the name.
+		//! @param[in] name Name to look up
+		//! @param[in] maxCount Largest number of names to return
+		//! @param[in] maxDistance Largest edit distance of a returned name
+		//! @param[in/out] nameList A vector containing the closest names
+		//! @param[in/out] distances A vector containing the edit distance of each name
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getClosestMemberNames
+		(
+			string const & name,
+			uint32_t maxCount,
+			uint32_t maxDistance,
+			vector<string> & nameList,
+			vector<uint32_t> & distances
+		);
+
+        //! @brief Enable (or disable) the cache of grandparent, children and
+		//!		  sibling name list results.  Cached results are dropped
+		//!		  whenever the tree changes.
+		//! @param[in] capacity Largest number of cached results (0 disables the cache)
+		//! @param[in] numberOfShards Number of independently locked LRU shards
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode enableResultCache(uint32_t capacity, uint32_t numberOfShards);
+
+        //! @brief Retrieves the hit and miss counters of the result cache
+		//! @param[in/out] stats Counters of the result cache
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode getResultCacheStats(result_cache_stats_t & stats);
+
+        //! @brief Set the hit and miss counters of the result cache to 0
+		//! @return SUCCESS or error
+		FamilyTreeOpResultCode resetResultCacheStats();
+
 };
 
 } /* namespace FamilyTree */
@@ -0,0 +1,111 @@
+/**
+ *  @file    FamilyTreeConnectedFamilies.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeConnectedFamilies object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeConnectedFamilies class.
+ *
+ *  FamilyTreeConnectedFamilies groups the family members into
+ *  families: the sets of members connected by relationships of
+ *  any kind.  It is a union-find (disjoint set) structure with
+ *  path compression and union by rank, so adding a relationship
+ *  and testing whether two members are in the same family take
+ *  almost constant amortized time.
+ *
+ *  The members of each family are also linked into a circular
+ *  list.  Joining two families splices their lists together, so
+ *  the members of a family are enumerated in time proportional
+ *  to its size.
+ *
+ *  Families cannot be split, so the owner rebuilds them after
+ *  a relationship or member is removed.
+ *
+ */
+
+#ifndef FAMILYTREECONNECTEDFAMILIES_H_
+#define FAMILYTREECONNECTEDFAMILIES_H_
+
+#include <stdint.h>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeConnectedFamilies {
+	// Constants and enums
+	public:
+		//! @brief Parent of a member ID that is not in use
+		static const uint32_t NO_MEMBER = UINT32_MAX;
+
+	// Member variables
+	private:
+		// Parent of each member in its tree (itself for the root
+		// of a family) and the rank of each root
+		std::vector<uint32_t> m_Parents;
+		std::vector<uint8_t> m_Ranks;
+
+		// Number of members of each family, indexed by its root
+		std::vector<uint32_t> m_Sizes;
+
+		// Next member of the same family (circular list)
+		std::vector<uint32_t> m_Next;
+
+		uint32_t m_NumberOfFamilies;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty structure.
+		FamilyTreeConnectedFamilies();
+
+		//! @brief Destructor
+		~FamilyTreeConnectedFamilies();
+
+	// Member functions
+	public:
+		//! @brief Remove all members
+		void clear();
+
+		//! @brief Add a member in a family of its own
+		//! @param[in] memberId ID of the member (not already in use)
+		void addMember(uint32_t memberId);
+
+		//! @brief Returns true if a member ID is in use
+		bool contains(uint32_t memberId) const { return memberId < m_Parents.size() && m_Parents[memberId] != NO_MEMBER; }
+
+		//! @brief Retrieves the root of the family of a member.  The path
+		//!		  to the root is compressed.
+		//! @param[in] memberId ID of a member in use
+		uint32_t find(uint32_t memberId);
+
+		//! @brief Join the families of two members
+		//! @return true if they were in different families
+		bool unite(uint32_t firstId, uint32_t secondId);
+
+		//! @brief Returns true if two members are in the same family
+		bool isSameFamily(uint32_t firstId, uint32_t secondId) { return find(firstId) == find(secondId); }
+
+		//! @brief Retrieves the number of members in the family of a member
+		uint32_t getFamilySize(uint32_t memberId) { return m_Sizes[find(memberId)]; }
+
+		//! @brief Retrieves the members of the family of a member
+		//! @param[in] memberId ID of a member in use
+		//! @param[out] memberIds IDs of the members of the family, starting
+		//!						  with memberId
+		void getFamilyMembers(uint32_t memberId, std::vector<uint32_t> & memberIds) const;
+
+		//! @brief Retrieves the number of families
+		uint32_t getNumberOfFamilies() const { return m_NumberOfFamilies; }
+
+		//! @brief Retrieves the root and size of every family
+		//! @param[out] roots Root member ID of each family
+		//! @param[out] sizes Number of members of each family
+		void getFamilies(std::vector<uint32_t> & roots, std::vector<uint32_t> & sizes) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREECONNECTEDFAMILIES_H_ */
@@ -0,0 +1,107 @@
+/**
+ *  @file    FamilyTreeCountIndex.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeCountIndex object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeCountIndex class.
+ *
+ *  FamilyTreeCountIndex stores a derived count (number of
+ *  children, siblings, grandchildren...) for every family
+ *  member, indexed by member ID.  Members are also kept in
+ *  buckets by count so that the members with a given count
+ *  can be retrieved without looking at every member.
+ *
+ *  Every update is O(1): a member is moved between buckets
+ *  by swapping it with the last member of its old bucket.
+ *
+ */
+
+#ifndef FAMILYTREECOUNTINDEX_H_
+#define FAMILYTREECOUNTINDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeCountIndex {
+	// Member variables
+	private:
+		// Count of each member indexed by member ID
+		std::vector<uint32_t> m_Counts;
+
+		// Whether the member ID is in use
+		std::vector<bool> m_InUse;
+
+		// Member IDs grouped by count
+		std::vector< std::vector<uint32_t> > m_Buckets;
+
+		// Position of each member within its bucket
+		std::vector<uint32_t> m_BucketPositions;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor
+		FamilyTreeCountIndex();
+
+		//! @brief Destructor
+		~FamilyTreeCountIndex();
+
+	// Member functions
+	private:
+		//! @brief Remove a member from the bucket of its current count
+		//! @param[in] memberId ID of the member
+		void removeFromBucket(uint32_t memberId);
+
+		//! @brief Add a member to the bucket of its current count
+		//! @param[in] memberId ID of the member
+		void addToBucket(uint32_t memberId);
+
+	public:
+		//! @brief Remove all members from the index
+		void clear();
+
+		//! @brief Add a member with a count of 0
+		//! @param[in] memberId ID of the member
+		void addMember(uint32_t memberId);
+
+		//! @brief Remove a member from the index
+		//! @param[in] memberId ID of the member
+		void removeMember(uint32_t memberId);
+
+		//! @brief Add delta to the count of a member
+		//! @param[in] memberId ID of the member
+		//! @param[in] delta Amount to add (may be negative)
+		void adjustCount(uint32_t memberId, int64_t delta);
+
+		//! @brief Retrieves the count of a member
+		//! @param[in] memberId ID of the member
+		//! @return Count of the member
+		uint32_t getCount(uint32_t memberId) const { return m_Counts[memberId]; }
+
+		//! @brief Retrieves the count column indexed by member ID
+		//! @return Pointer to the counts or NULL if there are no members
+		const uint32_t * getCounts() const { return m_Counts.empty() ? NULL : &m_Counts[0]; }
+
+		//! @brief Retrieves the number of entries in the count column
+		uint32_t getSize() const { return m_Counts.size(); }
+
+		//! @brief Retrieves the largest count of any member
+		//! @return Largest count or 0 if there are no members
+		uint32_t getMaxCount() const;
+
+		//! @brief Retrieves the IDs of the members that have the specified count
+		//! @param[in] count Specified count
+		//! @return Member IDs with that count (in no particular order)
+		const std::vector<uint32_t> & getMembersWithCount(uint32_t count) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREECOUNTINDEX_H_ */
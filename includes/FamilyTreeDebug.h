@@ -49,25 +49,29 @@
 #define LOG_LEVEL_DEBUG		(LOG_FATAL | LOG_ERROR | LOG_WARN | LOG_INFO | LOG_DEBUG)
 #define LOG_ALL             (LOG_FATAL | LOG_ERROR | LOG_WARN | LOG_INFO | LOG_DEBUG | LOG_ENTRY)
 
+// LOG_MASK can be overridden at compile time
+// (e.g. -DLOG_MASK=LOG_LEVEL_ERROR for benchmarks)
+#ifndef LOG_MASK
 #define LOG_MASK            LOG_LEVEL_DEBUG
+#endif
 
-// Note: The Logging MACROS need to be refined so
-// that they completely disable all logging
-// When the log level is not set in the LOG_MASK
-// For now it is better to use LOG_LEVEL_DEBUG or
-// LOG_LEVEL_ALL.
+// The whole message (prefix, body and newline) is
+// skipped when the log level is not set in the LOG_MASK,
+// so disabled log calls do not format any output.  Each
+// macro is a single expression, so a call is written like
+// a function call and ends with a semicolon.
 
 #ifdef __cplusplus  // C++ Debug Macros
 
-#define FamilyTreeLogMsg(level, ...) ((level & LOG_MASK) == 0) ? 0 : printf("%s (%d): ", __METHOD_NAME__, __LINE__); printf(__VA_ARGS__); printf("\n");
-#define FamilyTreeErrorMsg(level, ...) ((level & LOG_MASK) == 0) ? 0 : printf("Error - %s (%d): ", __METHOD_NAME__, __LINE__); printf(__VA_ARGS__); printf("\n");
+#define FamilyTreeLogMsg(level, ...) ((((level) & LOG_MASK) == 0) ? 0 : (printf("%s (%d): ", __METHOD_NAME__, __LINE__), printf(__VA_ARGS__), printf("\n")))
+#define FamilyTreeErrorMsg(level, ...) ((((level) & LOG_MASK) == 0) ? 0 : (printf("Error - %s (%d): ", __METHOD_NAME__, __LINE__), printf(__VA_ARGS__), printf("\n")))
 
-#define FamilyTreeLogMsgMain(level, ...) ((level & LOG_MASK) == 0) ? 0 : printf("%s (%d): ", __func__, __LINE__); printf(__VA_ARGS__); printf("\n");
-#define FamilyTreeErrorMsgMain(level, ...) ((level & LOG_MASK) == 0) ? 0 : printf("Error - %s (%d): ", __func__, __LINE__); printf(__VA_ARGS__); printf("\n");
+#define FamilyTreeLogMsgMain(level, ...) ((((level) & LOG_MASK) == 0) ? 0 : (printf("%s (%d): ", __func__, __LINE__), printf(__VA_ARGS__), printf("\n")))
+#define FamilyTreeErrorMsgMain(level, ...) ((((level) & LOG_MASK) == 0) ? 0 : (printf("Error - %s (%d): ", __func__, __LINE__), printf(__VA_ARGS__), printf("\n")))
 
 #else               // C Debug Macros
-#define FamilyTreeLogMsg(level, ...) ((level & LOG_MASK) == 0) ? 0 : printf("%s (%d): ", __func__, __LINE__); printf(__VA_ARGS__); printf("\n");
-#define FamilyTreeErrorMsg(level, ...) ((level & LOG_MASK) == 0) ? 0 : printf("Error - %s (%d): ", __func__, __LINE__); printf(__VA_ARGS__); printf("\n");
+#define FamilyTreeLogMsg(level, ...) ((((level) & LOG_MASK) == 0) ? 0 : (printf("%s (%d): ", __func__, __LINE__), printf(__VA_ARGS__), printf("\n")))
+#define FamilyTreeErrorMsg(level, ...) ((((level) & LOG_MASK) == 0) ? 0 : (printf("Error - %s (%d): ", __func__, __LINE__), printf(__VA_ARGS__), printf("\n")))
 #endif
 
 #endif  // DEBUG
@@ -116,6 +120,7 @@ static char * familyTreeDebugGenderToCStr(FamilyMemberClass::gender_t gender) {
         case FamilyMemberClass::Male:		return TO_C_STR(Male);
         case FamilyMemberClass::Female: 	return TO_C_STR(Female);
         case FamilyMemberClass::Other:   	return TO_C_STR(Other);
+        case FamilyMemberClass::Unknown:   	return TO_C_STR(Unknown);
         default:        return TO_C_STR(Unknown);
     }
 }
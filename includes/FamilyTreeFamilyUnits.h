@@ -0,0 +1,197 @@
+/**
+ *  @file    FamilyTreeFamilyUnits.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeFamilyUnits object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeFamilyUnits class.
+ *
+ *  A family unit is one record per distinct set of parents
+ *  with the list of the children that have exactly those
+ *  parents.  A family of k children with two parents is one
+ *  unit of 2 parent and k child entries instead of 4k
+ *  parent/child relationships and k(k - 1) sibling
+ *  relationships.
+ *
+ *  The parents of each unit are kept in increasing member ID
+ *  order and its children in increasing member ID order.  Each
+ *  member has the unit it is a child of and the list of units
+ *  it is a parent of.
+ *
+ *  Children, parents, full siblings (the other children of
+ *  the unit) and half siblings (the children of the other units
+ *  of the parents) are all derived from the units.  Two units
+ *  may share more than one parent, so a unit reached through
+ *  one parent is only counted for the first parent of the sorted
+ *  intersection of the two parent sets.
+ *
+ *  The units are an index next to the parent/child relationships
+ *  of the members, which stay the source of truth.  They are kept
+ *  up to date one parent at a time.  Adding or removing a parent
+ *  of a member moves the member to the unit of its new parent
+ *  set, and only the full and half sibling counts of the members
+ *  of the two units and of the units that share a parent with
+ *  them change.  A unit that loses its last child is freed and
+ *  its slot is reused, so unit numbers are not dense.
+ *
+ */
+
+#ifndef FAMILYTREEFAMILYUNITS_H_
+#define FAMILYTREEFAMILYUNITS_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include "FamilyTreeCountIndex.h"
+
+namespace FamilyTree {
+
+class FamilyTreeFamilyUnits {
+	// Constants and enums
+	public:
+		//! @brief Unit of a member without parents
+		static const uint32_t NO_UNIT = UINT32_MAX;
+
+		//! @brief Size of the units
+		typedef struct {
+			uint32_t units;			//!< Number of family units
+			uint64_t parentEntries;	//!< Parent entries of all of the units
+			uint64_t childEntries;	//!< Child entries of all of the units
+			uint64_t memoryBytes;	//!< Approximate memory used by the units
+		} unit_stats_t;
+
+	private:
+		// Parents and children of a unit.  A unit without
+		// children is free.
+		typedef struct {
+			std::vector<uint32_t> parents;
+			std::vector<uint32_t> children;
+		} unit_t;
+
+	// Member variables
+	private:
+		// Units indexed by unit and the free units
+		std::vector<unit_t> m_Units;
+		std::vector<uint32_t> m_FreeUnits;
+
+		// Unit each member is a child of (NO_UNIT if none)
+		std::vector<uint32_t> m_ChildUnit;
+
+		// Units each member is a parent of
+		std::vector< std::vector<uint32_t> > m_ParentUnits;
+
+		// Number of full and half siblings of each member
+		FamilyTreeCountIndex m_FullSiblingCounts;
+		FamilyTreeCountIndex m_HalfSiblingCounts;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates empty units.
+		FamilyTreeFamilyUnits();
+
+		//! @brief Destructor
+		~FamilyTreeFamilyUnits();
+
+	// Member functions
+	private:
+		//! @brief Returns true if the first common parent of two units is parentId
+		//!		  (merge of the two sorted parent arrays)
+		bool isFirstCommonParent(uint32_t unit, uint32_t otherUnit, uint32_t parentId) const;
+
+		//! @brief Retrieves the other units that share at least one parent with a unit
+		//! @param[in] unit Unit
+		//! @param[out] units Each of the other units once
+		void getHalfSiblingUnits(uint32_t unit, std::vector<uint32_t> & units) const;
+
+		//! @brief Adjust the sibling counts of the members of a unit and of the
+		//!		  units that share a parent with it for a change in its size
+		//! @param[in] unit Unit whose number of children changes
+		//! @param[in] delta Change in the number of children
+		void adjustSiblingCounts(uint32_t unit, int64_t delta);
+
+		//! @brief Retrieves the unit of a set of parents, adding it if there is none
+		//! @param[in] parentIds Parent IDs in increasing member ID order
+		uint32_t findOrAddUnit(std::vector<uint32_t> const & parentIds);
+
+		//! @brief Free a unit that has no children
+		void freeUnit(uint32_t unit);
+
+		//! @brief Move a member to the unit of a set of parents
+		//! @param[in] memberId ID of the member
+		//! @param[in] parentIds New parent IDs in increasing member ID order
+		void setParents(uint32_t memberId, std::vector<uint32_t> const & parentIds);
+
+	public:
+		//! @brief Remove all of the units and members
+		void clear();
+
+		//! @brief Add a member without parents or children
+		void addMember(uint32_t memberId);
+
+		//! @brief Remove a member.  Its parents and children must have been
+		//!		  removed first.
+		void removeMember(uint32_t memberId);
+
+		//! @brief Add a parent to a member
+		//! @param[in] childId ID of the child
+		//! @param[in] parentId ID of the parent
+		void addParent(uint32_t childId, uint32_t parentId);
+
+		//! @brief Remove a parent of a member
+		//! @param[in] childId ID of the child
+		//! @param[in] parentId ID of the parent
+		void removeParent(uint32_t childId, uint32_t parentId);
+
+		//! @brief Retrieves the number of units
+		uint32_t getNumberOfUnits() const { return m_Units.size() - m_FreeUnits.size(); }
+
+		//! @brief Retrieves the unit a member is a child of (NO_UNIT if none)
+		uint32_t getChildUnit(uint32_t memberId) const { return memberId < m_ChildUnit.size() ? m_ChildUnit[memberId] : NO_UNIT; }
+
+		//! @brief Iterators over the parents of a unit
+		const uint32_t * beginParents(uint32_t unit) const { return m_Units[unit].parents.data(); }
+		const uint32_t * endParents(uint32_t unit) const { return m_Units[unit].parents.data() + m_Units[unit].parents.size(); }
+
+		//! @brief Iterators over the children of a unit
+		const uint32_t * beginChildren(uint32_t unit) const { return m_Units[unit].children.data(); }
+		const uint32_t * endChildren(uint32_t unit) const { return m_Units[unit].children.data() + m_Units[unit].children.size(); }
+
+		//! @brief Iterators over the units a member is a parent of
+		const uint32_t * beginParentUnits(uint32_t memberId) const;
+		const uint32_t * endParentUnits(uint32_t memberId) const;
+
+		//! @brief Retrieves the full sibling counts of the members
+		FamilyTreeCountIndex const & getFullSiblingCounts() const { return m_FullSiblingCounts; }
+
+		//! @brief Retrieves the half sibling counts of the members
+		FamilyTreeCountIndex const & getHalfSiblingCounts() const { return m_HalfSiblingCounts; }
+
+		//! @brief Retrieves the children of a member
+		//! @param[in] memberId ID of the member
+		//! @param[out] memberIds Children in increasing member ID order
+		void getChildren(uint32_t memberId, std::vector<uint32_t> & memberIds) const;
+
+		//! @brief Retrieves the members that share at least one parent with a member
+		//! @param[in] memberId ID of the member
+		//! @param[out] memberIds Siblings in increasing member ID order
+		void getSiblings(uint32_t memberId, std::vector<uint32_t> & memberIds) const;
+
+		//! @brief Retrieves the full and half siblings of a member
+		//! @param[in] memberId ID of the member
+		//! @param[out] fullSiblings Members with the same parents in increasing
+		//!							 member ID order
+		//! @param[out] halfSiblings Members that share some but not all of the
+		//!							 parents in increasing member ID order
+		void getSiblings(uint32_t memberId, std::vector<uint32_t> & fullSiblings, std::vector<uint32_t> & halfSiblings) const;
+
+		//! @brief Retrieves the size of the units
+		void getStats(unit_stats_t & stats) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEFAMILYUNITS_H_ */
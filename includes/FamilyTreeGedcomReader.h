@@ -0,0 +1,136 @@
+/**
+ *  @file    FamilyTreeGedcomReader.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeGedcomReader object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeGedcomReader class.
+ *
+ *  A FamilyTreeGedcomReader reads the individual (INDI) and
+ *  family (FAM) records of a GEDCOM file one record at a time.
+ *  Every GEDCOM line is
+ *
+ *    level [@xref@] tag [value]
+ *
+ *  and a record is a level 0 line with the lines that follow
+ *  it up to the next level 0 line.  Only the current record and
+ *  one line of lookahead are kept in memory, so files of any
+ *  size are read in a single pass through a large stream buffer.
+ *
+ *  From an individual the reader keeps the cross reference, the
+ *  first NAME (with the slashes around the surname removed), SEX
+ *  and the year of the BIRT DATE.  From a family it keeps the
+ *  HUSB and WIFE (parents) and CHIL (children) cross references.
+ *  Every other record and tag is skipped.
+ *
+ */
+
+#ifndef FAMILYTREEGEDCOMREADER_H_
+#define FAMILYTREEGEDCOMREADER_H_
+
+#include <stdint.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeGedcomReader {
+	// Constants and enums
+	public:
+		//! @brief Size of the stream buffer
+		static const uint32_t BUFFER_SIZE = 1 << 20;
+
+		//! @brief Birth year of an individual without one
+		static const int32_t NO_BIRTH_YEAR = INT32_MIN;
+
+		//! @brief Kind of record
+		typedef enum {
+			Record_Individual,
+			Record_Family
+		} record_type_t;
+
+		//! @brief An INDI or FAM record
+		typedef struct {
+			record_type_t type;
+			std::string xref;						//!< Cross reference without the @ signs
+			std::string name;						//!< Individual: given names and surname
+			char sex;								//!< Individual: first letter of SEX, 0 if none
+			int32_t birthYear;						//!< Individual: year of the BIRT DATE or NO_BIRTH_YEAR
+			std::vector<std::string> parents;		//!< Family: HUSB and WIFE cross references
+			std::vector<std::string> children;		//!< Family: CHIL cross references
+		} record_t;
+
+	// Member variables
+	private:
+		std::ifstream m_File;
+		std::vector<char> m_Buffer;
+
+		// Level 0 line of the next record (read ahead while
+		// looking for the end of the current one)
+		std::string m_NextLine;
+		bool m_HasNextLine;
+
+		uint64_t m_LineNumber;
+		bool m_Failed;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor
+		FamilyTreeGedcomReader();
+
+		//! @brief Destructor
+		~FamilyTreeGedcomReader();
+
+	// Member functions
+	private:
+		//! @brief Read the next non-empty line
+		//! @return false at the end of the file
+		bool readLine(std::string & line);
+
+		//! @brief Split a line into its level, cross reference, tag and value
+		//! @return false if the line is not a GEDCOM line
+		static bool parseLine
+		(
+			std::string const & line,
+			uint32_t & level,
+			std::string & xref,
+			std::string & tag,
+			std::string & value
+		);
+
+		//! @brief Remove the @ signs around a cross reference
+		static std::string stripXref(std::string const & value);
+
+		//! @brief Retrieves the year of a GEDCOM date (the first number of
+		//!		  three or four digits) or NO_BIRTH_YEAR
+		static int32_t parseYear(std::string const & date);
+
+	public:
+		//! @brief Open a GEDCOM file
+		//! @return false if the file could not be opened
+		bool open(std::string const & fileName);
+
+		//! @brief Close the file
+		void close();
+
+		//! @brief Read the next INDI or FAM record
+		//! @param[out] record The record
+		//! @return false at the end of the file (or the TRLR record) or if a
+		//!			line is not formatted correctly (see failed)
+		bool readRecord(record_t & record);
+
+		//! @brief Returns true if reading stopped at a line that is not formatted correctly
+		bool failed() const { return m_Failed; }
+
+		//! @brief Retrieves the number of the last line read
+		uint64_t getLineNumber() const { return m_LineNumber; }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEGEDCOMREADER_H_ */
@@ -0,0 +1,126 @@
+/**
+ *  @file    FamilyTreeGraphWriter.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeGraphWriter object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeGraphWriter class.
+ *
+ *  A FamilyTreeGraphWriter writes family members and their
+ *  relationships to a DOT, GraphML or TGF file as they are
+ *  passed in, without building a graph in memory.  The output
+ *  is formatted into a fixed size buffer that is written to the
+ *  file whenever it fills up, so the memory used does not depend
+ *  on the size of the tree.
+ *
+ *  Members are written as vertices identified by their member
+ *  ID and labeled with their name.  Parent->child relationships
+ *  are directed edges labeled "parent" and sibling relationships
+ *  are undirected edges labeled "sibling", which is how the
+ *  graph file import of FamilyTreeClass reads them back.  TGF
+ *  lists every vertex before the first edge, so all of the
+ *  members must be written before the relationships.
+ *
+ */
+
+#ifndef FAMILYTREEGRAPHWRITER_H_
+#define FAMILYTREEGRAPHWRITER_H_
+
+#include <stdint.h>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeGraphWriter {
+	// Constants and enums
+	public:
+		//! @brief Size of the output buffer
+		static const uint32_t BUFFER_SIZE = 1 << 20;
+
+		//! @brief Output formats
+		typedef enum {
+			Format_Dot,
+			Format_GraphML,
+			Format_Tgf
+		} format_t;
+
+	// Member variables
+	private:
+		std::ofstream m_File;
+		std::vector<char> m_Buffer;
+		uint32_t m_Used;
+
+		format_t m_Format;
+
+		// TGF: the separator between the vertices and the
+		// edges has been written
+		bool m_WritingEdges;
+
+		uint64_t m_BytesWritten;
+		bool m_Failed;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor
+		FamilyTreeGraphWriter();
+
+		//! @brief Destructor.  Closes the file if it is still open.
+		~FamilyTreeGraphWriter();
+
+	// Member functions
+	private:
+		//! @brief Write the buffer to the file
+		void flush();
+
+		//! @brief Append characters to the buffer
+		void write(const char * pText, uint32_t length);
+
+		//! @brief Append a null terminated string to the buffer
+		void write(const char * pText);
+
+		//! @brief Append the decimal digits of a number to the buffer
+		void writeNumber(uint32_t value);
+
+		//! @brief Append a name to the buffer, escaped for the format
+		void writeEscaped(const char * pName, uint32_t nameLength);
+
+	public:
+		//! @brief Retrieves the format named by a format name or file extension
+		//!		  (dot, gv, graphml or tgf, any case)
+		//! @return false if there is no such format
+		static bool getFormat(std::string const & name, format_t & format);
+
+		//! @brief Create (or truncate) a file and write the start of the graph
+		//! @return false if the file could not be opened
+		bool open(std::string const & fileName, format_t format);
+
+		//! @brief Write the end of the graph and close the file
+		//! @return false if any of the output could not be written
+		bool close();
+
+		//! @brief Write a family member
+		//! @param[in] memberId ID of the member
+		//! @param[in] pName Name of the member (not null terminated)
+		//! @param[in] nameLength Length of the name
+		void writeMember(uint32_t memberId, const char * pName, uint32_t nameLength);
+
+		//! @brief Write a relationship
+		//! @param[in] fromId ID of the parent (or of one of the siblings)
+		//! @param[in] toId ID of the child (or of the other sibling)
+		//! @param[in] sibling true for a sibling relationship, false for a
+		//!					   parent->child relationship
+		void writeRelationship(uint32_t fromId, uint32_t toId, bool sibling);
+
+		//! @brief Retrieves the number of bytes of output so far
+		uint64_t getBytesWritten() const { return m_BytesWritten; }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEGRAPHWRITER_H_ */
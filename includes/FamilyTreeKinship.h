@@ -0,0 +1,120 @@
+/**
+ *  @file    FamilyTreeKinship.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeKinship object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeKinship class.
+ *
+ *  FamilyTreeKinship computes kinship coefficients with the
+ *  standard recursive method.  The kinship phi(a, b) is the
+ *  probability that an allele taken at random from a and one
+ *  taken at random from b are identical by descent:
+ *
+ *    phi(a, a) = (1 + phi(father, mother)) / 2
+ *    phi(a, b) = (phi(father, b) + phi(mother, b)) / 2
+ *
+ *  where a is not an ancestor of b (a is from the same or a
+ *  later generation than b).  An unknown parent is an unrelated
+ *  founder, so it adds 0.  The inbreeding coefficient of a member
+ *  is the kinship of its parents and the coefficient of
+ *  relationship is 2 phi(a, b) / sqrt((1 + F(a)) (1 + F(b))).
+ *
+ *  The recursion is evaluated with an explicit stack, so deep
+ *  trees do not overflow the call stack, and every pair is
+ *  memoized.  A kinship matrix is split into square tiles of the
+ *  upper triangle.  Each thread computes a contiguous run of
+ *  tiles with its own memo table, so the rows and columns of a
+ *  tile share the ancestor pairs computed for the tile before.
+ *
+ *  Only the first two parents of a member are used.
+ *
+ */
+
+#ifndef FAMILYTREEKINSHIP_H_
+#define FAMILYTREEKINSHIP_H_
+
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeKinship {
+	// Constants and enums
+	public:
+		//! @brief Parent ID of a member with fewer than two parents
+		static const uint32_t NO_PARENT = UINT32_MAX;
+
+		//! @brief Number of rows and columns of a kinship matrix tile
+		static const uint32_t TILE_SIZE = 64;
+
+		//! @brief Number of memoized pairs above which a memo table is emptied
+		//!		  before the next coefficient is computed
+		static const uint32_t MAX_MEMO_ENTRIES = 1 << 22;
+
+	// Member variables
+	private:
+		// Kinship of memoized pairs.  The key is (smaller ID << 32) | larger ID.
+		typedef std::unordered_map<uint64_t, double> memo_t;
+
+		// First and second parent of each member ID (NO_PARENT if unknown)
+		std::vector<uint32_t> m_Parents;
+
+		// Generation of each member ID.  A parent has a
+		// smaller generation than all of its children.
+		std::vector<uint32_t> m_Generations;
+
+		// Memo table of getKinship and getInbreeding
+		memo_t m_Memo;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty engine.
+		FamilyTreeKinship();
+
+		//! @brief Destructor
+		~FamilyTreeKinship();
+
+	// Member functions
+	private:
+		//! @brief Compute the kinship of a pair with the memo table of the caller
+		double computeKinship(uint32_t a, uint32_t b, memo_t & memo) const;
+
+	public:
+		//! @brief Build the engine.  The previous memo table is dropped.
+		//! @param[in] parents First and second parent of each member ID
+		//!					   (2 entries per member, NO_PARENT if unknown)
+		//! @param[in] generations Generation of each member ID
+		void build(std::vector<uint32_t> const & parents, std::vector<uint32_t> const & generations);
+
+		//! @brief Remove every member
+		void clear();
+
+		//! @brief Retrieves the kinship coefficient of two members
+		double getKinship(uint32_t a, uint32_t b);
+
+		//! @brief Retrieves the inbreeding coefficient of a member
+		double getInbreeding(uint32_t memberId);
+
+		//! @brief Retrieves the coefficient of relationship of two members
+		double getRelationship(uint32_t a, uint32_t b);
+
+		//! @brief Fill the kinship matrix of a cohort.  The tiles are split over
+		//!		  the threads of FamilyTreeParallel.
+		//! @param[in] memberIds Member IDs of the cohort
+		//! @param[out] matrix Kinship of memberIds[i] and memberIds[j] at
+		//!					   i * memberIds.size() + j
+		void getKinshipMatrix(std::vector<uint32_t> const & memberIds, std::vector<double> & matrix) const;
+
+		//! @brief Retrieves the number of memoized pairs
+		uint32_t getMemoSize() const { return m_Memo.size(); }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEKINSHIP_H_ */
@@ -0,0 +1,139 @@
+/**
+ *  @file    FamilyTreeMaterializedView.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeMaterializedView object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeMaterializedView class.
+ *
+ *  A FamilyTreeMaterializedView stores the result of a
+ *  relationship path expression (see FamilyTreePathExpression)
+ *  for every member, so that a derived relationship such as
+ *  "parent.sibling" (aunts and uncles) is a lookup instead of a
+ *  traversal.  The rows are stored in CSR layout: the row of
+ *  member i is m_MemberIds[m_Offsets[i] .. m_Offsets[i + 1]).
+ *
+ *  When the tree changes, the owner marks the rows that may have
+ *  changed as dirty.  A dirty row is recomputed when it is next
+ *  read and kept in an overlay until the overlay is merged back
+ *  into the CSR arrays.  If too many rows are dirty the whole
+ *  view is marked stale and rebuilt instead.
+ *
+ */
+
+#ifndef FAMILYTREEMATERIALIZEDVIEW_H_
+#define FAMILYTREEMATERIALIZEDVIEW_H_
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "FamilyTreePathExpression.h"
+
+namespace FamilyTree {
+
+class FamilyTreeMaterializedView {
+	// Constants and enums
+	public:
+		//! @brief The overlay is merged into the CSR arrays when it has
+		//!		  more than 1/OVERLAY_DIVISOR of the rows
+		static const uint32_t OVERLAY_DIVISOR = 8;
+
+		//! @brief The view is marked stale when more than 1/DIRTY_DIVISOR
+		//!		  of the rows are dirty
+		static const uint32_t DIRTY_DIVISOR = 8;
+
+		//! @brief Size and state of a view
+		typedef struct {
+			uint32_t rows;			//!< Rows in the CSR arrays
+			uint64_t entries;		//!< Member IDs in the CSR arrays and the overlay
+			uint32_t overlayRows;	//!< Rows recomputed since the CSR arrays were built
+			uint32_t dirtyRows;		//!< Rows that must be recomputed before they are read
+			uint64_t memoryBytes;	//!< Approximate memory used by the view
+			bool stale;				//!< The whole view must be rebuilt
+		} view_stats_t;
+
+	// Member variables
+	private:
+		// Expression of the view and its automaton
+		std::string m_Expression;
+		FamilyTreePathExpression m_Automaton;
+
+		// Rows in CSR layout
+		std::vector<uint32_t> m_Offsets;
+		std::vector<uint32_t> m_MemberIds;
+
+		// Rows recomputed since the CSR arrays were built
+		std::unordered_map<uint32_t, std::vector<uint32_t> > m_Overlay;
+
+		// Dirty flag of each member ID
+		std::vector<bool> m_Dirty;
+		uint32_t m_NumberOfDirtyRows;
+
+		bool m_Stale;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates a stale view without an expression.
+		FamilyTreeMaterializedView();
+
+		//! @brief Destructor
+		~FamilyTreeMaterializedView();
+
+	// Member functions
+	public:
+		//! @brief Compile the expression of the view.  The view is marked stale.
+		//! @return true if the expression is valid
+		bool compile(std::string const & expression);
+
+		//! @brief Retrieves the expression of the view
+		std::string const & getExpression() const { return m_Expression; }
+
+		//! @brief Retrieves the automaton of the expression
+		FamilyTreePathExpression const & getAutomaton() const { return m_Automaton; }
+
+		//! @brief Replace every row.  The arrays are swapped into the view,
+		//!		  and the overlay and dirty flags are dropped.
+		//! @param[in/out] offsets Start of each row in memberIds, plus the end
+		//! @param[in/out] memberIds Member IDs of all of the rows
+		void assign(std::vector<uint32_t> & offsets, std::vector<uint32_t> & memberIds);
+
+		//! @brief Returns true if the whole view must be rebuilt
+		bool isStale() const { return m_Stale; }
+
+		//! @brief Mark the whole view for rebuilding
+		void markStale();
+
+		//! @brief Mark the row of a member for recomputing.  The view is
+		//!		  marked stale instead if too many rows are dirty.
+		void markDirty(uint32_t memberId);
+
+		//! @brief Returns true if the row of a member must be recomputed
+		bool isDirty(uint32_t memberId) const { return memberId < m_Dirty.size() && m_Dirty[memberId]; }
+
+		//! @brief Store a recomputed row and clear its dirty flag
+		//! @param[in] memberId Member ID of the row
+		//! @param[in] memberIds Member IDs of the row
+		void setRow(uint32_t memberId, std::vector<uint32_t> const & memberIds);
+
+		//! @brief Retrieves a row.  Rows past the end of the view are empty.
+		//! @param[in] memberId Member ID of the row
+		//! @param[out] pMemberIds First member ID of the row
+		//! @param[out] count Number of member IDs in the row
+		void getRow(uint32_t memberId, const uint32_t * & pMemberIds, uint32_t & count) const;
+
+		//! @brief Merge the overlay into the CSR arrays
+		void compact();
+
+		//! @brief Retrieves the size and state of the view
+		void getStats(view_stats_t & stats) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEMATERIALIZEDVIEW_H_ */
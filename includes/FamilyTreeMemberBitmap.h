@@ -0,0 +1,96 @@
+/**
+ *  @file    FamilyTreeMemberBitmap.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeMemberBitmap object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeMemberBitmap class.
+ *
+ *  A FamilyTreeMemberBitmap is a dense bitmap with one bit per
+ *  member ID.  It is used to evaluate predicate queries: each
+ *  condition produces a bitmap of the members that match it and
+ *  the bitmaps are combined 64 members at a time with bitwise
+ *  AND/OR.
+ *
+ */
+
+#ifndef FAMILYTREEMEMBERBITMAP_H_
+#define FAMILYTREEMEMBERBITMAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeMemberBitmap {
+	// Member variables
+	private:
+		// Bits of the member IDs, 64 per word.  Bits past
+		// m_NumberOfBits in the last word are always 0.
+		std::vector<uint64_t> m_Words;
+		uint32_t m_NumberOfBits;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty bitmap.
+		FamilyTreeMemberBitmap();
+
+		//! @brief Creates a bitmap of numberOfBits bits that are all 0
+		FamilyTreeMemberBitmap(uint32_t numberOfBits);
+
+	// Member functions
+	private:
+		//! @brief Clear the bits past m_NumberOfBits in the last word
+		void clearTrailingBits();
+
+	public:
+		//! @brief Resize the bitmap to numberOfBits bits that are all 0
+		void reset(uint32_t numberOfBits);
+
+		//! @brief Set every bit of the bitmap
+		void setAll();
+
+		//! @brief Retrieves the number of bits in the bitmap
+		uint32_t size() const { return m_NumberOfBits; }
+
+		//! @brief Retrieves the number of 64-bit words in the bitmap
+		uint32_t getNumberOfWords() const { return m_Words.size(); }
+
+		//! @brief Retrieves the words of the bitmap
+		uint64_t * getWords() { return m_Words.empty() ? NULL : &m_Words[0]; }
+		const uint64_t * getWords() const { return m_Words.empty() ? NULL : &m_Words[0]; }
+
+		//! @brief Set the bit of a member ID
+		void set(uint32_t memberId) { m_Words[memberId >> 6] |= (1ULL << (memberId & 63)); }
+
+		//! @brief Clear the bit of a member ID
+		void clear(uint32_t memberId) { m_Words[memberId >> 6] &= ~(1ULL << (memberId & 63)); }
+
+		//! @brief Returns true if the bit of a member ID is set
+		bool test(uint32_t memberId) const { return (m_Words[memberId >> 6] >> (memberId & 63)) & 1; }
+
+		//! @brief this = this AND other.  Both bitmaps must be the same size.
+		void andWith(FamilyTreeMemberBitmap const & other);
+
+		//! @brief this = this OR other.  Both bitmaps must be the same size.
+		void orWith(FamilyTreeMemberBitmap const & other);
+
+		//! @brief this = this AND NOT other.  Both bitmaps must be the same size.
+		void andNotWith(FamilyTreeMemberBitmap const & other);
+
+		//! @brief Retrieves the number of set bits
+		uint32_t count() const;
+
+		//! @brief Retrieves the member IDs of the set bits in increasing order
+		//! @param[out] memberIds Member IDs of the set bits
+		void getMemberIds(std::vector<uint32_t> & memberIds) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEMEMBERBITMAP_H_ */
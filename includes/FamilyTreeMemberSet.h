@@ -0,0 +1,137 @@
+/**
+ *  @file    FamilyTreeMemberSet.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeMemberSet object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeMemberSet class.
+ *
+ *  A FamilyTreeMemberSet is a compressed set of member IDs
+ *  (Roaring bitmap layout).  The IDs are split by their high
+ *  16 bits into containers.  A container with up to
+ *  ARRAY_CONTAINER_MAX IDs stores the low 16 bits as a sorted
+ *  array.  A fuller container stores a 65536 bit bitmap.
+ *
+ *  Union, intersection and difference work container by
+ *  container.  Bitmap containers are combined one 64-bit word
+ *  at a time in loops that the compiler vectorizes.  Array
+ *  containers are merged.
+ *
+ */
+
+#ifndef FAMILYTREEMEMBERSET_H_
+#define FAMILYTREEMEMBERSET_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include "FamilyTreeMemberBitmap.h"
+
+namespace FamilyTree {
+
+class FamilyTreeMemberSet {
+	// Constants and enums
+	public:
+		//! @brief Largest number of IDs in an array container
+		static const uint32_t ARRAY_CONTAINER_MAX = 4096;
+
+		//! @brief Number of 64-bit words in a bitmap container
+		static const uint32_t BITMAP_CONTAINER_WORDS = 1024;
+
+	// Member variables
+	private:
+		// IDs that share the same high 16 bits.  Exactly one
+		// of array and bitmap is used, depending on the
+		// cardinality.
+		typedef struct {
+			uint16_t key;
+			uint32_t cardinality;
+			std::vector<uint16_t> array;
+			std::vector<uint64_t> bitmap;
+		} container_t;
+
+		// Containers sorted by key.  Empty containers are removed.
+		std::vector<container_t> m_Containers;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty set.
+		FamilyTreeMemberSet();
+
+		//! @brief Destructor
+		~FamilyTreeMemberSet();
+
+	// Member functions
+	private:
+		//! @brief Find the container with a key
+		//! @return Index of the container or the index it would be inserted at
+		uint32_t findContainer(uint16_t key) const;
+
+		//! @brief Convert a container to the representation that suits its cardinality
+		static void normalizeContainer(container_t & container);
+
+		//! @brief Convert an array container to a bitmap container
+		static void convertToBitmap(container_t & container);
+
+		//! @brief Convert a bitmap container to an array container
+		static void convertToArray(container_t & container);
+
+		//! @brief Returns true if the container has the low 16 bits of an ID
+		static bool containerContains(container_t const & container, uint16_t value);
+
+		//! @brief Container operations.  The result is stored in target.
+		static void unionContainers(container_t & target, container_t const & other);
+		static void intersectContainers(container_t & target, container_t const & other);
+		static void differenceContainers(container_t & target, container_t const & other);
+
+		//! @brief Remove the containers that became empty
+		void removeEmptyContainers();
+
+	public:
+		//! @brief Remove every member ID from the set
+		void clear();
+
+		//! @brief Add a member ID
+		//! @return true if the ID was not already in the set
+		bool add(uint32_t memberId);
+
+		//! @brief Remove a member ID
+		//! @return true if the ID was in the set
+		bool remove(uint32_t memberId);
+
+		//! @brief Returns true if the member ID is in the set
+		bool contains(uint32_t memberId) const;
+
+		//! @brief Retrieves the number of member IDs in the set
+		uint32_t size() const;
+
+		//! @brief Returns true if the set has no member IDs
+		bool empty() const { return m_Containers.empty(); }
+
+		//! @brief this = this OR other
+		void unionWith(FamilyTreeMemberSet const & other);
+
+		//! @brief this = this AND other
+		void intersectWith(FamilyTreeMemberSet const & other);
+
+		//! @brief this = this AND NOT other
+		void differenceWith(FamilyTreeMemberSet const & other);
+
+		//! @brief Replace the contents of the set with the set bits of a bitmap
+		void assignBitmap(FamilyTreeMemberBitmap const & bitmap);
+
+		//! @brief Retrieves the member IDs of the set in increasing order
+		//! @param[out] memberIds Member IDs in the set
+		void getMemberIds(std::vector<uint32_t> & memberIds) const;
+
+		//! @brief Returns true if both sets have the same member IDs
+		bool operator==(FamilyTreeMemberSet const & other) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEMEMBERSET_H_ */
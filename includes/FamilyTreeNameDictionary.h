@@ -0,0 +1,112 @@
+/**
+ *  @file    FamilyTreeNameDictionary.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeNameDictionary object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeNameDictionary class.
+ *
+ *  A FamilyTreeNameDictionary holds the member names in sorted
+ *  order, front coded in blocks of BLOCK_SIZE names.  The first
+ *  name of a block is stored in full.  Every other name stores
+ *  the length of the prefix it shares with the name before it
+ *  and the rest of the name.  Sorted names share long prefixes,
+ *  so this is much smaller than a vector of strings.
+ *
+ *  Names are addressed by rank (position in sorted order).  A
+ *  lookup binary searches the first names of the blocks and then
+ *  decodes at most one block, so prefix and range queries cost
+ *  O(log N + page size).
+ *
+ *  The dictionary is built once from a list of names and is not
+ *  updated in place.
+ *
+ */
+
+#ifndef FAMILYTREENAMEDICTIONARY_H_
+#define FAMILYTREENAMEDICTIONARY_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeNameDictionary {
+	// Constants and enums
+	public:
+		//! @brief Number of names in a front coded block
+		static const uint32_t BLOCK_SIZE = 16;
+
+	// Member variables
+	private:
+		// Front coded blocks.  Lengths are stored as varints.
+		std::vector<uint8_t> m_Data;
+
+		// Offset of each block in m_Data
+		std::vector<uint64_t> m_BlockOffsets;
+
+		// Number of names in the dictionary
+		uint32_t m_NumberOfNames;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty dictionary.
+		FamilyTreeNameDictionary();
+
+		//! @brief Destructor
+		~FamilyTreeNameDictionary();
+
+	// Member functions
+	private:
+		//! @brief Append a varint to m_Data
+		void appendLength(uint32_t length);
+
+		//! @brief Read a varint from m_Data
+		uint32_t readLength(uint64_t & offset) const;
+
+		//! @brief Decode the next name of a block
+		//! @param[in/out] offset Offset of the encoded name, moved past it
+		//! @param[in] firstInBlock true for the first name of a block
+		//! @param[in/out] name Previous name of the block, replaced by the decoded name
+		void decodeName(uint64_t & offset, bool firstInBlock, std::string & name) const;
+
+		//! @brief Retrieves the rank of the first name that is not less than key
+		//! @param[in] prefixOnly Compare only the first key.size() characters of the names
+		uint32_t findRank(std::string const & key, bool prefixOnly, bool upper) const;
+
+	public:
+		//! @brief Build the dictionary from a list of names.
+		//!		  The names are sorted and duplicates are removed.
+		void build(std::vector<std::string> names);
+
+		//! @brief Remove every name from the dictionary
+		void clear();
+
+		//! @brief Retrieves the number of names in the dictionary
+		uint32_t size() const { return m_NumberOfNames; }
+
+		//! @brief Retrieves the number of bytes used by the encoded names
+		uint64_t getEncodedSize() const { return m_Data.size() + m_BlockOffsets.size() * sizeof(uint64_t); }
+
+		//! @brief Retrieves the rank of the first name that is not less than name
+		uint32_t lowerBound(std::string const & name) const { return findRank(name, false, false); }
+
+		//! @brief Retrieves the rank of the first name that is greater than name
+		uint32_t upperBound(std::string const & name) const { return findRank(name, false, true); }
+
+		//! @brief Retrieves the ranks [first, end) of the names that start with prefix
+		void getPrefixRange(std::string const & prefix, uint32_t & first, uint32_t & end) const;
+
+		//! @brief Retrieves the names with ranks [first, first + count) in sorted order
+		//! @param[in/out] names Names in the range (count is clipped at the last name)
+		void getNames(uint32_t first, uint32_t count, std::vector<std::string> & names) const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREENAMEDICTIONARY_H_ */
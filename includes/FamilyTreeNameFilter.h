@@ -0,0 +1,91 @@
+/**
+ *  @file    FamilyTreeNameFilter.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeNameFilter object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeNameFilter class.
+ *
+ *  A FamilyTreeNameFilter is a split block Bloom filter over
+ *  the names of the family members.  Each name sets one bit
+ *  in each of the 8 words of a single 512-bit (cache line)
+ *  block, so a lookup hashes the name once and reads one cache
+ *  line.  mayContain never returns false for a name that was
+ *  added; it returns true for roughly 0.1% of the other names
+ *  while the filter holds at most its capacity.
+ *
+ *  Names cannot be removed from a Bloom filter.  A removed
+ *  member's name only makes the filter answer "maybe" for it
+ *  until the filter is rebuilt.
+ *
+ */
+
+#ifndef FAMILYTREENAMEFILTER_H_
+#define FAMILYTREENAMEFILTER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeNameFilter {
+	// Constants and enums
+	public:
+		//! @brief Number of 64-bit words in a block
+		static const uint32_t WORDS_PER_BLOCK = 8;
+
+		//! @brief Number of filter bits per name at full capacity
+		static const uint32_t BITS_PER_NAME = 16;
+
+		//! @brief Capacity of an empty filter
+		static const uint32_t MIN_CAPACITY = 1024;
+
+	// Member variables
+	private:
+		// Blocks of WORDS_PER_BLOCK words
+		std::vector<uint64_t> m_Words;
+		uint32_t m_NumberOfBlocks;
+
+		// Number of names the filter was sized for and
+		// number of names that have been added
+		uint32_t m_Capacity;
+		uint32_t m_NumberOfNames;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty filter of MIN_CAPACITY names.
+		FamilyTreeNameFilter();
+
+		//! @brief Destructor
+		~FamilyTreeNameFilter();
+
+	// Member functions
+	public:
+		//! @brief Hash a name
+		static uint64_t hashName(const char * pName, size_t length);
+
+		//! @brief Remove every name and size the filter for capacity names
+		void reset(uint32_t capacity);
+
+		//! @brief Add a name to the filter
+		void add(std::string const & name);
+
+		//! @brief Returns false if the name was never added
+		bool mayContain(std::string const & name) const;
+
+		//! @brief Returns true if more names than the capacity have been added
+		bool isFull() const { return m_NumberOfNames > m_Capacity; }
+
+		//! @brief Retrieves the number of names the filter was sized for
+		uint32_t getCapacity() const { return m_Capacity; }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREENAMEFILTER_H_ */
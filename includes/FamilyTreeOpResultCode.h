@@ -31,6 +31,9 @@ namespace FamilyTree {
         INPUT_FILE_OPEN_ERROR,
         INPUT_FILE_FORMAT_ERROR,
         FAMILY_MEMBER_NOT_FOUND,
+        RELATIONSHIP_NOT_FOUND,
+        OUTPUT_FILE_OPEN_ERROR,
+        OUTPUT_FILE_WRITE_ERROR,
 		SUCCESS = 0
     } FamilyTreeOpResultCode;
 
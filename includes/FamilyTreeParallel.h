@@ -0,0 +1,94 @@
+/**
+ *  @file    FamilyTreeParallel.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeParallel object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeParallel class.
+ *
+ *  FamilyTreeParallel splits a range of indices (member IDs,
+ *  frontier positions, ...) into one contiguous chunk per thread
+ *  and runs a function on every chunk.  The calling thread runs
+ *  the first chunk itself and waits for the other threads.
+ *
+ *  Ranges that are too small to be worth starting a thread for
+ *  are run entirely on the calling thread.
+ *
+ */
+
+#ifndef FAMILYTREEPARALLEL_H_
+#define FAMILYTREEPARALLEL_H_
+
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeParallel {
+	// Member variables
+	private:
+		// Number of threads used by forEachRange (0 until set or first used)
+		static uint32_t s_NumberOfThreads;
+
+	// Member functions
+	public:
+		//! @brief Set the number of threads used by forEachRange
+		//! @param[in] numberOfThreads Number of threads (0 uses one thread per CPU)
+		static void setNumberOfThreads(uint32_t numberOfThreads);
+
+		//! @brief Retrieves the number of threads used by forEachRange
+		static uint32_t getNumberOfThreads();
+
+		//! @brief Run function(threadIndex, chunkBegin, chunkEnd) over [begin, end)
+		//! @param[in] begin First index of the range
+		//! @param[in] end Index past the last index of the range
+		//! @param[in] minChunkSize Smallest number of indices given to a thread
+		//! @param[in] function Function to run on every chunk
+		//! @return Number of chunks the range was split into
+		template<typename Function>
+		static uint32_t forEachRange(uint32_t begin, uint32_t end, uint32_t minChunkSize, Function function) {
+			if(end <= begin) {
+				return 0;
+			}
+
+			uint32_t length = end - begin;
+			uint32_t numberOfChunks = getNumberOfThreads();
+			if(minChunkSize == 0) {
+				minChunkSize = 1;
+			}
+			if(numberOfChunks > (length + minChunkSize - 1) / minChunkSize) {
+				numberOfChunks = (length + minChunkSize - 1) / minChunkSize;
+			}
+
+			if(numberOfChunks <= 1) {
+				function(0, begin, end);
+				return 1;
+			}
+
+			// Chunk i is [begin + i * length / n, begin + (i + 1) * length / n)
+			std::vector<std::thread> threads;
+			threads.reserve(numberOfChunks - 1);
+			for(uint32_t i = 1; i < numberOfChunks; i++) {
+				uint32_t chunkBegin = begin + (uint32_t)((uint64_t)length * i / numberOfChunks);
+				uint32_t chunkEnd = begin + (uint32_t)((uint64_t)length * (i + 1) / numberOfChunks);
+				threads.push_back(std::thread(function, i, chunkBegin, chunkEnd));
+			}
+
+			function(0, begin, begin + (uint32_t)((uint64_t)length / numberOfChunks));
+
+			for(uint32_t i = 0; i < threads.size(); i++) {
+				threads[i].join();
+			}
+
+			return numberOfChunks;
+		}
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEPARALLEL_H_ */
@@ -0,0 +1,132 @@
+/**
+ *  @file    FamilyTreePathExpression.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreePathExpression object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreePathExpression class.
+ *
+ *  A FamilyTreePathExpression is a relationship path such as
+ *  "parent.sibling.child" (cousins) or "parent+" (ancestors)
+ *  compiled into a finite automaton.  The grammar is
+ *
+ *    expression  := sequence ('|' sequence)*
+ *    sequence    := repetition ('.' repetition)*
+ *    repetition  := step ('+' | '*' | '?')*
+ *    step        := parent | child | sibling | '(' expression ')'
+ *
+ *  The plural names (parents, children, siblings) are accepted
+ *  too and whitespace is ignored.
+ *
+ *  The expression is parsed into a Thompson automaton, whose
+ *  epsilon transitions are then removed.  Every state of the
+ *  compiled automaton has a list of (step, next state)
+ *  transitions and may be accepting.  State 0 is the start state.
+ *
+ */
+
+#ifndef FAMILYTREEPATHEXPRESSION_H_
+#define FAMILYTREEPATHEXPRESSION_H_
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreePathExpression {
+	// Constants and enums
+	public:
+		//! @brief Relationship followed by a transition
+		typedef enum {
+			Step_Parent,
+			Step_Child,
+			Step_Sibling
+		} step_t;
+
+		//! @brief A transition of the automaton
+		typedef struct {
+			step_t step;
+			uint32_t nextState;
+		} transition_t;
+
+	// Member variables
+	private:
+		// State of the Thompson automaton built by the parser
+		typedef struct {
+			std::vector<uint32_t> epsilons;
+			std::vector<transition_t> transitions;
+		} parser_state_t;
+
+		// Part of the Thompson automaton with one start and one accept state
+		typedef struct {
+			uint32_t start;
+			uint32_t accept;
+		} fragment_t;
+
+		// Transitions of state i are m_Transitions[m_Offsets[i] .. m_Offsets[i + 1])
+		std::vector<uint32_t> m_Offsets;
+		std::vector<transition_t> m_Transitions;
+
+		// Accepting flag of each state
+		std::vector<bool> m_Accepting;
+
+		// Expression being parsed, the parse position and the Thompson automaton
+		std::string m_Expression;
+		uint32_t m_Position;
+		std::vector<parser_state_t> m_ParserStates;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an automaton that accepts nothing.
+		FamilyTreePathExpression();
+
+		//! @brief Destructor
+		~FamilyTreePathExpression();
+
+	// Member functions
+	private:
+		//! @brief Skip the whitespace at the parse position
+		void skipWhitespace();
+
+		//! @brief Add a state to the Thompson automaton
+		uint32_t addParserState();
+
+		//! @brief Parse the rules of the grammar
+		//! @return false if the expression is not valid at the parse position
+		bool parseExpression(fragment_t & fragment);
+		bool parseSequence(fragment_t & fragment);
+		bool parseRepetition(fragment_t & fragment);
+		bool parseStep(fragment_t & fragment);
+
+		//! @brief Remove the epsilon transitions of the Thompson automaton
+		void removeEpsilons(fragment_t const & fragment);
+
+	public:
+		//! @brief Compile an expression.  On error the automaton accepts nothing.
+		//! @param[in] expression Path expression
+		//! @return true if the expression is valid
+		bool compile(std::string const & expression);
+
+		//! @brief Retrieves the position in the expression where the
+		//!		  last compile failed
+		uint32_t getErrorPosition() const { return m_Position; }
+
+		//! @brief Retrieves the number of states
+		uint32_t getNumberOfStates() const { return m_Accepting.size(); }
+
+		//! @brief Returns true if a state is accepting
+		bool isAccepting(uint32_t state) const { return m_Accepting[state]; }
+
+		//! @brief Iterators over the transitions of a state
+		const transition_t * beginTransitions(uint32_t state) const { return m_Transitions.data() + m_Offsets[state]; }
+		const transition_t * endTransitions(uint32_t state) const { return m_Transitions.data() + m_Offsets[state + 1]; }
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREEPATHEXPRESSION_H_ */
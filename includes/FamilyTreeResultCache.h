@@ -0,0 +1,166 @@
+/**
+ *  @file    FamilyTreeResultCache.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeResultCache object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeResultCache class.
+ *
+ *  FamilyTreeResultCache keeps the name lists returned by
+ *  recent queries, keyed by (query kind, member name, parameter),
+ *  so that a hit is answered without looking the member up in
+ *  the tree.  A name list is stored once and shared with every
+ *  caller it is returned to, so a hit does not copy the names.
+ *  The keys are spread over shards by hash.  Each shard has
+ *  its own lock, capacity and least recently used list, so the
+ *  least recently used entry of the shard is evicted when the
+ *  shard is full.
+ *
+ *  Every entry is tagged with the version of the tree it was
+ *  computed for.  A lookup with a newer version empties the
+ *  shard, so changes to the tree never return stale results.
+ *
+ *  The cache is disabled (capacity 0) until it is configured.
+ *
+ */
+
+#ifndef FAMILYTREERESULTCACHE_H_
+#define FAMILYTREERESULTCACHE_H_
+
+#include <stdint.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeResultCache {
+	// Constants and enums
+	public:
+		//! @brief Kinds of queries whose results are cached
+		typedef enum {
+			Query_Grandparents,
+			Query_Children,
+			Query_Siblings
+		} query_kind_t;
+
+		//! @brief A cached name list.  It is never changed once it
+		//!		  is stored, so it is shared instead of copied.
+		typedef std::shared_ptr<const std::vector<std::string> > name_list_row_t;
+
+		//! @brief Hit and miss counters summed over the shards
+		typedef struct {
+			uint64_t hits;
+			uint64_t misses;
+			uint64_t evictions;		//!< Entries dropped to make room
+			uint64_t invalidations;	//!< Entries dropped because the tree changed
+			uint32_t entries;		//!< Entries currently in the cache
+		} cache_stats_t;
+
+	// Member variables
+	private:
+		// A cached result.  The most recently used entry
+		// is at the front of the list of its shard.
+		typedef struct {
+			uint64_t hash;
+			uint32_t queryKind;
+			uint64_t parameter;
+			std::string memberName;
+			name_list_row_t nameList;
+		} cache_entry_t;
+
+		// The index of a shard is keyed by the 64-bit hash of the query,
+		// so a lookup does not build a key.  The entry is compared with
+		// the query, and an entry whose hash collides with a different
+		// query is a miss that the query's result replaces.
+		typedef std::list<cache_entry_t> entry_list_t;
+		typedef std::unordered_map<uint64_t, entry_list_t::iterator> entry_index_t;
+
+		typedef struct {
+			std::mutex lock;
+			uint64_t version;
+			uint32_t capacity;
+			entry_list_t entries;
+			entry_index_t index;
+			uint64_t hits;
+			uint64_t misses;
+			uint64_t evictions;
+			uint64_t invalidations;
+		} shard_t;
+
+		// Shards of the cache (empty while the cache is disabled)
+		std::vector<shard_t *> m_Shards;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  The cache is disabled.
+		FamilyTreeResultCache();
+
+		//! @brief Destructor
+		~FamilyTreeResultCache();
+
+	private:
+		// The cache is owned by one tree and is not copied
+		FamilyTreeResultCache(FamilyTreeResultCache const &);
+		FamilyTreeResultCache & operator=(FamilyTreeResultCache const &);
+
+	// Member functions
+	private:
+		//! @brief Hash of a query
+		static uint64_t hashQuery(query_kind_t queryKind, std::string const & memberName, uint64_t parameter);
+
+		//! @brief Returns true if an entry holds the result of a query
+		static bool matches(cache_entry_t const & entry, query_kind_t queryKind, std::string const & memberName, uint64_t parameter);
+
+		//! @brief Retrieves the shard that holds a query
+		shard_t & getShard(uint64_t hash) const;
+
+		//! @brief Remove every entry of a shard that was computed for an older version
+		static void invalidateShard(shard_t & shard, uint64_t version);
+
+	public:
+		//! @brief Configure the cache.  Existing entries and counters are dropped.
+		//! @param[in] capacity Largest number of entries in the cache (0 disables the cache)
+		//! @param[in] numberOfShards Number of shards the capacity is split over
+		void configure(uint32_t capacity, uint32_t numberOfShards);
+
+		//! @brief Returns true if the cache is enabled
+		bool isEnabled() const { return m_Shards.empty() == false; }
+
+		//! @brief Remove every entry.  The counters are kept.
+		void clear();
+
+		//! @brief Look up the result of a query
+		//! @param[in] queryKind Kind of the query
+		//! @param[in] memberName Name of the member the query is about
+		//! @param[in] parameter Other parameters of the query (0 if none)
+		//! @param[in] version Current version of the tree
+		//! @param[out] nameList Cached result (shared, not copied)
+		//! @return true if the result was in the cache
+		bool lookup(query_kind_t queryKind, std::string const & memberName, uint64_t parameter, uint64_t version, name_list_row_t & nameList);
+
+		//! @brief Store the result of a query
+		//! @param[in] queryKind Kind of the query
+		//! @param[in] memberName Name of the member the query is about
+		//! @param[in] parameter Other parameters of the query (0 if none)
+		//! @param[in] version Version of the tree the result was computed for
+		//! @param[in] nameList Result of the query
+		void insert(query_kind_t queryKind, std::string const & memberName, uint64_t parameter, uint64_t version, name_list_row_t const & nameList);
+
+		//! @brief Retrieves the counters summed over the shards
+		void getStats(cache_stats_t & stats) const;
+
+		//! @brief Set the hit, miss, eviction and invalidation counters to 0
+		void resetStats();
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREERESULTCACHE_H_ */
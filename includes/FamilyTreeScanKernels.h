@@ -0,0 +1,132 @@
+/**
+ *  @file    FamilyTreeScanKernels.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeScanKernels object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeScanKernels class.
+ *
+ *  FamilyTreeScanKernels finds the positions of the values of
+ *  a dense uint32_t column (such as the child count of every
+ *  member) that are within a range.  There is a scalar kernel
+ *  and SSE4.1 and AVX2 kernels that compare a whole vector of
+ *  values at once and compress the matching positions into the
+ *  output.  The fastest kernel that the CPU supports is selected
+ *  at runtime.
+ *
+ *  The same kernels can also produce a bitmap (one bit per value)
+ *  of the values that are within a range instead of their positions.
+ *
+ */
+
+#ifndef FAMILYTREESCANKERNELS_H_
+#define FAMILYTREESCANKERNELS_H_
+
+#include <stdint.h>
+
+namespace FamilyTree {
+
+class FamilyTreeScanKernels {
+	// Constants and enums
+	public:
+		//! @brief Scan kernels
+		typedef enum {
+			Kernel_Auto,
+			Kernel_Scalar,
+			Kernel_SSE41,
+			Kernel_AVX2
+		} kernel_t;
+
+		//! @brief Number of entries past the end of the output that a kernel may write
+		static const uint32_t OUTPUT_PADDING = 8;
+
+		//! @brief Range scan function
+		//! @param[in] pValues Column to scan
+		//! @param[in] numberOfValues Number of values in the column
+		//! @param[in] minValue Smallest value that matches
+		//! @param[in] maxValue Largest value that matches
+		//! @param[out] pPositions Positions of the matching values in increasing
+		//!				order.  Must have room for numberOfValues + OUTPUT_PADDING entries.
+		//! @return Number of matching values
+		typedef uint32_t (*range_scan_t)
+		(
+			const uint32_t * pValues,
+			uint32_t numberOfValues,
+			uint32_t minValue,
+			uint32_t maxValue,
+			uint32_t * pPositions
+		);
+
+		//! @brief Range bitmap function
+		//! @param[in] pValues Column to scan
+		//! @param[in] numberOfValues Number of values in the column
+		//! @param[in] minValue Smallest value that matches
+		//! @param[in] maxValue Largest value that matches
+		//! @param[out] pWords Bitmap of the matching values (bit i of word i / 64 is
+		//!				set if value i matches).  All (numberOfValues + 63) / 64 words are written.
+		typedef void (*range_bitmap_t)
+		(
+			const uint32_t * pValues,
+			uint32_t numberOfValues,
+			uint32_t minValue,
+			uint32_t maxValue,
+			uint64_t * pWords
+		);
+
+	// Member variables
+	private:
+		// Kernels used by scanRange and scanRangeToBitmap
+		static range_scan_t s_pRangeScan;
+		static range_bitmap_t s_pRangeBitmap;
+		static kernel_t s_Kernel;
+
+	// Member functions
+	private:
+		static uint32_t scanRangeScalar(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint32_t * pPositions);
+		static uint32_t scanRangeSSE41(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint32_t * pPositions);
+		static uint32_t scanRangeAVX2(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint32_t * pPositions);
+
+		static void rangeBitmapScalar(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint64_t * pWords);
+		static void rangeBitmapSSE41(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint64_t * pWords);
+		static void rangeBitmapAVX2(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint64_t * pWords);
+
+	public:
+		//! @brief Returns true if the CPU supports the kernel
+		static bool isSupported(kernel_t kernel);
+
+		//! @brief Select the kernel used by scanRange
+		//! @param[in] kernel Kernel to use.  Kernel_Auto selects the
+		//!				fastest kernel that the CPU supports.
+		//! @return false if the CPU does not support the kernel
+		static bool setKernel(kernel_t kernel);
+
+		//! @brief Retrieves the kernel used by scanRange
+		static kernel_t getKernel();
+
+		//! @brief Retrieves the name of a kernel
+		static const char * getKernelName(kernel_t kernel);
+
+		//! @brief Find the positions of the values within [minValue, maxValue]
+		//!		  with the selected kernel.  See range_scan_t.
+		static uint32_t scanRange(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint32_t * pPositions);
+
+		//! @brief Build the bitmap of the values within [minValue, maxValue]
+		//!		  with the selected kernel.  See range_bitmap_t.
+		static void scanRangeToBitmap(const uint32_t * pValues, uint32_t numberOfValues,
+			uint32_t minValue, uint32_t maxValue, uint64_t * pWords);
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREESCANKERNELS_H_ */
@@ -0,0 +1,103 @@
+/**
+ *  @file    FamilyTreeTrigramIndex.h
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Class definition for FamilyTreeTrigramIndex object
+ *
+ *  @section DESCRIPTION
+ *
+ *  This file details the definition of the
+ *  FamilyTreeTrigramIndex class.
+ *
+ *  A FamilyTreeTrigramIndex is an inverted index from the
+ *  trigrams (3 character substrings) of the member names to the
+ *  IDs of the members whose name has them.  Names are lower cased
+ *  and padded with two leading and one trailing marker, so a name
+ *  of length L has L + 1 trigrams and short names still have some.
+ *
+ *  The posting lists are stored in one array (CSR layout) sorted
+ *  by trigram.  A lookup counts, for every member, how many of
+ *  the distinct trigrams of the query its name shares.  Only the
+ *  shortest posting lists that a match must appear in are walked;
+ *  the candidates are then looked up in the longer lists.
+ *
+ *  The index is built once from a list of names and is not
+ *  updated in place.
+ *
+ */
+
+#ifndef FAMILYTREETRIGRAMINDEX_H_
+#define FAMILYTREETRIGRAMINDEX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace FamilyTree {
+
+class FamilyTreeTrigramIndex {
+	// Types
+	public:
+		//! @brief A member whose name shares trigrams with the query
+		typedef struct {
+			uint32_t memberId;
+			uint32_t sharedTrigrams;
+		} candidate_t;
+
+	// Member variables
+	private:
+		// Distinct trigrams in increasing order
+		std::vector<uint32_t> m_Trigrams;
+
+		// Posting list of m_Trigrams[i] is
+		// m_MemberIds[m_Offsets[i] .. m_Offsets[i + 1])
+		std::vector<uint32_t> m_Offsets;
+		std::vector<uint32_t> m_MemberIds;
+
+		// Shared trigram count of each member ID, used by
+		// findCandidates.  All zeros between calls, so
+		// findCandidates must not be called concurrently.
+		mutable std::vector<uint32_t> m_Counts;
+
+	// Constructors/Destructors
+	public:
+		//! @brief Default constructor.  Creates an empty index.
+		FamilyTreeTrigramIndex();
+
+		//! @brief Destructor
+		~FamilyTreeTrigramIndex();
+
+	// Member functions
+	public:
+		//! @brief Retrieves the distinct trigrams of a name in increasing order
+		static void getTrigrams(const char * pName, size_t length, std::vector<uint32_t> & trigrams);
+
+		//! @brief Retrieves the edit distance (ignoring case) between two
+		//!		  names if it is at most maxDistance
+		//! @return Edit distance, or maxDistance + 1 if it is larger than maxDistance
+		static uint32_t getBoundedEditDistance(const char * pA, size_t lengthA, const char * pB, size_t lengthB, uint32_t maxDistance);
+
+		//! @brief Build the index
+		//! @param[in] memberIds Member ID of each name
+		//! @param[in] names Names of the members
+		void build(std::vector<uint32_t> const & memberIds, std::vector<std::string> const & names);
+
+		//! @brief Remove every name from the index
+		void clear();
+
+		//! @brief Retrieves the members that share at least minShared
+		//!		  distinct trigrams with the query
+		//! @param[in] query Name to look up
+		//! @param[in] minShared Smallest number of shared trigrams (at least 1)
+		//! @param[out] candidates Matching members in increasing member ID order
+		void findCandidates(std::string const & query, uint32_t minShared, std::vector<candidate_t> & candidates) const;
+
+		//! @brief Retrieves the number of bytes used by the index
+		uint64_t getIndexSize() const;
+};
+
+} /* namespace FamilyTree */
+
+#endif /* FAMILYTREETRIGRAMINDEX_H_ */
@@ -11,57 +11,123 @@
  *
  */
 
+#include <cstring>
+
 #include "FamilyMemberClass.h"
 #include "FamilyTreeClass.h"
 
 namespace FamilyTree {
 
-	FamilyMemberClass::FamilyMemberClass() {
+	FamilyMemberClass::FamilyMemberClass() :
+		m_Id(FamilyTreeClass::INVALID_MEMBER_ID),
+		m_pName(""),
+		m_NameLength(0),
+		m_pOutgoing(NULL),
+		m_pIncoming(NULL) {
+		memset(&m_Children, 0, sizeof(m_Children));
+		memset(&m_Parents, 0, sizeof(m_Parents));
+		memset(&m_Siblings, 0, sizeof(m_Siblings));
 	}
 
-	FamilyMemberClass::~FamilyMemberClass() {
+	void FamilyMemberClass::addOutgoingRelationship(FamilyRelationshipClass * pRelationship) {
+		pRelationship->m_pPrevOutgoing = NULL;
+		pRelationship->m_pNextOutgoing = m_pOutgoing;
+		if(m_pOutgoing != NULL) {
+			m_pOutgoing->m_pPrevOutgoing = pRelationship;
+		}
+		m_pOutgoing = pRelationship;
 	}
 
-	uint32_t FamilyMemberClass::getNumberOfSiblings() {
-		uint32_t numberOfSiblings = 0;
+	void FamilyMemberClass::removeOutgoingRelationship(FamilyRelationshipClass * pRelationship) {
+		if(pRelationship->m_pPrevOutgoing != NULL) {
+			pRelationship->m_pPrevOutgoing->m_pNextOutgoing = pRelationship->m_pNextOutgoing;
+		}
+		else {
+			m_pOutgoing = pRelationship->m_pNextOutgoing;
+		}
 
-		// Retrieve the set of from edges connected to this vertex
-		// where "from" edge means the edge is directed from the vertex
-		EdgeSet adjacentEdges = CollectIncidentEdges(false, true, false);
+		if(pRelationship->m_pNextOutgoing != NULL) {
+			pRelationship->m_pNextOutgoing->m_pPrevOutgoing = pRelationship->m_pPrevOutgoing;
+		}
 
-		// If the edge has a "sibling relationship"
-		// then increment the sibling count.
-		for (unsigned int i = 0; i < adjacentEdges.size(); i++) {
-			Edge * const currentEdge = adjacentEdges[i];
-			IntAttribute * pRelationshipAttr = (IntAttribute *)currentEdge->GetAttribute("Relationship");
-			if(pRelationshipAttr->Value == FamilyTreeClass::Sibling) {
-				numberOfSiblings++;
-			}
+		pRelationship->m_pPrevOutgoing = NULL;
+		pRelationship->m_pNextOutgoing = NULL;
+	}
+
+	void FamilyMemberClass::addIncomingRelationship(FamilyRelationshipClass * pRelationship) {
+		pRelationship->m_pPrevIncoming = NULL;
+		pRelationship->m_pNextIncoming = m_pIncoming;
+		if(m_pIncoming != NULL) {
+			m_pIncoming->m_pPrevIncoming = pRelationship;
+		}
+		m_pIncoming = pRelationship;
+	}
+
+	void FamilyMemberClass::removeIncomingRelationship(FamilyRelationshipClass * pRelationship) {
+		if(pRelationship->m_pPrevIncoming != NULL) {
+			pRelationship->m_pPrevIncoming->m_pNextIncoming = pRelationship->m_pNextIncoming;
+		}
+		else {
+			m_pIncoming = pRelationship->m_pNextIncoming;
+		}
+
+		if(pRelationship->m_pNextIncoming != NULL) {
+			pRelationship->m_pNextIncoming->m_pPrevIncoming = pRelationship->m_pPrevIncoming;
 		}
 
-		return numberOfSiblings;
+		pRelationship->m_pPrevIncoming = NULL;
+		pRelationship->m_pNextIncoming = NULL;
+	}
+
+	FamilyMemberClass::neighbor_list_t * FamilyMemberClass::getNeighborList(int32_t relationship) {
+		switch(relationship) {
+			case FamilyTreeClass::Parent_Child:	return &m_Children;
+			case FamilyTreeClass::Child_Parent:	return &m_Parents;
+			case FamilyTreeClass::Sibling:		return &m_Siblings;
+			default:							return NULL;
+		}
 	}
 
-	uint32_t FamilyMemberClass::getNumberOfChildren() {
-			uint32_t numberOfChildren = 0;
-
-			// Retrieve the set of from edges connected to this vertex
-			// where "from" edge means the edge is directed from the vertex
-			EdgeSet adjacentEdges = CollectIncidentEdges(false, true, false);
-
-			// If the edge has a "sibling relationship"
-			// then increment the sibling count.
-			for (unsigned int i = 0; i < adjacentEdges.size(); i++) {
-				Edge * const currentEdge = adjacentEdges[i];
-				IntAttribute * pRelationshipAttr = (IntAttribute *)currentEdge->GetAttribute("Relationship");
-				if(pRelationshipAttr->Value == FamilyTreeClass::Parent_Child) {
-					numberOfChildren++;
-				}
+	bool FamilyMemberClass::addNeighbor(int32_t relationship, FamilyMemberClass * pMember, FamilyTreeArena & arena) {
+		neighbor_list_t * pList = getNeighborList(relationship);
+		if(pList == NULL) {
+			return true;
+		}
+
+		// Grow the array by doubling it.  The old array stays
+		// in the arena until the tree is cleared.
+		if(pList->size == pList->capacity) {
+			uint32_t newCapacity = (pList->capacity == 0) ? INITIAL_NEIGHBOR_CAPACITY : pList->capacity * 2;
+			FamilyMemberClass ** pNewMembers = (FamilyMemberClass **)arena.allocate(
+				newCapacity * sizeof(FamilyMemberClass *), __alignof__(FamilyMemberClass *));
+			if(pNewMembers == NULL) {
+				return false;
 			}
 
-			return numberOfChildren;
+			if(pList->size > 0) {
+				memcpy(pNewMembers, pList->pMembers, pList->size * sizeof(FamilyMemberClass *));
+			}
+			pList->pMembers = pNewMembers;
+			pList->capacity = newCapacity;
 		}
 
-}
+		pList->pMembers[pList->size++] = pMember;
+		return true;
+	}
+
+	void FamilyMemberClass::removeNeighbor(int32_t relationship, FamilyMemberClass * pMember) {
+		neighbor_list_t * pList = getNeighborList(relationship);
+		if(pList == NULL) {
+			return;
+		}
 
+		for(uint32_t i = 0; i < pList->size; i++) {
+			if(pList->pMembers[i] == pMember) {
+				memmove(&pList->pMembers[i], &pList->pMembers[i + 1], (pList->size - i - 1) * sizeof(FamilyMemberClass *));
+				pList->size--;
+				return;
+			}
+		}
+	}
 
+} /* namespace FamilyTree */
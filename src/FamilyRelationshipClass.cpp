@@ -0,0 +1,36 @@
+/**
+ *  @file    FamilyRelationshipClass.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyRelationshipClass
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyRelationshipClass
+ *
+ */
+
+#include <cstddef>
+
+#include "FamilyRelationshipClass.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyRelationshipClass::TYPE_MASK;
+	const uint32_t FamilyRelationshipClass::FLAGS_MASK;
+	const uint32_t FamilyRelationshipClass::FLAG_BIOLOGICAL;
+	const uint32_t FamilyRelationshipClass::FLAG_ADOPTIVE;
+	const uint32_t FamilyRelationshipClass::FLAG_STEP;
+
+	FamilyRelationshipClass::FamilyRelationshipClass() :
+		m_pFrom(NULL),
+		m_pTo(NULL),
+		m_Tag(0),
+		m_pPrevOutgoing(NULL),
+		m_pNextOutgoing(NULL),
+		m_pPrevIncoming(NULL),
+		m_pNextIncoming(NULL) {
+	}
+
+} /* namespace FamilyTree */
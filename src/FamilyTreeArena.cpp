@@ -0,0 +1,106 @@
+/**
+ *  @file    FamilyTreeArena.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeArena
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeArena
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include "FamilyTreeArena.h"
+
+namespace FamilyTree {
+
+	FamilyTreeArena::FamilyTreeArena() :
+		m_pChunks(NULL),
+		m_pCurrent(NULL),
+		m_pEnd(NULL),
+		m_NextChunkSize(INITIAL_CHUNK_SIZE),
+		m_BytesReserved(0),
+		m_BytesUsed(0) {
+	}
+
+	FamilyTreeArena::~FamilyTreeArena() {
+		reset();
+	}
+
+	bool FamilyTreeArena::addChunk(size_t size) {
+		// Grow the chunk size geometrically so that the
+		// number of chunks stays logarithmic in the tree size
+		size_t chunkSize = m_NextChunkSize;
+		while(chunkSize < size + sizeof(chunk_t)) {
+			chunkSize *= 2;
+		}
+
+		chunk_t * pChunk = (chunk_t *)malloc(chunkSize);
+		if(pChunk == NULL) {
+			return false;
+		}
+
+		pChunk->pNext = m_pChunks;
+		pChunk->size = chunkSize;
+		m_pChunks = pChunk;
+
+		m_pCurrent = (char *)pChunk + sizeof(chunk_t);
+		m_pEnd = (char *)pChunk + chunkSize;
+		m_BytesReserved += chunkSize;
+
+		if(m_NextChunkSize < MAX_CHUNK_SIZE) {
+			m_NextChunkSize *= 2;
+		}
+
+		return true;
+	}
+
+	void * FamilyTreeArena::allocate(size_t size, size_t alignment) {
+		// Align the current position
+		uintptr_t current = (uintptr_t)m_pCurrent;
+		uintptr_t aligned = (current + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+		if(m_pCurrent == NULL || aligned + size > (uintptr_t)m_pEnd) {
+			if(addChunk(size + alignment) == false) {
+				return NULL;
+			}
+
+			current = (uintptr_t)m_pCurrent;
+			aligned = (current + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		}
+
+		m_pCurrent = (char *)(aligned + size);
+		m_BytesUsed += size;
+
+		return (void *)aligned;
+	}
+
+	const char * FamilyTreeArena::copyString(std::string const & value) {
+		char * pCopy = (char *)allocate(value.size() + 1, 1);
+		if(pCopy == NULL) {
+			return NULL;
+		}
+
+		memcpy(pCopy, value.c_str(), value.size() + 1);
+		return pCopy;
+	}
+
+	void FamilyTreeArena::reset() {
+		while(m_pChunks != NULL) {
+			chunk_t * pNext = m_pChunks->pNext;
+			free(m_pChunks);
+			m_pChunks = pNext;
+		}
+
+		m_pCurrent = NULL;
+		m_pEnd = NULL;
+		m_NextChunkSize = INITIAL_CHUNK_SIZE;
+		m_BytesReserved = 0;
+		m_BytesUsed = 0;
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,54 @@
+/**
+ *  @file    FamilyTreeAttributeCollection.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeAttributeCollection
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeAttributeCollection
+ *
+ */
+
+#include <cstring>
+
+#include "FamilyTreeAttributeCollection.h"
+
+namespace FamilyTree {
+
+	FamilyTreeAttributeCollection::FamilyTreeAttributeCollection() : m_pAttributes(NULL) {
+	}
+
+	int32_t * FamilyTreeAttributeCollection::getIntAttribute(const char * name) {
+		for(attribute_t * pAttribute = m_pAttributes; pAttribute != NULL; pAttribute = pAttribute->pNext) {
+			if(strcmp(pAttribute->pName, name) == 0) {
+				return &pAttribute->value;
+			}
+		}
+
+		return NULL;
+	}
+
+	bool FamilyTreeAttributeCollection::setIntAttribute(const char * name, int32_t value, FamilyTreeArena & arena) {
+		// Overwrite the attribute if it is already set
+		int32_t * pValue = getIntAttribute(name);
+		if(pValue != NULL) {
+			*pValue = value;
+			return true;
+		}
+
+		attribute_t * pAttribute = arena.create<attribute_t>();
+		if(pAttribute == NULL) {
+			return false;
+		}
+
+		pAttribute->pName = name;
+		pAttribute->value = value;
+		pAttribute->pNext = m_pAttributes;
+		m_pAttributes = pAttribute;
+
+		return true;
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,161 @@
+/**
+ *  @file    FamilyTreeAttributeColumns.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeAttributeColumns
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeAttributeColumns
+ *
+ */
+
+#include "FamilyTreeAttributeColumns.h"
+
+namespace FamilyTree {
+
+	// Definitions of the constants that are passed by reference
+	const uint8_t FamilyTreeAttributeColumns::INVALID_AGE;
+	const int16_t FamilyTreeAttributeColumns::INVALID_BIRTH_YEAR;
+
+	// Sets the bits of the values of a column that are within
+	// [minValue, maxValue].  The range is clamped to the type
+	// of the column first.
+	template<class T> static void buildRangeBitmap
+	(
+		std::vector<T> const & column,
+		int64_t minValue,
+		int64_t maxValue,
+		int64_t typeMin,
+		int64_t typeMax,
+		FamilyTreeMemberBitmap & bitmap
+	) {
+		uint32_t numberOfValues = column.size();
+		bitmap.reset(numberOfValues);
+		if(numberOfValues == 0 || minValue > maxValue || maxValue < typeMin || minValue > typeMax) {
+			return;
+		}
+
+		T low = (T)((minValue < typeMin) ? typeMin : minValue);
+		T high = (T)((maxValue > typeMax) ? typeMax : maxValue);
+
+		const T * pValues = &column[0];
+		uint64_t * pWords = bitmap.getWords();
+		for(uint32_t i = 0; i < numberOfValues; i += 64) {
+			uint32_t end = (numberOfValues - i < 64) ? numberOfValues : i + 64;
+			uint64_t word = 0;
+			for(uint32_t j = i; j < end; j++) {
+				word |= (uint64_t)((pValues[j] >= low) & (pValues[j] <= high)) << (j - i);
+			}
+			pWords[i >> 6] = word;
+		}
+	}
+
+	FamilyTreeAttributeColumns::FamilyTreeAttributeColumns() {
+	}
+
+	FamilyTreeAttributeColumns::~FamilyTreeAttributeColumns() {
+	}
+
+	void FamilyTreeAttributeColumns::clear() {
+		m_InUse.clear();
+		m_Ages.clear();
+		m_Genders.clear();
+		m_BirthYears.clear();
+	}
+
+	void FamilyTreeAttributeColumns::addMember(uint32_t memberId) {
+		if(memberId >= m_InUse.size()) {
+			m_InUse.resize(memberId + 1, 0);
+			m_Ages.resize(memberId + 1, INVALID_AGE);
+			m_Genders.resize(memberId + 1, FamilyMemberClass::Unknown);
+			m_BirthYears.resize(memberId + 1, INVALID_BIRTH_YEAR);
+		}
+
+		m_InUse[memberId] = 1;
+		m_Ages[memberId] = INVALID_AGE;
+		m_Genders[memberId] = FamilyMemberClass::Unknown;
+		m_BirthYears[memberId] = INVALID_BIRTH_YEAR;
+	}
+
+	void FamilyTreeAttributeColumns::removeMember(uint32_t memberId) {
+		if(memberId >= m_InUse.size()) {
+			return;
+		}
+
+		m_InUse[memberId] = 0;
+	}
+
+	void FamilyTreeAttributeColumns::setAttributes(uint32_t memberId, member_attributes_t const & attributes) {
+		m_Ages[memberId] = attributes.age;
+		m_Genders[memberId] = (uint8_t)attributes.gender;
+		m_BirthYears[memberId] = attributes.birthYear;
+	}
+
+	void FamilyTreeAttributeColumns::getAttributes(uint32_t memberId, member_attributes_t & attributes) const {
+		attributes.age = m_Ages[memberId];
+		attributes.gender = (FamilyMemberClass::gender_t)m_Genders[memberId];
+		attributes.birthYear = m_BirthYears[memberId];
+	}
+
+	void FamilyTreeAttributeColumns::findMembers
+	(
+		member_filter_t const & filter,
+		const uint32_t * pChildCounts,
+		std::vector<uint32_t> & memberIds
+	) const {
+		uint32_t numberOfMembers = m_InUse.size();
+		memberIds.resize(numberOfMembers);
+		if(numberOfMembers == 0) {
+			return;
+		}
+
+		const uint8_t * pInUse = &m_InUse[0];
+		const uint8_t * pAges = &m_Ages[0];
+		const uint8_t * pGenders = &m_Genders[0];
+		const int16_t * pBirthYears = &m_BirthYears[0];
+		uint32_t * pOut = &memberIds[0];
+
+		// Evaluate every condition for every member without
+		// branching and always write the member ID.  The output
+		// position only advances when the member matches.
+		uint32_t numberOfMatches = 0;
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			uint32_t match = pInUse[i];
+			match &= (pAges[i] >= filter.minAge) & (pAges[i] <= filter.maxAge);
+			match &= (filter.genderMask >> pGenders[i]) & 1;
+			match &= (pBirthYears[i] >= filter.minBirthYear) & (pBirthYears[i] <= filter.maxBirthYear);
+			match &= (pChildCounts[i] >= filter.minChildren) & (pChildCounts[i] <= filter.maxChildren);
+
+			pOut[numberOfMatches] = i;
+			numberOfMatches += match;
+		}
+
+		memberIds.resize(numberOfMatches);
+	}
+
+	void FamilyTreeAttributeColumns::findMembersInRange
+	(
+		attribute_t attribute,
+		int64_t minValue,
+		int64_t maxValue,
+		FamilyTreeMemberBitmap & bitmap
+	) const {
+		switch(attribute) {
+			case Attribute_Age:
+				buildRangeBitmap(m_Ages, minValue, maxValue, 0, UINT8_MAX, bitmap);
+				break;
+			case Attribute_Gender:
+				buildRangeBitmap(m_Genders, minValue, maxValue, 0, UINT8_MAX, bitmap);
+				break;
+			case Attribute_BirthYear:
+				buildRangeBitmap(m_BirthYears, minValue, maxValue, INT16_MIN, INT16_MAX, bitmap);
+				break;
+			default:
+				bitmap.reset(m_InUse.size());
+				break;
+		}
+	}
+
+} /* namespace FamilyTree */
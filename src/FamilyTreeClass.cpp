@@ -11,24 +11,36 @@
  *
  */
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
+#include <iterator>
+#include <unordered_set>
 #include "libs/boost/algorithm/string.hpp"	// local boost libs
-//#include <boost/algorithm/string.hpp>		// Use installed boost libs
-
 #include "libs/opengt/opengt.h"
+#include "libs/opengt/import/import.h"
+//#include <boost/algorithm/string.hpp>		// Use installed boost libs
 
 #include "FamilyTreeClass.h"
 #include "FamilyTreeDebug.h"
+#include "FamilyTreeParallel.h"
+#include "FamilyTreeScanKernels.h"
 
 namespace FamilyTree {
+
+    // Definitions of the constants that are passed by reference
+    const uint32_t FamilyTreeClass::INVALID_MEMBER_ID;
+    const uint32_t FamilyTreeClass::INVALID_GENERATION;
+    const uint32_t FamilyTreeClass::MAX_VALIDATION_ISSUES;
+    const uint32_t FamilyTreeClass::NO_DEPTH_LIMIT;
     
-    FamilyTreeClass::FamilyTreeClass() {
+    FamilyTreeClass::FamilyTreeClass() : m_pFreeRelationships(NULL), m_inputFileOffset(0), m_DuplicatesSkipped(0), m_StructureVersion(1), m_GenerationsVersion(0), m_NamesVersion(1), m_NameDictionaryVersion(0), m_TrigramIndexVersion(0), m_KinshipVersion(0), m_FamiliesStale(false) {
     }
 
-    FamilyTreeClass::FamilyTreeClass(const FamilyTreeClass& orig) {
+    FamilyTreeClass::FamilyTreeClass(const FamilyTreeClass& orig) : m_pFreeRelationships(NULL), m_inputFileOffset(0), m_DuplicatesSkipped(0), m_StructureVersion(1), m_GenerationsVersion(0), m_NamesVersion(1), m_NameDictionaryVersion(0), m_TrigramIndexVersion(0), m_KinshipVersion(0), m_FamiliesStale(false) {
     }
     
-    FamilyTreeClass::FamilyTreeClass(string const & inputFileName) {
+    FamilyTreeClass::FamilyTreeClass(string const & inputFileName) : m_pFreeRelationships(NULL), m_inputFileOffset(0), m_DuplicatesSkipped(0), m_StructureVersion(1), m_GenerationsVersion(0), m_NamesVersion(1), m_NameDictionaryVersion(0), m_TrigramIndexVersion(0), m_KinshipVersion(0), m_FamiliesStale(false) {
     	m_inputFileName = inputFileName;
     }
 
@@ -37,240 +49,323 @@ namespace FamilyTree {
 
 
     FamilyTreeOpResultCode FamilyTreeClass::initialize(string const & inputFileName) {
-        return constructTreeFromFile(inputFileName);
+        // Start from an empty tree so that initialize
+        // can also be used to reload the input file
+        clearTree();
+
+        m_inputFileName = inputFileName;
+        FamilyTreeOpResultCode result = constructTreeFromFile(inputFileName);
+        if(result != SUCCESS) {
+            return result;
+        }
+
+        // The registered views are rebuilt once the whole file is read
+        buildStaleMaterializedViews();
+
+        return SUCCESS;
     }
 
-    FamilyMemberClass * FamilyTreeClass::findFamilyMember(string const & memberName) {
+    FamilyTreeOpResultCode FamilyTreeClass::initializeFromGedcom(string const & inputFileName) {
+        clearTree();
 
-        FamilyMemberClass * pFamilyMember = NULL;
+        // Appended GEDCOM records cannot be followed
+        m_inputFileName.clear();
+        FamilyTreeOpResultCode result = constructTreeFromGedcom(inputFileName);
+        if(result != SUCCESS) {
+            return result;
+        }
 
-        // Search the list of vertices to see
-        // if the label of a vertex matches memberName
-        // If so, return that vertex.
-        // Otherwise, return NULL
-        for(VertexIterator it = m_Graph.BeginVertices(); it != m_Graph.EndVertices(); it++) {
-            if((*it)->GetLabel("Member_Name").compare(memberName) == 0) {
-                pFamilyMember = (FamilyMemberClass *)(*it);
-                break;
+        buildStaleMaterializedViews();
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::initializeFromGraphFile(string const & inputFileName, string const & format) {
+        clearTree();
+
+        // The import filters are named after the file extensions
+        string importFormat = format;
+        if(importFormat.empty()) {
+            string::size_type dot = inputFileName.find_last_of('.');
+            if(dot != string::npos) {
+                importFormat = inputFileName.substr(dot + 1);
             }
         }
+        boost::algorithm::to_lower(importFormat);
+
+        m_inputFileName.clear();
+        FamilyTreeOpResultCode result = constructTreeFromGraph(inputFileName, importFormat);
+        if(result != SUCCESS) {
+            return result;
+        }
+
+        buildStaleMaterializedViews();
 
-        return pFamilyMember;
+        return SUCCESS;
     }
 
-    FamilyTreeOpResultCode FamilyTreeClass::getGrandparentsList
-	(
-		string const & memberName,
-		vector<FamilyMemberClass *> & list
-    ) {
-    	// Retrieve the FamilyMemberClass objects for
-		// the specified family member.  Return error
-		// if one of them is not present in the tree.
-    	FamilyMemberClass * pFamilyMember = findFamilyMember(memberName);
-    	if(pFamilyMember == NULL) {
-			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str())
-			return FAMILY_MEMBER_NOT_FOUND;
-		}
+    void FamilyTreeClass::clearTree() {
+        // Every member, relationship and attribute is in
+        // the arena so they are all freed together
+        m_Arena.reset();
+        m_pFreeRelationships = NULL;
+        m_Members.clear();
+        m_FreeMemberIds.clear();
+        m_MemberIndex.clear();
+        m_NameFilter.reset(FamilyTreeNameFilter::MIN_CAPACITY);
+        m_NamesVersion++;
+        m_ChildCounts.clear();
+        m_SiblingCounts.clear();
+        m_GrandchildCounts.clear();
+        m_AttributeColumns.clear();
+        m_Generations.clear();
+        m_Kinship.clear();
+        m_FamilyUnits.clear();
+        m_Families.clear();
+        m_FamiliesStale = false;
+        for(map<string, FamilyTreeMaterializedView>::iterator it = m_MaterializedViews.begin(); it != m_MaterializedViews.end(); ++it) {
+            it->second.markStale();
+        }
+        m_inputFileOffset = 0;
+        m_DuplicatesSkipped = 0;
+        bumpStructureVersion();
+    }
 
-    	// Clear the vector
-    	list.clear();
+    void FamilyTreeClass::rebuildNameFilter() {
+        // Double the capacity and add the names of the members
+        // that are in the tree (dropping the removed names)
+        m_NameFilter.reset(m_MemberIndex.size() * 2);
+        for(unordered_map<string, uint32_t>::const_iterator it = m_MemberIndex.begin(); it != m_MemberIndex.end(); ++it) {
+            m_NameFilter.add(it->first);
+        }
+    }
 
-    	// Retrieve the set of from edges connected to this vertex
-		// where "from" edge means the edge is directed from the vertex
-		EdgeSet childAdjacentEdges = pFamilyMember->CollectIncidentEdges(false, true, false);
+    uint32_t FamilyTreeClass::findFamilyMemberId(string const & memberName) const {
+        if(m_NameFilter.mayContain(memberName) == false) {
+            return INVALID_MEMBER_ID;
+        }
 
-		// Find the parent of each parent of pFamilyMember.  Store
-		// pointers to each of these FamilyMemberClass objects in
-		// grandParentList.  These are the pointers to each grandparent
-		// of pFamilyMember
-		for (unsigned int i = 0; i < childAdjacentEdges.size(); i++) {
-			Edge * const childParentEdge = childAdjacentEdges[i];
-			IntAttribute * pRelationshipAttr = (IntAttribute *)childParentEdge->GetAttribute("Relationship");
-
-			// If this edge has a child->parent relationship
-			// then the "to" vertex is the parent of pFamilyMember
-			if(pRelationshipAttr->Value == Child_Parent) {
-				FamilyMemberClass * pParent = (FamilyMemberClass *)childParentEdge->To();
-
-				// Retrieve the set of from edges connected to this vertex
-				// where "from" edge means the edge is directed from the vertex
-				EdgeSet childAdjacentEdges = pParent->CollectIncidentEdges(false, true, false);
-
-				// Find the grandparent of pFamilyMember
-				// (the parent of pParent)
-				for (unsigned int j = 0; j < childAdjacentEdges.size(); j++) {
-					Edge * const parentGrandparentEdge = childAdjacentEdges[j];
-					IntAttribute * pRelationshipAttr = (IntAttribute *)parentGrandparentEdge->GetAttribute("Relationship");
-
-					// If this is a child->parent edge,
-					// get the parent vertex.  This is the
-					// grandparent of memberName
-					if(pRelationshipAttr->Value == Child_Parent) {
-						list.push_back((FamilyMemberClass *)parentGrandparentEdge->To());
-					}
-				}
-			}
-		}
+        return findIndexedMemberId(memberName);
+    }
 
-		// If we reach here, everything is fine.
-		// Return SUCCESS.
-    	return SUCCESS;
+    uint32_t FamilyTreeClass::findIndexedMemberId(string const & memberName) const {
+        unordered_map<string, uint32_t>::const_iterator it = m_MemberIndex.find(memberName);
+        if(it == m_MemberIndex.end()) {
+            return INVALID_MEMBER_ID;
+        }
+
+        return it->second;
+    }
+
+    FamilyRelationshipClass * FamilyTreeClass::findRelationship(uint32_t fromId, uint32_t toId, relationship_t relationship) {
+        // Search the relationships directed from the from
+        // member for one that goes to the to member and
+        // has the specified relationship
+        uint32_t typeMask = FamilyRelationshipClass::typeBit(relationship);
+        FamilyMemberClass * toMember = m_Members[toId];
+        FamilyRelationshipClass * pRelationship = m_Members[fromId]->getFirstOutgoingRelationship();
+        for (; pRelationship != NULL; pRelationship = pRelationship->getNextOutgoing()) {
+            if(pRelationship->matchesAny(typeMask) && pRelationship->getTo() == toMember) {
+                return pRelationship;
+            }
+        }
+
+        return NULL;
+    }
 
+    void FamilyTreeClass::updateCountsForParentChild(uint32_t parentId, uint32_t childId, int64_t delta) {
+        // The parent gains (or loses) one child and
+        // all of the children of that child as grandchildren
+        m_ChildCounts.adjustCount(parentId, delta);
+        m_GrandchildCounts.adjustCount(parentId, delta * m_ChildCounts.getCount(childId));
+
+        // Each parent of the parent gains (or loses) one grandchild
+        FamilyMemberSpan parents = m_Members[parentId]->getParents();
+        for (FamilyMemberSpan::const_iterator it = parents.begin(); it != parents.end(); ++it) {
+            m_GrandchildCounts.adjustCount((*it)->getId(), delta);
+        }
     }
 
-    FamilyTreeOpResultCode FamilyTreeClass::getChildrenList
+    void FamilyTreeClass::getGrandparentsList
 	(
-		string const & memberName,
+		uint32_t memberId,
 		vector<FamilyMemberClass *> & list
     ) {
-    	// Retrieve the FamilyMemberClass objects for
-		// the specified family member.  Return error
-		// if one of them is not present in the tree.
-    	FamilyMemberClass * pFamilyMember = findFamilyMember(memberName);
-    	if(pFamilyMember == NULL) {
-			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str())
-			return FAMILY_MEMBER_NOT_FOUND;
-		}
-
     	// Clear the vector
     	list.clear();
 
-    	// Retrieve the set of from edges connected to this vertex
-		// where "from" edge means the edge is directed from the vertex
-		EdgeSet memberAdjacentEdges = pFamilyMember->CollectIncidentEdges(false, true, false);
-
-		// Find the parent of each parent of pFamilyMember.  Store
+		// Find the parent of each parent of the member.  Store
 		// pointers to each of these FamilyMemberClass objects in
-		// grandParentList.  These are the pointers to each grandparent
-		// of pFamilyMember
-		for (unsigned int i = 0; i < memberAdjacentEdges.size(); i++) {
-			Edge * const currentMemberEdge = memberAdjacentEdges[i];
-			IntAttribute * pRelationshipAttr = (IntAttribute *)currentMemberEdge->GetAttribute("Relationship");
-
-			// If this is a parent->child edge,
-			// get the child vertex.  This is a
-			// child of memberName
-			if(pRelationshipAttr->Value == Parent_Child) {
-				list.push_back((FamilyMemberClass *)currentMemberEdge->To());
-			}
+		// list.  These are the pointers to each grandparent
+		// of the member
+		FamilyMemberSpan parents = m_Members[memberId]->getParents();
+		for (FamilyMemberSpan::const_iterator it = parents.begin(); it != parents.end(); ++it) {
+			FamilyMemberSpan grandparents = (*it)->getParents();
+			list.insert(list.end(), grandparents.begin(), grandparents.end());
 		}
-
-    	return SUCCESS;
     }
 
-    FamilyTreeOpResultCode FamilyTreeClass::getSiblingList
+    void FamilyTreeClass::getChildrenList
 	(
-		string const & memberName,
+		uint32_t memberId,
 		vector<FamilyMemberClass *> & list
     ) {
-    	// Retrieve the FamilyMemberClass objects for
-		// the specified family member.  Return error
-		// if the family member is not present in the tree.
-    	FamilyMemberClass * pFamilyMember = findFamilyMember(memberName);
-    	if(pFamilyMember == NULL) {
-			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str())
-			return FAMILY_MEMBER_NOT_FOUND;
-		}
-
-    	// Clear the vector
-    	list.clear();
+		// Copy the children of the member from its adjacency cache
+		FamilyMemberSpan children = m_Members[memberId]->getChildren();
+		list.assign(children.begin(), children.end());
+    }
 
-    	// Retrieve the set of from edges connected to this vertex
-		// where "from" edge means the edge is directed from the vertex
-		EdgeSet memberAdjacentEdges = pFamilyMember->CollectIncidentEdges(false, true, false);
+    void FamilyTreeClass::getSiblingList
+	(
+		uint32_t memberId,
+		vector<FamilyMemberClass *> & list
+    ) {
+		// Copy the siblings of the member from its adjacency cache
+		FamilyMemberSpan siblings = m_Members[memberId]->getSiblings();
+		list.assign(siblings.begin(), siblings.end());
+    }
 
-		// Find the parent of each parent of pFamilyMember.  Store
-		// pointers to each of these FamilyMemberClass objects in
-		// grandParentList.  These are the pointers to each grandparent
-		// of pFamilyMember
-		for (unsigned int i = 0; i < memberAdjacentEdges.size(); i++) {
-			Edge * const currentMemberEdge = memberAdjacentEdges[i];
-			IntAttribute * pRelationshipAttr = (IntAttribute *)currentMemberEdge->GetAttribute("Relationship");
+    void FamilyTreeClass::buildQueryNameList
+	(
+		FamilyTreeResultCache::query_kind_t queryKind,
+		uint32_t memberId,
+		vector<string> & nameList
+	) {
+    	// Retrieve the members the query returns
+    	vector<FamilyMemberClass *> memberList;
+    	switch(queryKind) {
+    		case FamilyTreeResultCache::Query_Grandparents:
+    			getGrandparentsList(memberId, memberList);
+    			break;
+
+    		case FamilyTreeResultCache::Query_Children:
+    			getChildrenList(memberId, memberList);
+    			break;
+
+    		case FamilyTreeResultCache::Query_Siblings:
+    			getSiblingList(memberId, memberList);
+    			break;
+    	}
 
-			// If this is a parent->child edge,
-			// get the child vertex.  This is a
-			// child of memberName
-			if(pRelationshipAttr->Value == Sibling) {
-				list.push_back((FamilyMemberClass *)currentMemberEdge->To());
-			}
-		}
+    	// Clear the input list
+    	nameList.clear();
+    	nameList.reserve(memberList.size());
 
-    	return SUCCESS;
+    	// Create the list of name strings
+    	for(vector<FamilyMemberClass *>::iterator it = memberList.begin() ; it != memberList.end(); ++it) {
+    		nameList.push_back((*it)->getName());
+    	}
     }
 
-    FamilyTreeOpResultCode FamilyTreeClass::getGrandparentNameList
+    FamilyTreeOpResultCode FamilyTreeClass::getQueryNameList
 	(
+		FamilyTreeResultCache::query_kind_t queryKind,
 		string const & memberName,
-		vector<string> & grandparentStringList
+		name_list_row_t & nameList
 	) {
-    	// Retrieve the list of grandparents for memberName
-    	// If there is an error, return the error
-    	vector<FamilyMemberClass *> grandParentList;
-    	FamilyTreeOpResultCode result = getGrandparentsList(memberName, grandParentList);
-    	if(result != SUCCESS) {
-    		FamilyTreeErrorMsg(LOG_ERROR, "Failed to retrieve grandparent name list for %s.", memberName.c_str());
-    		return result;
+    	// Unknown names are common (misspelled or foreign
+    	// names), so this path does not log.  The name filter
+    	// rejects most of them before the cache or the name
+    	// index is read.
+    	if(m_NameFilter.mayContain(memberName) == false) {
+    		return FAMILY_MEMBER_NOT_FOUND;
     	}
 
-    	// Clear the input list
-    	grandparentStringList.clear();
+    	// Return the cached result if this query has been answered
+    	// since the tree last changed.  Results are cached by name,
+    	// so a hit does not read the name index.
+    	if(m_ResultCache.lookup(queryKind, memberName, 0, m_StructureVersion, nameList)) {
+    		return SUCCESS;
+    	}
 
-    	// Create the list of grandparent name strings
-    	for(vector<FamilyMemberClass *>::iterator it = grandParentList.begin() ; it != grandParentList.end(); ++it) {
-    		FamilyMemberClass * pGrandParent = (*it);
-    		grandparentStringList.push_back(pGrandParent->GetLabel("Member_Name"));
+    	uint32_t memberId = findIndexedMemberId(memberName);
+    	if(memberId == INVALID_MEMBER_ID) {
+    		return FAMILY_MEMBER_NOT_FOUND;
     	}
 
+    	std::shared_ptr<vector<string> > pNameList = std::make_shared<vector<string> >();
+    	buildQueryNameList(queryKind, memberId, *pNameList);
+    	nameList = pNameList;
+
+    	m_ResultCache.insert(queryKind, memberName, 0, m_StructureVersion, nameList);
+
     	return SUCCESS;
     }
 
-
-    FamilyTreeOpResultCode FamilyTreeClass::getChildrenNameList
+    FamilyTreeOpResultCode FamilyTreeClass::getQueryNameList
 	(
+		FamilyTreeResultCache::query_kind_t queryKind,
 		string const & memberName,
 		vector<string> & nameList
 	) {
-    	vector<FamilyMemberClass *> childrenList;
-    	FamilyTreeOpResultCode result = getChildrenList(memberName, childrenList);
-    	if(result != SUCCESS) {
-    		FamilyTreeErrorMsg(LOG_ERROR, "Failed to retrieve children name list for %s.", memberName.c_str());
+    	// With the result cache enabled the result is
+    	// shared with the cache and copied out of it
+    	if(m_ResultCache.isEnabled()) {
+    		name_list_row_t cachedNameList;
+    		FamilyTreeOpResultCode result = getQueryNameList(queryKind, memberName, cachedNameList);
+    		if(result == SUCCESS) {
+    			nameList = *cachedNameList;
+    		}
     		return result;
     	}
 
-    	// Clear the input list
-    	nameList.clear();
-
-    	// Create the list of children name strings
-    	for(vector<FamilyMemberClass *>::iterator it = childrenList.begin() ; it != childrenList.end(); ++it) {
-    		FamilyMemberClass * pChild = (*it);
-    		nameList.push_back(pChild->GetLabel("Member_Name"));
+    	// Otherwise the names are built straight into nameList
+    	uint32_t memberId = findFamilyMemberId(memberName);
+    	if(memberId == INVALID_MEMBER_ID) {
+    		return FAMILY_MEMBER_NOT_FOUND;
     	}
 
+    	buildQueryNameList(queryKind, memberId, nameList);
+
     	return SUCCESS;
     }
 
+    FamilyTreeOpResultCode FamilyTreeClass::getGrandparentNameList
+	(
+		string const & memberName,
+		vector<string> & grandparentStringList
+	) {
+    	return getQueryNameList(FamilyTreeResultCache::Query_Grandparents, memberName, grandparentStringList);
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::getChildrenNameList
+	(
+		string const & memberName,
+		vector<string> & nameList
+	) {
+    	return getQueryNameList(FamilyTreeResultCache::Query_Children, memberName, nameList);
+    }
+
     FamilyTreeOpResultCode FamilyTreeClass::getSiblingNameList
 	(
 		string const & memberName,
 		vector<string> & nameList
 	) {
-    	vector<FamilyMemberClass *> siblingList;
-    	FamilyTreeOpResultCode result = getSiblingList(memberName, siblingList);
-    	if(result != SUCCESS) {
-    		FamilyTreeErrorMsg(LOG_ERROR, "Failed to retrieve sibling name list for %s.", memberName.c_str());
-    		return result;
-    	}
+    	return getQueryNameList(FamilyTreeResultCache::Query_Siblings, memberName, nameList);
+    }
 
-    	// Clear the input list
-    	nameList.clear();
+    FamilyTreeOpResultCode FamilyTreeClass::getGrandparentNameList
+	(
+		string const & memberName,
+		name_list_row_t & nameList
+	) {
+    	return getQueryNameList(FamilyTreeResultCache::Query_Grandparents, memberName, nameList);
+    }
 
-    	// Create the list of sibling name strings
-    	for(vector<FamilyMemberClass *>::iterator it = siblingList.begin() ; it != siblingList.end(); ++it) {
-    		FamilyMemberClass * pSibling = (*it);
-    		nameList.push_back(pSibling->GetLabel("Member_Name"));
-    	}
+    FamilyTreeOpResultCode FamilyTreeClass::getChildrenNameList
+	(
+		string const & memberName,
+		name_list_row_t & nameList
+	) {
+    	return getQueryNameList(FamilyTreeResultCache::Query_Children, memberName, nameList);
+    }
 
-    	return SUCCESS;
+    FamilyTreeOpResultCode FamilyTreeClass::getSiblingNameList
+	(
+		string const & memberName,
+		name_list_row_t & nameList
+	) {
+    	return getQueryNameList(FamilyTreeResultCache::Query_Siblings, memberName, nameList);
     }
 
     FamilyTreeOpResultCode FamilyTreeClass::getFamilyMembersNameList(vector<string> & nameList) {
@@ -278,12 +373,12 @@ namespace FamilyTree {
     	// CLear the list
     	nameList.clear();
 
-    	// Search the list of vertices and add
-    	// the label to the nameList.
-    	// For now, the label of each vertex
-    	// stores the name of that family member
-		for(VertexIterator it = m_Graph.BeginVertices(); it != m_Graph.EndVertices(); it++) {
-			nameList.push_back((*it)->GetLabel("Member_Name"));
+    	// Add the name of every member in the tree
+    	// (skipping the entries of removed members)
+		for(vector<FamilyMemberClass *>::iterator it = m_Members.begin(); it != m_Members.end(); ++it) {
+			if((*it) != NULL) {
+				nameList.push_back((*it)->getName());
+			}
 		}
 
 		return SUCCESS;
@@ -298,11 +393,9 @@ namespace FamilyTree {
     	nameList.clear();
 
     	// Find the names of the members that have children count == count
-		for(ConstVertexIterator it = m_Graph.BeginVertices(); it != m_Graph.EndVertices(); ++it) {
-			FamilyMemberClass * pCurrentMember = (FamilyMemberClass *)(*it);
-			if(pCurrentMember->getNumberOfChildren() == count) {
-				nameList.push_back(pCurrentMember->GetLabel("Member_Name"));
-			}
+		const vector<uint32_t> & memberIds = m_ChildCounts.getMembersWithCount(count);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			nameList.push_back(m_Members[*it]->getName());
 		}
 
 		return SUCCESS;
@@ -316,359 +409,3290 @@ namespace FamilyTree {
 		// Clear the nameList
 		nameList.clear();
 
-		// Find the names of the members that have children count == count
-		for(ConstVertexIterator it = m_Graph.BeginVertices(); it != m_Graph.EndVertices(); ++it) {
-			FamilyMemberClass * pCurrentMember = (FamilyMemberClass *)(*it);
-			if(pCurrentMember->getNumberOfSiblings() == count) {
-				nameList.push_back(pCurrentMember->GetLabel("Member_Name"));
-			}
+		// Find the names of the members that have sibling count == count
+		const vector<uint32_t> & memberIds = m_SiblingCounts.getMembersWithCount(count);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			nameList.push_back(m_Members[*it]->getName());
 		}
 
 		return SUCCESS;
 	}
 
-    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithMostGrandchildren(vector<string> & nameList) {
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithSiblingCount
+	(
+		uint32_t count,
+		sibling_kind_t kind,
+		vector<string> & nameList
+	) {
+		if(kind == Siblings_Declared) {
+			return getMembersWithSiblingCount(count, nameList);
+		}
+
 		// Clear the nameList
 		nameList.clear();
 
-		FamilyTreeOpResultCode resultCode;
-		uint32_t largestGrandChildrenCount = 0;
-
-		// Iterate through each family member and get the list of grandchildren.
-		// 1. If the list of grandchildren for the current member > largestGrandChildrenCount,
-		//    then clear the list, add the current member to the nameList, and
-		//    update the largestGrandChildrenCount value.
-		//
-		// 2. If the list of grandchildren for current member == largestGrandChildrenCount,
-		//    then current member has the same number of grandchildren as the
-		//    largestGrandChildrenCount.  Add current member to the list.
-		//
-		// 3. Otherwise, do nothing.
-
-		for(ConstVertexIterator itParent = m_Graph.BeginVertices(); itParent != m_Graph.EndVertices(); ++itParent) {
-			// Current vertex is the parent
-			FamilyMemberClass * pParent = (FamilyMemberClass *)(*itParent);
-
-			// Get the list of children of the parent
-			// If this is not possible, print log message
-			// and return the error code
-			vector<FamilyMemberClass *> childrenList;
-			resultCode = getChildrenList(pParent->GetLabel("Member_Name"), childrenList);
-			if(resultCode != SUCCESS) {
-				FamilyTreeErrorMsg
-				(
-					LOG_ERROR, "Unable to retrieve children name list for %s.",
-					pParent->GetLabel("Member_Name").c_str()
-				);
-				return resultCode;
-			}
-			// Iterate through the children of pParent
-			for(vector<FamilyMemberClass *>::iterator itChild = childrenList.begin(); itChild != childrenList.end(); ++itChild) {
-				// Current vertex is a child of pParent.
-				FamilyMemberClass * pChild = (*itChild);
-
-				if(pChild->getNumberOfChildren() > largestGrandChildrenCount) {
-					// If the current child has more children than largestGrandChildrenCount
-					// then pParent has more grandchildren than the previous family members
-					// in mameList.  Clear the list, add pParent to the list and update
-					// largestGrandChildrenCount with the count of pChild children count.
-					nameList.clear();
-					nameList.push_back(pParent->GetLabel("Member_Name"));
-					largestGrandChildrenCount = pChild->getNumberOfChildren();
-				}
-				else if(pChild->getNumberOfChildren() == largestGrandChildrenCount) {
-					// If the current child has the same number of children as largestGrandChildrenCount
-					// then pParent has the same number of grandchildren than the current members
-					// in mameList. Just add pParent to the list.
-					nameList.push_back(pParent->GetLabel("Member_Name"));
-				}
-				else {
-					// Do nothing
-				}
-			}
+		// The full and half sibling counts of every member are
+		// kept up to date together with the family units
+		FamilyTreeCountIndex const & countIndex = (kind == Siblings_Full) ?
+			m_FamilyUnits.getFullSiblingCounts() : m_FamilyUnits.getHalfSiblingCounts();
+
+		const vector<uint32_t> & memberIds = countIndex.getMembersWithCount(count);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			nameList.push_back(m_Members[*it]->getName());
 		}
 
 		return SUCCESS;
 	}
 
-    FamilyTreeOpResultCode FamilyTreeClass::addRelationship
-    (
-        string const & from,
-        string const & to,
-        relationship_t relationship
-    ) {
-    	// Retrieve the FamilyMemberClass objects for
-    	// the from and to family members.  Return
-    	// error if one of them is not present in the tree.
-        FamilyMemberClass * fromMember = findFamilyMember(from);
-        if(fromMember == NULL) {
-			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", from.c_str());
-        	return FAMILY_MEMBER_NOT_FOUND;
-        }
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithMostGrandchildren(vector<string> & nameList) {
+		// Clear the nameList
+		nameList.clear();
 
-        FamilyMemberClass * toMember = findFamilyMember(to);
-        if(fromMember == NULL) {
-			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", to.c_str());
-			return FAMILY_MEMBER_NOT_FOUND;
+		// The grandchild count of every member is kept
+		// up to date in m_GrandchildCounts.  The members
+		// with the most grandchildren are the ones in the
+		// bucket of the largest count.  If nobody has any
+		// grandchildren the list is left empty.
+		uint32_t largestGrandChildrenCount = m_GrandchildCounts.getMaxCount();
+		if(largestGrandChildrenCount == 0) {
+			return SUCCESS;
 		}
 
-        // Create new directed edge where fromMemer is the
-        // out vertex (start) and toMember is the in vertex (the endpoint)
-        EdgeIterator newEdgeIterator = m_Graph.AddArc((Vertex *)fromMember, (Vertex *)toMember);
-        
-        // Get pointer to edge and make sure it is
-        // a valid directed edge valid
-        Edge * newEdge = *newEdgeIterator;
-        if(newEdge == NULL) {
-            // Print error Message
-            FamilyTreeErrorMsg(LOG_ERROR, "Failed to add directed edge %s->%s to the graph.",
-            	from.c_str(),
-				to.c_str()
-			);
-
-            // Remove the edge from the graph
-            m_Graph.RemoveEdge(newEdgeIterator);
-            
-            // Return error code
-            return ADD_EDGE_ERROR;
-        }
-        
-        if(newEdge->IsDirected() == false) {
-            // Print error Message
-            FamilyTreeErrorMsg(LOG_ERROR, "Directed edge %s->%s was not created as a proper directed edge.",
-				from.c_str(),
-				to.c_str()
-			);
-            // Remove the edge from the graph
-            m_Graph.RemoveEdge(newEdgeIterator);
-            
-            // Return error code
-            return ADD_EDGE_ERROR;
-        }
-        
-        // Add relationship attribute to the edge
-        // If this fails, remove the ege and
-        // return error
-        IntAttribute * relationshipAttribute = (IntAttribute *)newEdge->AddAttribute("Relationship", "int");
-        if(relationshipAttribute == NULL) {
-            // Print error Message
-            FamilyTreeErrorMsg(LOG_ERROR, "Relationship attribute %s for directed edge %s->%s was not added properly.",
-            	from.c_str(),
-				to.c_str()
-			);
-
-            // Remove the edge from the graph
-            m_Graph.RemoveEdge(newEdgeIterator);
-            
-            // Return error code
-            return ADD_EDGE_ERROR;
-        }
-        
-        // Set the value of the edge attribute to the specified relationship
-        relationshipAttribute->Value = relationship;
-   
-        // If we have reached here, everything is correct
-        // Return SUCCESS
-        return SUCCESS;
-    }
-    
-    FamilyTreeOpResultCode FamilyTreeClass::constructTreeFromFile(string const & inputFileName) {
-    
-        // Try and open the input file
-        ifstream infile(inputFileName.c_str());
-  
-        if(infile.is_open() == false) {
-            // Print error Message
-            FamilyTreeErrorMsg(LOG_ERROR, "Could not open the file: %s", inputFileName.c_str());
+		const vector<uint32_t> & memberIds = m_GrandchildCounts.getMembersWithCount(largestGrandChildrenCount);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			nameList.push_back(m_Members[*it]->getName());
+		}
 
-            // Close input file
-            infile.close();
+		return SUCCESS;
+	}
 
-            // Return error code
-            return INPUT_FILE_OPEN_ERROR;
-        }
-        
-        // Read from input file line by line and construct the tree
-        string currentLine;
-        while(getline(infile, currentLine)) {
-            // Skip comment lines or white space lines
-        	if(currentLine[0] == '#' || currentLine[0] == '/' || currentLine == "") {
-            	continue;
-            }
-
-        	// Split the current line into tokens based on the delimeter
-            vector<string> currentLineTokens;
-            boost::split(currentLineTokens, currentLine, boost::is_any_of(":"));
-            
-            // Create the member objects and add them as vertices to the graph
-            if(currentLineTokens[0].compare("MEMBERS") == 0) {
-            	FamilyTreeLogMsg(LOG_DEBUG, "Adding %d family members to the family tree", currentLineTokens.size() - 1);
-                for(unsigned int i = 1; i < currentLineTokens.size(); i++) {
-                    // Add the vertex to the graph
-                    VertexIterator currentVertexIterator = m_Graph.AddVertex();
-                    
-                    // Get pointer to vertex within the iterator and make sure it is valid
-                    Vertex * currentVertex = *currentVertexIterator;
-                    if(currentVertex == NULL) {
-                        // Print error Message
-                        FamilyTreeErrorMsg(LOG_ERROR, "Failed to add directed vertex to graph");
-
-                        // Remove the edge from the graph
-                        m_Graph.RemoveVertex(currentVertex, true);
-
-                        // Return error code
-                        return ADD_VERTEX_ERROR;
-                    }
-                    
-                    // Add a label to the Vertex
-                    currentVertex->SetLabel(currentLineTokens[i], "Member_Name");
-
-                    // Add a StringAttribute to the new member object
-                    StringAttribute * memberName =
-                            (StringAttribute *)currentVertex->AddAttribute("Member_FirstName", "string");
-                    
-                    // Set the name of the family member
-                    memberName->Value = currentLineTokens[i];
-
-                    FamilyTreeLogMsg(LOG_DEBUG, "Added family member %s to the family tree",
-                    	currentVertex->GetLabel("Member_Name").c_str());
-                }
-            }
-            else if (currentLineTokens[0].compare("PARENT") == 0) {
-            	FamilyTreeLogMsg(LOG_DEBUG, "Adding the parent-child relationships to the family tree");
-            	// Find the parent vertex
-                string parentName = currentLineTokens[1];
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithCountInRange
+	(
+		FamilyTreeCountIndex const & countIndex,
+		uint32_t minCount,
+		uint32_t maxCount,
+		vector<string> & nameList
+	) {
+		// Clear the nameList
+		nameList.clear();
 
-                FamilyTreeLogMsg
-				(
-					LOG_DEBUG,
-					"Adding the parent->child and child->parent relationships for parent %s to the family tree.",
-					parentName.c_str()
-                );
+		if(minCount > maxCount) {
+			FamilyTreeErrorMsg(LOG_ERROR, "Invalid count range %u-%u.", minCount, maxCount);
+			return INVALID_ARG;
+		}
 
-                // For each child, add a parent->child edge to the graph
-                for(unsigned int i = 3; i < currentLineTokens.size(); i++) {
-                    // Find the child vertex
-                    string currentChildName = currentLineTokens[i];
-                    
-                    // Add the parent->child relationship to the graph
-                    if(addRelationship(parentName, currentChildName, Parent_Child) != SUCCESS) {
-                        // Log error message
-                        FamilyTreeErrorMsg(
-                        	LOG_ERROR,
-							"Failed to add the parent->child relationship %s->%s to the family tree",
-							parentName.c_str(),
-							currentChildName.c_str()
-                        );
-                        
-                        // Close input file
-                        infile.close();
+		uint32_t numberOfMembers = countIndex.getSize();
+		if(numberOfMembers == 0) {
+			return SUCCESS;
+		}
 
-                        // return error
-                        return TREE_CONSTRUCTION_ERROR;
-                    }
-                    else {
-						FamilyTreeLogMsg(
-							LOG_DEBUG,
-							"Successfully added the parent->child relationship %s->%s to the family tree",
-							parentName.c_str(),
-							currentChildName.c_str()
-						);
-                    }
+		// Scan the whole count column with the SIMD kernel.
+		// The entries of removed members have a count of 0
+		// so they are skipped when the names are looked up.
+		vector<uint32_t> memberIds(numberOfMembers + FamilyTreeScanKernels::OUTPUT_PADDING);
+		uint32_t numberOfMatches = FamilyTreeScanKernels::scanRange(countIndex.getCounts(), numberOfMembers,
+			minCount, maxCount, &memberIds[0]);
+
+		for(uint32_t i = 0; i < numberOfMatches; i++) {
+			FamilyMemberClass * pFamilyMember = m_Members[memberIds[i]];
+			if(pFamilyMember != NULL) {
+				nameList.push_back(pFamilyMember->getName());
+			}
+		}
 
-                    // Add the child->parent relationship to the graph
-                    if(addRelationship(currentChildName, parentName, Child_Parent) != SUCCESS) {
-						// Log error message
-						FamilyTreeErrorMsg(
-							LOG_ERROR,
-							"Failed to add the child->parent relationship %s->%s to the family tree",
-							currentChildName.c_str(),
-							parentName.c_str()
-						);
-						// Close input file
-						infile.close();
-
-						// return error
-						return TREE_CONSTRUCTION_ERROR;
-					}
-					else {
-						FamilyTreeLogMsg(
-							LOG_DEBUG,
-							"Successfully added the child->parent relationship %s->%s to the family tree",
-							currentChildName.c_str(),
-							parentName.c_str()
-						);
-					}
-                }
-            }
-            else if (currentLineTokens[0].compare("SIBLINGS") == 0) {
-            	FamilyTreeLogMsg(LOG_DEBUG, "Adding the sibling relationships to the family tree");
-            	// Loop through the sibling entries and add
-            	// link them together.  Siblings should have
-            	// directed edges to and from one another
-                for(unsigned int i = 1; i < currentLineTokens.size(); i++) {
-                	// Find the mainSibling vertex
-                	string mainSiblingName = currentLineTokens[i];
-
-                	for(unsigned int j = 1; j < currentLineTokens.size(); j++) {
-                		// Do not add a relationship for sibling to itself
-                		if(i == j) {
-                			continue;
-                		}
-
-                		// Find the other sibling vertex
-						string currentSiblingName = currentLineTokens[j];
-						FamilyTreeLogMsg
-						(
-							LOG_DEBUG,
-							"Adding the %s->%s sibling relationships to the family tree.",
-							mainSiblingName.c_str(),
-							currentSiblingName.c_str()
-						);
-
-						// Add the sibling->sibling relationship to the graph
-						if(addRelationship(mainSiblingName, currentSiblingName, Sibling) != SUCCESS) {
-							// Log error message
-							FamilyTreeErrorMsg(
-								LOG_ERROR,
-								"Failed to add the %s->%s sibling relationship to the family tree",
-								mainSiblingName.c_str(),
-								currentSiblingName.c_str()
-							);
-							// Close input file
-							infile.close();
-
-							// return error
-							return TREE_CONSTRUCTION_ERROR;
-						}
-						else {
-							// Log error message
-							FamilyTreeLogMsg(
-								LOG_DEBUG,
-								"Successfully added the %s->%s sibling to the family tree",
-								mainSiblingName.c_str(),
-								currentSiblingName.c_str()
-							);
-						}
-                	}
-                }
-            }
-            else {
-                // Print error Message
-                FamilyTreeErrorMsg(LOG_ERROR, "Input file formatted incorrectly");
-                
-                // Close input file
-                infile.close();
-                
-                // Return false
-                return INPUT_FILE_FORMAT_ERROR;
-            }
-        }
+		return SUCCESS;
+	}
 
-        // Close input file
-		infile.close();
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithChildCountInRange
+	(
+		uint32_t minCount,
+		uint32_t maxCount,
+		vector<string> & nameList
+	) {
+		return getMembersWithCountInRange(m_ChildCounts, minCount, maxCount, nameList);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithSiblingCountInRange
+	(
+		uint32_t minCount,
+		uint32_t maxCount,
+		vector<string> & nameList
+	) {
+		return getMembersWithCountInRange(m_SiblingCounts, minCount, maxCount, nameList);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithGrandchildCountInRange
+	(
+		uint32_t minCount,
+		uint32_t maxCount,
+		vector<string> & nameList
+	) {
+		return getMembersWithCountInRange(m_GrandchildCounts, minCount, maxCount, nameList);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::setMemberAttributes
+	(
+		string const & memberName,
+		member_attributes_t const & attributes
+	) {
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		m_AttributeColumns.setAttributes(memberId, attributes);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMemberAttributes
+	(
+		string const & memberName,
+		member_attributes_t & attributes
+	) {
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		m_AttributeColumns.getAttributes(memberId, attributes);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersMatchingFilter
+	(
+		member_filter_t const & filter,
+		vector<string> & nameList
+	) {
+		// Clear the nameList
+		nameList.clear();
+
+		if(m_Members.empty()) {
+			return SUCCESS;
+		}
+
+		// Scan the attribute columns and the child count
+		// column together and look up only the matches
+		vector<uint32_t> memberIds;
+		m_AttributeColumns.findMembers(filter, m_ChildCounts.getCounts(), memberIds);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			nameList.push_back(m_Members[*it]->getName());
+		}
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::updateGenerations() {
+        if(m_GenerationsVersion == m_StructureVersion) {
+            return;
+        }
+
+        // Visit the members in topological order of the
+        // parent->child relationships, starting with the
+        // members that have no parents.  Members that are
+        // never visited are part of a cycle.
+        uint32_t numberOfMembers = m_Members.size();
+        m_Generations.assign(numberOfMembers, INVALID_GENERATION);
+        vector<uint32_t> remainingParents(numberOfMembers, 0);
+        vector<uint32_t> queue;
+        queue.reserve(numberOfMembers);
+
+        for(uint32_t i = 0; i < numberOfMembers; i++) {
+            if(m_Members[i] == NULL) {
+                continue;
+            }
+
+            remainingParents[i] = m_Members[i]->getParents().size();
+            if(remainingParents[i] == 0) {
+                m_Generations[i] = 0;
+                queue.push_back(i);
+            }
+        }
+
+        for(uint32_t head = 0; head < queue.size(); head++) {
+            uint32_t parentGeneration = m_Generations[queue[head]];
+            FamilyMemberSpan children = m_Members[queue[head]]->getChildren();
+            for(FamilyMemberSpan::const_iterator it = children.begin(); it != children.end(); ++it) {
+                uint32_t childId = (*it)->getId();
+
+                // The generation of the child is one more than
+                // its youngest (largest generation) parent
+                if(m_Generations[childId] == INVALID_GENERATION || m_Generations[childId] <= parentGeneration) {
+                    m_Generations[childId] = parentGeneration + 1;
+                }
+
+                if(--remainingParents[childId] == 0) {
+                    queue.push_back(childId);
+                }
+            }
+        }
+
+        // Members left with parents to visit are in a cycle
+        for(uint32_t i = 0; i < numberOfMembers; i++) {
+            if(remainingParents[i] != 0) {
+                m_Generations[i] = INVALID_GENERATION;
+            }
+        }
+
+        m_GenerationsVersion = m_StructureVersion;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::buildConditionBitmap
+	(
+		range_condition_t const & condition,
+		FamilyTreeMemberBitmap & bitmap
+	) {
+		uint32_t numberOfMembers = m_Members.size();
+		const uint32_t * pColumn = NULL;
+
+		// Largest value of the column that is a real value
+		uint32_t maxColumnValue = UINT32_MAX;
+
+		switch(condition.field) {
+			case Field_ChildCount:
+				pColumn = m_ChildCounts.getCounts();
+				break;
+			case Field_SiblingCount:
+				pColumn = m_SiblingCounts.getCounts();
+				break;
+			case Field_GrandchildCount:
+				pColumn = m_GrandchildCounts.getCounts();
+				break;
+			case Field_Generation:
+				updateGenerations();
+				pColumn = m_Generations.empty() ? NULL : &m_Generations[0];
+
+				// Members in or below a parent->child cycle have no generation
+				maxColumnValue = INVALID_GENERATION - 1;
+				break;
+			case Field_Age:
+				m_AttributeColumns.findMembersInRange(FamilyTreeAttributeColumns::Attribute_Age,
+					condition.minValue, condition.maxValue, bitmap);
+				return SUCCESS;
+			case Field_Gender:
+				m_AttributeColumns.findMembersInRange(FamilyTreeAttributeColumns::Attribute_Gender,
+					condition.minValue, condition.maxValue, bitmap);
+				return SUCCESS;
+			case Field_BirthYear:
+				m_AttributeColumns.findMembersInRange(FamilyTreeAttributeColumns::Attribute_BirthYear,
+					condition.minValue, condition.maxValue, bitmap);
+				return SUCCESS;
+			default:
+				FamilyTreeErrorMsg(LOG_ERROR, "Unknown predicate field %d.", condition.field);
+				return INVALID_ARG;
+		}
+
+		// The uint32_t columns are scanned with the SIMD kernels
+		// after the range is clamped to the column type
+		bitmap.reset(numberOfMembers);
+		if(numberOfMembers == 0 || condition.minValue > condition.maxValue ||
+			condition.maxValue < 0 || condition.minValue > (int64_t)maxColumnValue) {
+			return SUCCESS;
+		}
+
+		uint32_t minValue = (condition.minValue < 0) ? 0 : (uint32_t)condition.minValue;
+		uint32_t maxValue = (condition.maxValue > (int64_t)maxColumnValue) ? maxColumnValue : (uint32_t)condition.maxValue;
+		FamilyTreeScanKernels::scanRangeToBitmap(pColumn, numberOfMembers, minValue, maxValue, bitmap.getWords());
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMemberGeneration
+	(
+		string const & memberName,
+		uint32_t & generation
+	) {
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		updateGenerations();
+		generation = m_Generations[memberId];
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::buildPredicateBitmap
+	(
+		member_predicate_t const & predicate,
+		FamilyTreeMemberBitmap & bitmap
+	) {
+		uint32_t numberOfMembers = m_Members.size();
+
+		// Bitmap of the member IDs that are in use
+		FamilyTreeMemberBitmap liveMembers(numberOfMembers);
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			if(m_Members[i] != NULL) {
+				liveMembers.set(i);
+			}
+		}
+
+		// OR together the bitmap of each conjunction, which
+		// is the AND of the bitmaps of its conditions
+		bitmap.reset(numberOfMembers);
+		FamilyTreeMemberBitmap conjunctionBitmap;
+		FamilyTreeMemberBitmap conditionBitmap;
+		for(member_predicate_t::const_iterator it = predicate.begin(); it != predicate.end(); ++it) {
+			conjunctionBitmap = liveMembers;
+			for(condition_conjunction_t::const_iterator condition = it->begin(); condition != it->end(); ++condition) {
+				FamilyTreeOpResultCode opResult = buildConditionBitmap(*condition, conditionBitmap);
+				if(opResult != SUCCESS) {
+					return opResult;
+				}
+				conjunctionBitmap.andWith(conditionBitmap);
+			}
+			bitmap.orWith(conjunctionBitmap);
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersMatchingPredicate
+	(
+		member_predicate_t const & predicate,
+		vector<string> & nameList
+	) {
+		// Clear the nameList
+		nameList.clear();
+
+		FamilyTreeMemberBitmap result;
+		FamilyTreeOpResultCode opResult = buildPredicateBitmap(predicate, result);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		vector<uint32_t> memberIds;
+		result.getMemberIds(memberIds);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			nameList.push_back(m_Members[*it]->getName());
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersMatchingPredicate
+	(
+		member_predicate_t const & predicate,
+		FamilyTreeMemberSet & members
+	) {
+		members.clear();
+
+		FamilyTreeMemberBitmap result;
+		FamilyTreeOpResultCode opResult = buildPredicateBitmap(predicate, result);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		members.assignBitmap(result);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMemberSet
+	(
+		vector<string> const & nameList,
+		FamilyTreeMemberSet & members
+	) {
+		members.clear();
+
+		for(vector<string>::const_iterator it = nameList.begin(); it != nameList.end(); ++it) {
+			uint32_t memberId = findFamilyMemberId(*it);
+			if(memberId == INVALID_MEMBER_ID) {
+				members.clear();
+				return FAMILY_MEMBER_NOT_FOUND;
+			}
+			members.add(memberId);
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getNameList
+	(
+		FamilyTreeMemberSet const & members,
+		vector<string> & nameList
+	) {
+		nameList.clear();
+
+		vector<uint32_t> memberIds;
+		members.getMemberIds(memberIds);
+
+		// Every member ID must belong to a member that
+		// is still in the tree
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			if(*it >= m_Members.size() || m_Members[*it] == NULL) {
+				FamilyTreeErrorMsg(LOG_ERROR, "Member ID %u is not in the family tree.", *it);
+				nameList.clear();
+				return FAMILY_MEMBER_NOT_FOUND;
+			}
+			nameList.push_back(m_Members[*it]->getName());
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFamilyMembersSet(FamilyTreeMemberSet & members) {
+		members.clear();
+
+		// Member IDs are added in increasing order
+		for(uint32_t i = 0; i < m_Members.size(); i++) {
+			if(m_Members[i] != NULL) {
+				members.add(i);
+			}
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::addNeighborsToSet
+	(
+		FamilyTreeMemberSet const & members,
+		relationship_t relationship,
+		FamilyTreeMemberSet & neighbors
+	) {
+		vector<uint32_t> memberIds;
+		members.getMemberIds(memberIds);
+
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			if(*it >= m_Members.size() || m_Members[*it] == NULL) {
+				FamilyTreeErrorMsg(LOG_ERROR, "Member ID %u is not in the family tree.", *it);
+				return FAMILY_MEMBER_NOT_FOUND;
+			}
+
+			FamilyMemberClass * pFamilyMember = m_Members[*it];
+			FamilyMemberSpan span;
+			switch(relationship) {
+				case Parent_Child:	span = pFamilyMember->getChildren(); break;
+				case Child_Parent:	span = pFamilyMember->getParents(); break;
+				case Sibling:		span = pFamilyMember->getSiblings(); break;
+				default:			return INVALID_ARG;
+			}
+
+			for(FamilyMemberSpan::const_iterator neighbor = span.begin(); neighbor != span.end(); ++neighbor) {
+				neighbors.add((*neighbor)->getId());
+			}
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getGrandparentSet
+	(
+		string const & memberName,
+		FamilyTreeMemberSet & grandparents
+	) {
+		grandparents.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		// The grandparents are the parents of the parents
+		FamilyTreeMemberSet member;
+		FamilyTreeMemberSet parents;
+		member.add(memberId);
+		addNeighborsToSet(member, Child_Parent, parents);
+
+		return addNeighborsToSet(parents, Child_Parent, grandparents);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getChildrenSet
+	(
+		string const & memberName,
+		FamilyTreeMemberSet & children
+	) {
+		children.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		FamilyTreeMemberSet member;
+		member.add(memberId);
+
+		return addNeighborsToSet(member, Parent_Child, children);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getChildrenSet
+	(
+		FamilyTreeMemberSet const & members,
+		FamilyTreeMemberSet & children
+	) {
+		FamilyTreeMemberSet result;
+		FamilyTreeOpResultCode opResult = addNeighborsToSet(members, Parent_Child, result);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		// members and children may be the same set
+		children = result;
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getSiblingSet
+	(
+		string const & memberName,
+		FamilyTreeMemberSet & siblings
+	) {
+		siblings.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		FamilyTreeMemberSet member;
+		member.add(memberId);
+
+		return addNeighborsToSet(member, Sibling, siblings);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getSiblingSet
+	(
+		FamilyTreeMemberSet const & members,
+		FamilyTreeMemberSet & siblings
+	) {
+		FamilyTreeMemberSet result;
+		FamilyTreeOpResultCode opResult = addNeighborsToSet(members, Sibling, result);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		// members and siblings may be the same set
+		siblings = result;
+
+		return SUCCESS;
+	}
+
+    // Neighbors of a member in the direction of a relative search
+    static inline FamilyMemberSpan getRelatives(FamilyMemberClass const * pFamilyMember, bool children) {
+		return children ? pFamilyMember->getChildren() : pFamilyMember->getParents();
+	}
+
+    void FamilyTreeClass::expandRelatives
+	(
+		vector<uint32_t> const & founderIds,
+		relationship_t relationship,
+		FamilyTreeMemberBitmap & relatives,
+		descendant_search_stats_t & stats
+	) {
+		// Descendants follow the children of the frontier and ancestors the parents
+		bool children = (relationship == Parent_Child);
+
+		stats.levels = 0;
+		stats.bottomUpLevels = 0;
+		stats.parallelLevels = 0;
+
+		uint32_t numberOfIds = m_Members.size();
+		relatives.reset(numberOfIds);
+
+		// Members that have been put in a frontier (the founders and
+		// the relatives found so far).  No member is expanded twice.
+		FamilyTreeMemberBitmap expanded(numberOfIds);
+		FamilyTreeMemberBitmap frontierBitmap;
+
+		vector<uint32_t> frontier;
+		uint64_t frontierEdges = 0;
+		for(vector<uint32_t>::const_iterator it = founderIds.begin(); it != founderIds.end(); ++it) {
+			if(expanded.test(*it) == false) {
+				expanded.set(*it);
+				frontier.push_back(*it);
+				frontierEdges += getRelatives(m_Members[*it], children).size();
+			}
+		}
+
+		// Parent->child edges that have not been expanded yet.  There are as
+		// many child->parent edges, so the same total is used for ancestors.
+		uint64_t unexploredEdges = 0;
+		const uint32_t * pChildCounts = m_ChildCounts.getCounts();
+		for(uint32_t i = 0; i < m_ChildCounts.getSize(); i++) {
+			unexploredEdges += pChildCounts[i];
+		}
+
+		// Next frontier and its number of edges found by each thread
+		uint32_t numberOfThreads = FamilyTreeParallel::getNumberOfThreads();
+		vector< vector<uint32_t> > nextFrontiers(numberOfThreads);
+		vector<uint64_t> nextFrontierEdges(numberOfThreads);
+
+		uint64_t * pRelativeWords = relatives.getWords();
+		uint64_t * pExpandedWords = expanded.getWords();
+		bool bottomUp = false;
+
+		while(frontier.empty() == false) {
+			unexploredEdges -= (frontierEdges < unexploredEdges) ? frontierEdges : unexploredEdges;
+
+			// Top-down touches every edge of the frontier.  Bottom-up touches
+			// every member that has not been reached yet but stops at the first
+			// neighbor in the frontier, which is cheaper once the frontier is a
+			// large part of the tree.
+			if(bottomUp) {
+				bottomUp = (uint64_t)frontier.size() * DESCENDANT_BETA >= numberOfIds;
+			}
+			else {
+				bottomUp = frontierEdges * DESCENDANT_ALPHA > unexploredEdges;
+			}
+
+			uint32_t numberOfChunks;
+			if(bottomUp == false) {
+				// Relatives are claimed with an atomic OR so that a relative
+				// shared by two chunks is only put in one next frontier
+				numberOfChunks = FamilyTreeParallel::forEachRange(0, frontier.size(), PARALLEL_CHUNK_MIN,
+					[&](uint32_t threadIndex, uint32_t begin, uint32_t end) {
+						vector<uint32_t> & next = nextFrontiers[threadIndex];
+						uint64_t edges = 0;
+						next.clear();
+
+						for(uint32_t i = begin; i < end; i++) {
+							FamilyMemberSpan neighbors = getRelatives(m_Members[frontier[i]], children);
+							for(FamilyMemberSpan::const_iterator neighbor = neighbors.begin(); neighbor != neighbors.end(); ++neighbor) {
+								uint32_t neighborId = (*neighbor)->getId();
+								uint64_t bit = 1ULL << (neighborId & 63);
+
+								if((__atomic_load_n(&pRelativeWords[neighborId >> 6], __ATOMIC_RELAXED) & bit) == 0) {
+									__atomic_fetch_or(&pRelativeWords[neighborId >> 6], bit, __ATOMIC_RELAXED);
+								}
+								if((__atomic_load_n(&pExpandedWords[neighborId >> 6], __ATOMIC_RELAXED) & bit) == 0 &&
+									(__atomic_fetch_or(&pExpandedWords[neighborId >> 6], bit, __ATOMIC_RELAXED) & bit) == 0) {
+									next.push_back(neighborId);
+									edges += getRelatives(*neighbor, children).size();
+								}
+							}
+						}
+
+						nextFrontierEdges[threadIndex] = edges;
+					});
+			}
+			else {
+				frontierBitmap.reset(numberOfIds);
+				for(vector<uint32_t>::const_iterator it = frontier.begin(); it != frontier.end(); ++it) {
+					frontierBitmap.set(*it);
+				}
+
+				// Every thread owns whole words of the bitmaps so no atomics are needed
+				numberOfChunks = FamilyTreeParallel::forEachRange(0, relatives.getNumberOfWords(), PARALLEL_CHUNK_MIN / 64,
+					[&](uint32_t threadIndex, uint32_t beginWord, uint32_t endWord) {
+						vector<uint32_t> & next = nextFrontiers[threadIndex];
+						uint64_t edges = 0;
+						next.clear();
+
+						for(uint32_t word = beginWord; word < endWord; word++) {
+							uint64_t remaining = ~pRelativeWords[word];
+							while(remaining != 0) {
+								uint32_t memberId = (word << 6) + __builtin_ctzll(remaining);
+								remaining &= remaining - 1;
+								if(memberId >= numberOfIds) {
+									break;
+								}
+
+								FamilyMemberClass * pFamilyMember = m_Members[memberId];
+								if(pFamilyMember == NULL) {
+									continue;
+								}
+
+								// A member is reached if one of its neighbors in the
+								// opposite direction is in the frontier
+								FamilyMemberSpan neighbors = getRelatives(pFamilyMember, children == false);
+								for(FamilyMemberSpan::const_iterator neighbor = neighbors.begin(); neighbor != neighbors.end(); ++neighbor) {
+									if(frontierBitmap.test((*neighbor)->getId())) {
+										uint64_t bit = 1ULL << (memberId & 63);
+										pRelativeWords[word] |= bit;
+										if((pExpandedWords[word] & bit) == 0) {
+											pExpandedWords[word] |= bit;
+											next.push_back(memberId);
+											edges += getRelatives(pFamilyMember, children).size();
+										}
+										break;
+									}
+								}
+							}
+						}
+
+						nextFrontierEdges[threadIndex] = edges;
+					});
+			}
+
+			stats.levels++;
+			if(bottomUp) {
+				stats.bottomUpLevels++;
+			}
+			if(numberOfChunks > 1) {
+				stats.parallelLevels++;
+			}
+
+			frontier.clear();
+			frontierEdges = 0;
+			for(uint32_t i = 0; i < numberOfChunks; i++) {
+				frontier.insert(frontier.end(), nextFrontiers[i].begin(), nextFrontiers[i].end());
+				frontierEdges += nextFrontierEdges[i];
+			}
+		}
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getDescendantSet
+	(
+		FamilyTreeMemberSet const & founders,
+		FamilyTreeMemberSet & descendants
+	) {
+		descendant_search_stats_t stats;
+		return getDescendantSet(founders, descendants, stats);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getDescendantSet
+	(
+		FamilyTreeMemberSet const & founders,
+		FamilyTreeMemberSet & descendants,
+		descendant_search_stats_t & stats
+	) {
+		vector<uint32_t> founderIds;
+		founders.getMemberIds(founderIds);
+
+		for(vector<uint32_t>::const_iterator it = founderIds.begin(); it != founderIds.end(); ++it) {
+			if(*it >= m_Members.size() || m_Members[*it] == NULL) {
+				FamilyTreeErrorMsg(LOG_ERROR, "Member ID %u is not in the family tree.", *it);
+				return FAMILY_MEMBER_NOT_FOUND;
+			}
+		}
+
+		FamilyTreeMemberBitmap result;
+		expandRelatives(founderIds, Parent_Child, result, stats);
+
+		// founders and descendants may be the same set
+		descendants.assignBitmap(result);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getDescendantSet
+	(
+		vector<string> const & founderNames,
+		FamilyTreeMemberSet & descendants
+	) {
+		FamilyTreeMemberSet founders;
+		FamilyTreeOpResultCode opResult = getMemberSet(founderNames, founders);
+		if(opResult != SUCCESS) {
+			descendants.clear();
+			return opResult;
+		}
+
+		return getDescendantSet(founders, descendants);
+	}
+
+    void FamilyTreeClass::evaluatePath
+	(
+		FamilyTreePathExpression const & automaton,
+		uint32_t memberId,
+		vector<FamilyTreeMemberBitmap> & visited,
+		vector<uint64_t> & queue,
+		vector<uint32_t> & memberIds
+	) const {
+		memberIds.clear();
+
+		// Breadth first search over the (state, member) pairs of the product
+		// of the automaton and the tree.  Each state has its own bitmap of the
+		// members it has reached so no pair is expanded twice.
+		// A queue entry is (state << 32) | member ID.
+		queue.assign(1, memberId);
+		visited[0].set(memberId);
+
+		for(uint32_t head = 0; head < queue.size(); head++) {
+			uint32_t state = (uint32_t)(queue[head] >> 32);
+			uint32_t currentId = (uint32_t)queue[head];
+
+			if(automaton.isAccepting(state) && currentId != memberId) {
+				memberIds.push_back(currentId);
+			}
+
+			for(const FamilyTreePathExpression::transition_t * pTransition = automaton.beginTransitions(state);
+					pTransition != automaton.endTransitions(state); ++pTransition) {
+				FamilyMemberSpan neighbors;
+				switch(pTransition->step) {
+					case FamilyTreePathExpression::Step_Parent:	neighbors = m_Members[currentId]->getParents(); break;
+					case FamilyTreePathExpression::Step_Child:	neighbors = m_Members[currentId]->getChildren(); break;
+					case FamilyTreePathExpression::Step_Sibling:	neighbors = m_Members[currentId]->getSiblings(); break;
+				}
+
+				FamilyTreeMemberBitmap & nextVisited = visited[pTransition->nextState];
+				for(FamilyMemberSpan::const_iterator neighbor = neighbors.begin(); neighbor != neighbors.end(); ++neighbor) {
+					uint32_t neighborId = (*neighbor)->getId();
+					if(nextVisited.test(neighborId) == false) {
+						nextVisited.set(neighborId);
+						queue.push_back(((uint64_t)pTransition->nextState << 32) | neighborId);
+					}
+				}
+			}
+		}
+
+		// Leave the bitmaps empty for the next search
+		for(vector<uint64_t>::const_iterator it = queue.begin(); it != queue.end(); ++it) {
+			visited[*it >> 32].clear((uint32_t)*it);
+		}
+
+		// A member may be reached in more than one accepting state
+		sort(memberIds.begin(), memberIds.end());
+		memberIds.erase(unique(memberIds.begin(), memberIds.end()), memberIds.end());
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersByPath
+	(
+		string const & memberName,
+		string const & expression,
+		FamilyTreeMemberSet & members
+	) {
+		members.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		FamilyTreePathExpression automaton;
+		if(automaton.compile(expression) == false) {
+			FamilyTreeErrorMsg(LOG_ERROR, "Invalid path expression \"%s\" at position %u.",
+				expression.c_str(), automaton.getErrorPosition());
+			return INVALID_ARG;
+		}
+
+		vector<FamilyTreeMemberBitmap> visited(automaton.getNumberOfStates(), FamilyTreeMemberBitmap(m_Members.size()));
+		vector<uint64_t> queue;
+		vector<uint32_t> memberIds;
+		evaluatePath(automaton, memberId, visited, queue, memberIds);
+
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			members.add(*it);
+		}
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::buildMaterializedView(FamilyTreeMaterializedView & view) {
+		FamilyTreePathExpression const & automaton = view.getAutomaton();
+		uint32_t numberOfIds = m_Members.size();
+
+		// Each thread evaluates the rows of a range of member IDs
+		// into its own arrays, which are then concatenated
+		uint32_t numberOfThreads = FamilyTreeParallel::getNumberOfThreads();
+		vector< vector<uint32_t> > chunkRowSizes(numberOfThreads);
+		vector< vector<uint32_t> > chunkMemberIds(numberOfThreads);
+
+		uint32_t numberOfChunks = FamilyTreeParallel::forEachRange(0, numberOfIds, PARALLEL_ROWS_CHUNK_MIN,
+			[&](uint32_t threadIndex, uint32_t begin, uint32_t end) {
+				vector<FamilyTreeMemberBitmap> visited(automaton.getNumberOfStates(), FamilyTreeMemberBitmap(numberOfIds));
+				vector<uint64_t> queue;
+				vector<uint32_t> row;
+				vector<uint32_t> & rowSizes = chunkRowSizes[threadIndex];
+				vector<uint32_t> & memberIds = chunkMemberIds[threadIndex];
+				rowSizes.clear();
+				memberIds.clear();
+
+				for(uint32_t i = begin; i < end; i++) {
+					row.clear();
+					if(m_Members[i] != NULL) {
+						evaluatePath(automaton, i, visited, queue, row);
+					}
+					rowSizes.push_back(row.size());
+					memberIds.insert(memberIds.end(), row.begin(), row.end());
+				}
+			});
+
+		vector<uint32_t> offsets(1, 0);
+		vector<uint32_t> memberIds;
+		offsets.reserve(numberOfIds + 1);
+		for(uint32_t i = 0; i < numberOfChunks; i++) {
+			for(vector<uint32_t>::const_iterator it = chunkRowSizes[i].begin(); it != chunkRowSizes[i].end(); ++it) {
+				offsets.push_back(offsets.back() + *it);
+			}
+			memberIds.insert(memberIds.end(), chunkMemberIds[i].begin(), chunkMemberIds[i].end());
+		}
+
+		view.assign(offsets, memberIds);
+	}
+
+    void FamilyTreeClass::buildStaleMaterializedViews() {
+		for(map<string, FamilyTreeMaterializedView>::iterator it = m_MaterializedViews.begin(); it != m_MaterializedViews.end(); ++it) {
+			if(it->second.isStale()) {
+				buildMaterializedView(it->second);
+			}
+		}
+	}
+
+    void FamilyTreeClass::invalidateMaterializedViews(uint32_t fromId, relationship_t relationship) {
+		// Step of the automata that follows the relationship
+		FamilyTreePathExpression::step_t step;
+		switch(relationship) {
+			case Parent_Child:	step = FamilyTreePathExpression::Step_Child; break;
+			case Child_Parent:	step = FamilyTreePathExpression::Step_Parent; break;
+			default:			step = FamilyTreePathExpression::Step_Sibling; break;
+		}
+
+		for(map<string, FamilyTreeMaterializedView>::iterator it = m_MaterializedViews.begin(); it != m_MaterializedViews.end(); ++it) {
+			FamilyTreeMaterializedView & view = it->second;
+			if(view.isStale()) {
+				continue;
+			}
+			FamilyTreePathExpression const & automaton = view.getAutomaton();
+			uint32_t numberOfStates = automaton.getNumberOfStates();
+
+			// The row of a member changes only if one of its paths takes
+			// the relationship, so search backwards from the (state, fromId)
+			// pairs that can take it to the members that reach them from
+			// the start state.  A queue entry is (state << 32) | member ID.
+			vector<uint64_t> queue;
+			unordered_set<uint64_t> seen;
+			for(uint32_t state = 0; state < numberOfStates; state++) {
+				for(const FamilyTreePathExpression::transition_t * pTransition = automaton.beginTransitions(state);
+						pTransition != automaton.endTransitions(state); ++pTransition) {
+					if(pTransition->step == step) {
+						queue.push_back(((uint64_t)state << 32) | fromId);
+						seen.insert(queue.back());
+						break;
+					}
+				}
+			}
+
+			for(uint32_t head = 0; head < queue.size() && view.isStale() == false; head++) {
+				uint32_t state = (uint32_t)(queue[head] >> 32);
+				uint32_t memberId = (uint32_t)queue[head];
+
+				if(state == 0) {
+					view.markDirty(memberId);
+				}
+
+				// Predecessors are (previous state, member) pairs with a transition
+				// to state whose relationship ends at memberId
+				for(uint32_t previous = 0; previous < numberOfStates; previous++) {
+					for(const FamilyTreePathExpression::transition_t * pTransition = automaton.beginTransitions(previous);
+							pTransition != automaton.endTransitions(previous); ++pTransition) {
+						if(pTransition->nextState != state) {
+							continue;
+						}
+
+						relationship_t incoming;
+						switch(pTransition->step) {
+							case FamilyTreePathExpression::Step_Child:	incoming = Parent_Child; break;
+							case FamilyTreePathExpression::Step_Parent:	incoming = Child_Parent; break;
+							default:									incoming = Sibling; break;
+						}
+
+						FamilyRelationshipClass * pRelationship = m_Members[memberId]->getFirstIncomingRelationship();
+						for(; pRelationship != NULL; pRelationship = pRelationship->getNextIncoming()) {
+							if(pRelationship->getRelationship() != incoming) {
+								continue;
+							}
+
+							uint64_t key = ((uint64_t)previous << 32) | pRelationship->getFrom()->getId();
+							if(seen.insert(key).second) {
+								queue.push_back(key);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMaterializedViewRow
+	(
+		string const & viewName,
+		string const & memberName,
+		const uint32_t * & pMemberIds,
+		uint32_t & count
+	) {
+		map<string, FamilyTreeMaterializedView>::iterator it = m_MaterializedViews.find(viewName);
+		if(it == m_MaterializedViews.end()) {
+			FamilyTreeErrorMsg(LOG_ERROR, "There is no materialized view named %s.", viewName.c_str());
+			return INVALID_ARG;
+		}
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		FamilyTreeMaterializedView & view = it->second;
+		if(view.isStale()) {
+			buildMaterializedView(view);
+		}
+		else if(view.isDirty(memberId)) {
+			FamilyTreePathExpression const & automaton = view.getAutomaton();
+			vector<FamilyTreeMemberBitmap> visited(automaton.getNumberOfStates(), FamilyTreeMemberBitmap(m_Members.size()));
+			vector<uint64_t> queue;
+			vector<uint32_t> row;
+			evaluatePath(automaton, memberId, visited, queue, row);
+			view.setRow(memberId, row);
+		}
+
+		view.getRow(memberId, pMemberIds, count);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::registerMaterializedView
+	(
+		string const & viewName,
+		string const & expression
+	) {
+		FamilyTreeMaterializedView view;
+		if(view.compile(expression) == false) {
+			FamilyTreeErrorMsg(LOG_ERROR, "Invalid path expression \"%s\" at position %u.",
+				expression.c_str(), view.getAutomaton().getErrorPosition());
+			return INVALID_ARG;
+		}
+
+		// A view with the same name is replaced
+		FamilyTreeMaterializedView & registeredView = m_MaterializedViews[viewName];
+		registeredView = view;
+		buildMaterializedView(registeredView);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::unregisterMaterializedView(string const & viewName) {
+		if(m_MaterializedViews.erase(viewName) == 0) {
+			FamilyTreeErrorMsg(LOG_ERROR, "There is no materialized view named %s.", viewName.c_str());
+			return INVALID_ARG;
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMaterializedViewSet
+	(
+		string const & viewName,
+		string const & memberName,
+		FamilyTreeMemberSet & members
+	) {
+		members.clear();
+
+		const uint32_t * pMemberIds;
+		uint32_t count;
+		FamilyTreeOpResultCode opResult = getMaterializedViewRow(viewName, memberName, pMemberIds, count);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		for(uint32_t i = 0; i < count; i++) {
+			members.add(pMemberIds[i]);
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMaterializedViewNameList
+	(
+		string const & viewName,
+		string const & memberName,
+		vector<string> & nameList
+	) {
+		nameList.clear();
+
+		const uint32_t * pMemberIds;
+		uint32_t count;
+		FamilyTreeOpResultCode opResult = getMaterializedViewRow(viewName, memberName, pMemberIds, count);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		nameList.reserve(count);
+		for(uint32_t i = 0; i < count; i++) {
+			nameList.push_back(m_Members[pMemberIds[i]]->getName());
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMaterializedViewStats
+	(
+		string const & viewName,
+		materialized_view_stats_t & stats
+	) {
+		map<string, FamilyTreeMaterializedView>::const_iterator it = m_MaterializedViews.find(viewName);
+		if(it == m_MaterializedViews.end()) {
+			FamilyTreeErrorMsg(LOG_ERROR, "There is no materialized view named %s.", viewName.c_str());
+			return INVALID_ARG;
+		}
+
+		it->second.getStats(stats);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getAncestorSet
+	(
+		string const & memberName,
+		FamilyTreeMemberSet & ancestors
+	) {
+		ancestors.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		vector<uint32_t> founderIds(1, memberId);
+		FamilyTreeMemberBitmap result;
+		descendant_search_stats_t stats;
+		expandRelatives(founderIds, Child_Parent, result, stats);
+		ancestors.assignBitmap(result);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::buildCommonAncestorBitmap
+	(
+		vector<string> const & memberNames,
+		FamilyTreeMemberBitmap & commonAncestors
+	) {
+		if(memberNames.empty()) {
+			FamilyTreeErrorMsg(LOG_ERROR, "No family members to find the common ancestors of.");
+			return INVALID_ARG;
+		}
+
+		// Look up every name before searching so that an
+		// unknown name is reported even if the result is empty
+		vector<uint32_t> memberIds;
+		for(vector<string>::const_iterator it = memberNames.begin(); it != memberNames.end(); ++it) {
+			uint32_t memberId = findFamilyMemberId(*it);
+			if(memberId == INVALID_MEMBER_ID) {
+				FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", it->c_str());
+				return FAMILY_MEMBER_NOT_FOUND;
+			}
+			memberIds.push_back(memberId);
+		}
+
+		FamilyTreeMemberBitmap ancestors;
+		descendant_search_stats_t stats;
+		vector<uint32_t> founderIds(1, memberIds[0]);
+		expandRelatives(founderIds, Child_Parent, commonAncestors, stats);
+
+		for(uint32_t i = 1; i < memberIds.size() && commonAncestors.count() != 0; i++) {
+			founderIds[0] = memberIds[i];
+			expandRelatives(founderIds, Child_Parent, ancestors, stats);
+			commonAncestors.andWith(ancestors);
+		}
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::removeNonMinimalAncestors(FamilyTreeMemberBitmap & commonAncestors) {
+		vector<uint32_t> ancestorIds;
+		commonAncestors.getMemberIds(ancestorIds);
+
+		// Find all of them before clearing any
+		vector<uint32_t> nonMinimalIds;
+		for(vector<uint32_t>::const_iterator it = ancestorIds.begin(); it != ancestorIds.end(); ++it) {
+			FamilyMemberSpan children = m_Members[*it]->getChildren();
+			for(FamilyMemberSpan::const_iterator child = children.begin(); child != children.end(); ++child) {
+				if(commonAncestors.test((*child)->getId())) {
+					nonMinimalIds.push_back(*it);
+					break;
+				}
+			}
+		}
+
+		for(vector<uint32_t>::const_iterator it = nonMinimalIds.begin(); it != nonMinimalIds.end(); ++it) {
+			commonAncestors.clear(*it);
+		}
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getCommonAncestorSet
+	(
+		vector<string> const & memberNames,
+		FamilyTreeMemberSet & commonAncestors
+	) {
+		commonAncestors.clear();
+
+		FamilyTreeMemberBitmap result;
+		FamilyTreeOpResultCode opResult = buildCommonAncestorBitmap(memberNames, result);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		commonAncestors.assignBitmap(result);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMinimalCommonAncestorSet
+	(
+		vector<string> const & memberNames,
+		FamilyTreeMemberSet & minimalAncestors
+	) {
+		minimalAncestors.clear();
+
+		FamilyTreeMemberBitmap result;
+		FamilyTreeOpResultCode opResult = buildCommonAncestorBitmap(memberNames, result);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		removeNonMinimalAncestors(result);
+		minimalAncestors.assignBitmap(result);
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::getAncestorIds
+	(
+		uint32_t memberId,
+		FamilyTreeMemberBitmap & visited,
+		vector<uint32_t> & ancestorIds
+	) const {
+		ancestorIds.clear();
+
+		// ancestorIds is also the queue of the search
+		FamilyMemberSpan parents = m_Members[memberId]->getParents();
+		for(uint32_t head = 0; ; head++) {
+			for(FamilyMemberSpan::const_iterator parent = parents.begin(); parent != parents.end(); ++parent) {
+				uint32_t parentId = (*parent)->getId();
+				if(visited.test(parentId) == false) {
+					visited.set(parentId);
+					ancestorIds.push_back(parentId);
+				}
+			}
+
+			if(head == ancestorIds.size()) {
+				break;
+			}
+			parents = m_Members[ancestorIds[head]]->getParents();
+		}
+
+		for(vector<uint32_t>::const_iterator it = ancestorIds.begin(); it != ancestorIds.end(); ++it) {
+			visited.clear(*it);
+		}
+		sort(ancestorIds.begin(), ancestorIds.end());
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getCommonAncestorsForPairs
+	(
+		vector<member_pair_t> const & pairs,
+		bool minimalOnly,
+		vector<FamilyTreeMemberSet> & commonAncestors
+	) {
+		commonAncestors.clear();
+
+		// Member IDs of the first and second member of every pair
+		vector<uint32_t> pairIds(2 * pairs.size());
+		for(uint32_t i = 0; i < pairs.size(); i++) {
+			pairIds[2 * i] = findFamilyMemberId(pairs[i].first);
+			pairIds[2 * i + 1] = findFamilyMemberId(pairs[i].second);
+			if(pairIds[2 * i] == INVALID_MEMBER_ID || pairIds[2 * i + 1] == INVALID_MEMBER_ID) {
+				FamilyTreeErrorMsg(LOG_ERROR, "%s or %s is not in the family tree.",
+					pairs[i].first.c_str(), pairs[i].second.c_str());
+				return FAMILY_MEMBER_NOT_FOUND;
+			}
+		}
+
+		// The ancestors of each distinct member are found once.  Each
+		// thread has its own visited bitmap.
+		vector<uint32_t> distinctIds(pairIds);
+		sort(distinctIds.begin(), distinctIds.end());
+		distinctIds.erase(unique(distinctIds.begin(), distinctIds.end()), distinctIds.end());
+
+		vector< vector<uint32_t> > ancestorLists(distinctIds.size());
+		FamilyTreeParallel::forEachRange(0, distinctIds.size(), PARALLEL_PAIRS_CHUNK_MIN,
+			[&](uint32_t threadIndex, uint32_t begin, uint32_t end) {
+				FamilyTreeMemberBitmap visited(m_Members.size());
+				for(uint32_t i = begin; i < end; i++) {
+					getAncestorIds(distinctIds[i], visited, ancestorLists[i]);
+				}
+			});
+
+		// Intersect the sorted ancestor lists of every pair
+		commonAncestors.resize(pairs.size());
+		FamilyTreeParallel::forEachRange(0, pairs.size(), PARALLEL_PAIRS_CHUNK_MIN,
+			[&](uint32_t threadIndex, uint32_t begin, uint32_t end) {
+				vector<uint32_t> common;
+				for(uint32_t i = begin; i < end; i++) {
+					vector<uint32_t> const & first = ancestorLists[lower_bound(distinctIds.begin(), distinctIds.end(),
+						pairIds[2 * i]) - distinctIds.begin()];
+					vector<uint32_t> const & second = ancestorLists[lower_bound(distinctIds.begin(), distinctIds.end(),
+						pairIds[2 * i + 1]) - distinctIds.begin()];
+
+					common.clear();
+					set_intersection(first.begin(), first.end(), second.begin(), second.end(), back_inserter(common));
+
+					for(vector<uint32_t>::const_iterator it = common.begin(); it != common.end(); ++it) {
+						// A common ancestor with a child that is also a
+						// common ancestor is not minimal
+						if(minimalOnly) {
+							bool minimal = true;
+							FamilyMemberSpan children = m_Members[*it]->getChildren();
+							for(FamilyMemberSpan::const_iterator child = children.begin(); child != children.end(); ++child) {
+								if(binary_search(common.begin(), common.end(), (*child)->getId())) {
+									minimal = false;
+									break;
+								}
+							}
+							if(minimal == false) {
+								continue;
+							}
+						}
+						commonAncestors[i].add(*it);
+					}
+				}
+			});
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::updateKinship() {
+		if(m_KinshipVersion == m_StructureVersion) {
+			return;
+		}
+
+		// The generations order every member after its parents
+		updateGenerations();
+
+		uint32_t numberOfMembers = m_Members.size();
+		vector<uint32_t> parents(2 * numberOfMembers, FamilyTreeKinship::NO_PARENT);
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			if(m_Members[i] == NULL) {
+				continue;
+			}
+
+			FamilyMemberSpan memberParents = m_Members[i]->getParents();
+			for(uint32_t j = 0; j < memberParents.size() && j < 2; j++) {
+				parents[2 * i + j] = memberParents[j]->getId();
+			}
+		}
+
+		m_Kinship.build(parents, m_Generations);
+		m_KinshipVersion = m_StructureVersion;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFamilyUnitSiblingSet
+	(
+		string const & memberName,
+		FamilyTreeMemberSet & siblings
+	) {
+		siblings.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		vector<uint32_t> memberIds;
+		m_FamilyUnits.getSiblings(memberId, memberIds);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			siblings.add(*it);
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFullAndHalfSiblingSets
+	(
+		string const & memberName,
+		FamilyTreeMemberSet & fullSiblings,
+		FamilyTreeMemberSet & halfSiblings
+	) {
+		fullSiblings.clear();
+		halfSiblings.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		vector<uint32_t> fullIds;
+		vector<uint32_t> halfIds;
+		m_FamilyUnits.getSiblings(memberId, fullIds, halfIds);
+		for(vector<uint32_t>::const_iterator it = fullIds.begin(); it != fullIds.end(); ++it) {
+			fullSiblings.add(*it);
+		}
+		for(vector<uint32_t>::const_iterator it = halfIds.begin(); it != halfIds.end(); ++it) {
+			halfSiblings.add(*it);
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFamilyUnitChildrenSet
+	(
+		string const & memberName,
+		FamilyTreeMemberSet & children
+	) {
+		children.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		vector<uint32_t> memberIds;
+		m_FamilyUnits.getChildren(memberId, memberIds);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			children.add(*it);
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFamilyUnitStats(family_unit_stats_t & stats) {
+		m_FamilyUnits.getStats(stats);
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::updateFamilies() {
+		if(m_FamiliesStale == false) {
+			return;
+		}
+
+		m_Families.clear();
+		uint32_t numberOfMembers = m_Members.size();
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			if(m_Members[i] != NULL) {
+				m_Families.addMember(i);
+			}
+		}
+
+		// Every relationship is in the adjacency cache of its from member
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			if(m_Members[i] == NULL) {
+				continue;
+			}
+
+			FamilyMemberSpan spans[3] = { m_Members[i]->getChildren(), m_Members[i]->getParents(), m_Members[i]->getSiblings() };
+			for(uint32_t j = 0; j < 3; j++) {
+				for(FamilyMemberSpan::const_iterator it = spans[j].begin(); it != spans[j].end(); ++it) {
+					m_Families.unite(i, (*it)->getId());
+				}
+			}
+		}
+
+		m_FamiliesStale = false;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::isSameFamily
+	(
+		string const & firstMemberName,
+		string const & secondMemberName,
+		bool & sameFamily
+	) {
+		sameFamily = false;
+
+		uint32_t firstId = findFamilyMemberId(firstMemberName);
+		if(firstId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", firstMemberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		uint32_t secondId = findFamilyMemberId(secondMemberName);
+		if(secondId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", secondMemberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		updateFamilies();
+		sameFamily = m_Families.isSameFamily(firstId, secondId);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFamilySize(string const & memberName, uint32_t & size) {
+		size = 0;
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		updateFamilies();
+		size = m_Families.getFamilySize(memberId);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFamilySet(string const & memberName, FamilyTreeMemberSet & members) {
+		members.clear();
+
+		uint32_t memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		updateFamilies();
+
+		vector<uint32_t> memberIds;
+		m_Families.getFamilyMembers(memberId, memberIds);
+		for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+			members.add(*it);
+		}
+
+		return SUCCESS;
+	}
+
+    // Orders families by decreasing size, then by name
+    static bool familyInfoGreater(FamilyTreeClass::family_info_t const & a, FamilyTreeClass::family_info_t const & b) {
+		return (a.size != b.size) ? (a.size > b.size) : (a.representative < b.representative);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getFamilyList(vector<family_info_t> & families) {
+		families.clear();
+
+		updateFamilies();
+
+		vector<uint32_t> roots;
+		vector<uint32_t> sizes;
+		m_Families.getFamilies(roots, sizes);
+
+		families.resize(roots.size());
+		for(uint32_t i = 0; i < roots.size(); i++) {
+			families[i].representative = m_Members[roots[i]]->getName();
+			families[i].size = sizes[i];
+		}
+		sort(families.begin(), families.end(), familyInfoGreater);
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::validateCycles(validation_report_t & report) {
+		// Members that are not part of a cycle and do not descend
+		// from one have a generation
+		updateGenerations();
+
+		uint32_t numberOfMembers = m_Members.size();
+		vector<uint32_t> remainingChildren(numberOfMembers, 0);
+		vector<uint32_t> queue;
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			if(m_Members[i] == NULL || m_Generations[i] != INVALID_GENERATION) {
+				continue;
+			}
+
+			// Descendants of a cycle that are not on one run out of
+			// children first when peeled from the bottom
+			FamilyMemberSpan children = m_Members[i]->getChildren();
+			for(FamilyMemberSpan::const_iterator it = children.begin(); it != children.end(); ++it) {
+				if(m_Generations[(*it)->getId()] == INVALID_GENERATION) {
+					remainingChildren[i]++;
+				}
+			}
+			if(remainingChildren[i] == 0) {
+				queue.push_back(i);
+			}
+		}
+
+		vector<bool> peeled(numberOfMembers, false);
+		for(uint32_t head = 0; head < queue.size(); head++) {
+			peeled[queue[head]] = true;
+			FamilyMemberSpan parents = m_Members[queue[head]]->getParents();
+			for(FamilyMemberSpan::const_iterator it = parents.begin(); it != parents.end(); ++it) {
+				uint32_t parentId = (*it)->getId();
+				if(m_Generations[parentId] == INVALID_GENERATION && --remainingChildren[parentId] == 0) {
+					queue.push_back(parentId);
+				}
+			}
+		}
+
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			if(m_Members[i] == NULL || m_Generations[i] != INVALID_GENERATION || peeled[i]) {
+				continue;
+			}
+
+			report.cycleMembers++;
+			if(report.issues.size() < MAX_VALIDATION_ISSUES) {
+				report.issues.push_back(m_Members[i]->getName() + " is their own ancestor");
+			}
+		}
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::validateTree(validation_report_t & report) {
+		report.valid = false;
+		report.members = 0;
+		report.relationships = 0;
+		report.cycleMembers = 0;
+		report.duplicateRelationships = 0;
+		report.duplicatesSkipped = m_DuplicatesSkipped;
+		report.siblingConflicts = 0;
+		report.orphanRelationships = 0;
+		report.issues.clear();
+
+		validateCycles(report);
+
+		// Sorted neighbor IDs of every member in CSR layout, one array per
+		// kind of relationship, so that every check is a binary search
+		enum { Kind_Children, Kind_Parents, Kind_Siblings, NUMBER_OF_KINDS };
+		uint32_t numberOfMembers = m_Members.size();
+		vector<uint32_t> offsets[NUMBER_OF_KINDS];
+		vector<uint32_t> neighbors[NUMBER_OF_KINDS];
+		for(uint32_t kind = 0; kind < NUMBER_OF_KINDS; kind++) {
+			offsets[kind].assign(numberOfMembers + 1, 0);
+		}
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			FamilyMemberClass * pMember = m_Members[i];
+			offsets[Kind_Children][i + 1] = offsets[Kind_Children][i] + ((pMember != NULL) ? pMember->getChildren().size() : 0);
+			offsets[Kind_Parents][i + 1] = offsets[Kind_Parents][i] + ((pMember != NULL) ? pMember->getParents().size() : 0);
+			offsets[Kind_Siblings][i + 1] = offsets[Kind_Siblings][i] + ((pMember != NULL) ? pMember->getSiblings().size() : 0);
+			if(pMember != NULL) {
+				report.members++;
+			}
+		}
+		for(uint32_t kind = 0; kind < NUMBER_OF_KINDS; kind++) {
+			neighbors[kind].resize(offsets[kind][numberOfMembers]);
+			report.relationships += neighbors[kind].size();
+		}
+
+		FamilyTreeParallel::forEachRange(0, numberOfMembers, PARALLEL_CHUNK_MIN,
+			[&](uint32_t threadIndex, uint32_t begin, uint32_t end) {
+				for(uint32_t i = begin; i < end; i++) {
+					if(m_Members[i] == NULL) {
+						continue;
+					}
+
+					FamilyMemberSpan spans[NUMBER_OF_KINDS] = { m_Members[i]->getChildren(), m_Members[i]->getParents(), m_Members[i]->getSiblings() };
+					for(uint32_t kind = 0; kind < NUMBER_OF_KINDS; kind++) {
+						uint32_t * pNeighbors = neighbors[kind].data() + offsets[kind][i];
+						for(FamilyMemberSpan::const_iterator it = spans[kind].begin(); it != spans[kind].end(); ++it) {
+							// A relationship to a removed member whose ID has been
+							// reused does not point at the member with that ID
+							uint32_t neighborId = (*it)->getId();
+							*pNeighbors++ = (neighborId < numberOfMembers && m_Members[neighborId] == *it) ? neighborId : INVALID_MEMBER_ID;
+						}
+						sort(neighbors[kind].begin() + offsets[kind][i], neighbors[kind].begin() + offsets[kind][i + 1]);
+					}
+				}
+			});
+
+		// Every thread counts the problems of its own range of members
+		uint32_t numberOfThreads = FamilyTreeParallel::getNumberOfThreads();
+		vector<validation_report_t> threadReports(numberOfThreads);
+		uint32_t numberOfChunks = FamilyTreeParallel::forEachRange(0, numberOfMembers, PARALLEL_CHUNK_MIN,
+			[&](uint32_t threadIndex, uint32_t begin, uint32_t end) {
+				validation_report_t & threadReport = threadReports[threadIndex];
+				threadReport.duplicateRelationships = 0;
+				threadReport.siblingConflicts = 0;
+				threadReport.orphanRelationships = 0;
+				threadReport.issues.clear();
+
+				// Inverse kind of each kind of relationship
+				const uint32_t inverseKinds[NUMBER_OF_KINDS] = { Kind_Parents, Kind_Children, Kind_Siblings };
+				const char * kindNames[NUMBER_OF_KINDS] = { "child", "parent", "sibling" };
+
+				for(uint32_t i = begin; i < end; i++) {
+					if(m_Members[i] == NULL) {
+						continue;
+					}
+
+					for(uint32_t kind = 0; kind < NUMBER_OF_KINDS; kind++) {
+						const uint32_t * pBegin = neighbors[kind].data() + offsets[kind][i];
+						const uint32_t * pEnd = neighbors[kind].data() + offsets[kind][i + 1];
+						for(const uint32_t * pNeighbor = pBegin; pNeighbor != pEnd; ++pNeighbor) {
+							uint32_t neighborId = *pNeighbor;
+							if(neighborId == INVALID_MEMBER_ID) {
+								threadReport.orphanRelationships++;
+								if(threadReport.issues.size() < MAX_VALIDATION_ISSUES) {
+									threadReport.issues.push_back(m_Members[i]->getName() + " has a " + kindNames[kind] + " that was removed");
+								}
+								continue;
+							}
+
+							if(pNeighbor != pBegin && pNeighbor[-1] == neighborId) {
+								threadReport.duplicateRelationships++;
+								if(threadReport.issues.size() < MAX_VALIDATION_ISSUES) {
+									threadReport.issues.push_back(m_Members[i]->getName() + " has " + m_Members[neighborId]->getName()
+										+ " as a " + kindNames[kind] + " more than once");
+								}
+								continue;
+							}
+
+							uint32_t inverseKind = inverseKinds[kind];
+							if(binary_search(neighbors[inverseKind].begin() + offsets[inverseKind][neighborId],
+									neighbors[inverseKind].begin() + offsets[inverseKind][neighborId + 1], i) == false) {
+								threadReport.orphanRelationships++;
+								if(threadReport.issues.size() < MAX_VALIDATION_ISSUES) {
+									threadReport.issues.push_back(m_Members[i]->getName() + " has " + m_Members[neighborId]->getName()
+										+ " as a " + kindNames[kind] + " without the inverse relationship");
+								}
+							}
+
+							// Each sibling pair is checked once, from its smaller member ID
+							if(kind != Kind_Siblings || neighborId < i) {
+								continue;
+							}
+
+							bool conflict = (neighborId == i);
+							if(conflict == false) {
+								conflict = binary_search(neighbors[Kind_Children].begin() + offsets[Kind_Children][i],
+										neighbors[Kind_Children].begin() + offsets[Kind_Children][i + 1], neighborId)
+									|| binary_search(neighbors[Kind_Parents].begin() + offsets[Kind_Parents][i],
+										neighbors[Kind_Parents].begin() + offsets[Kind_Parents][i + 1], neighborId);
+							}
+							if(conflict == false) {
+								// Siblings that both have parents must share one
+								const uint32_t * pParents = neighbors[Kind_Parents].data() + offsets[Kind_Parents][i];
+								const uint32_t * pParentsEnd = neighbors[Kind_Parents].data() + offsets[Kind_Parents][i + 1];
+								const uint32_t * pOtherParents = neighbors[Kind_Parents].data() + offsets[Kind_Parents][neighborId];
+								const uint32_t * pOtherParentsEnd = neighbors[Kind_Parents].data() + offsets[Kind_Parents][neighborId + 1];
+								conflict = (pParents != pParentsEnd && pOtherParents != pOtherParentsEnd);
+								while(conflict && pParents != pParentsEnd && pOtherParents != pOtherParentsEnd) {
+									if(*pParents < *pOtherParents) {
+										++pParents;
+									}
+									else if(*pOtherParents < *pParents) {
+										++pOtherParents;
+									}
+									else {
+										conflict = false;
+									}
+								}
+							}
+							if(conflict) {
+								threadReport.siblingConflicts++;
+								if(threadReport.issues.size() < MAX_VALIDATION_ISSUES) {
+									threadReport.issues.push_back(m_Members[i]->getName() + " and " + m_Members[neighborId]->getName()
+										+ " are siblings that contradict their parent relationships");
+								}
+							}
+						}
+					}
+				}
+			});
+
+		for(uint32_t i = 0; i < numberOfChunks; i++) {
+			report.duplicateRelationships += threadReports[i].duplicateRelationships;
+			report.siblingConflicts += threadReports[i].siblingConflicts;
+			report.orphanRelationships += threadReports[i].orphanRelationships;
+			for(uint32_t j = 0; j < threadReports[i].issues.size() && report.issues.size() < MAX_VALIDATION_ISSUES; j++) {
+				report.issues.push_back(threadReports[i].issues[j]);
+			}
+		}
+
+		report.valid = (report.cycleMembers == 0 && report.duplicateRelationships == 0
+			&& report.siblingConflicts == 0 && report.orphanRelationships == 0);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::exportGraphFile
+	(
+		string const & outputFileName,
+		string const & format,
+		string const & rootName,
+		uint32_t maxDepth
+	) {
+		string formatName = format;
+		if(formatName.empty()) {
+			string::size_type dot = outputFileName.find_last_of('.');
+			if(dot != string::npos) {
+				formatName = outputFileName.substr(dot + 1);
+			}
+		}
+
+		FamilyTreeGraphWriter::format_t graphFormat;
+		if(FamilyTreeGraphWriter::getFormat(formatName, graphFormat) == false) {
+			FamilyTreeErrorMsg(LOG_ERROR, "Unknown graph file format: %s", formatName.c_str());
+			return INVALID_ARG;
+		}
+
+		// A subtree is collected breadth first, one generation at a
+		// time, so each member is exported at its smallest depth
+		// below the root.  Only the member IDs and one bit per member
+		// are kept.
+		bool wholeTree = rootName.empty();
+		FamilyTreeMemberBitmap exported;
+		vector<uint32_t> memberIds;
+		if(wholeTree == false) {
+			uint32_t rootId = findFamilyMemberId(rootName);
+			if(rootId == INVALID_MEMBER_ID) {
+				FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", rootName.c_str());
+				return FAMILY_MEMBER_NOT_FOUND;
+			}
+
+			exported.reset(m_Members.size());
+			exported.set(rootId);
+			memberIds.push_back(rootId);
+
+			uint32_t depth = 0;
+			uint32_t generationEnd = 1;
+			for(uint32_t head = 0; head < memberIds.size(); head++) {
+				if(head == generationEnd) {
+					depth++;
+					generationEnd = memberIds.size();
+				}
+				if(depth == maxDepth) {
+					break;
+				}
+
+				FamilyMemberSpan children = m_Members[memberIds[head]]->getChildren();
+				for(FamilyMemberSpan::const_iterator it = children.begin(); it != children.end(); ++it) {
+					uint32_t childId = (*it)->getId();
+					if(exported.test(childId) == false) {
+						exported.set(childId);
+						memberIds.push_back(childId);
+					}
+				}
+			}
+		}
+
+		FamilyTreeGraphWriter writer;
+		if(writer.open(outputFileName, graphFormat) == false) {
+			FamilyTreeErrorMsg(LOG_ERROR, "Could not open the file: %s", outputFileName.c_str());
+			return OUTPUT_FILE_OPEN_ERROR;
+		}
+
+		// Every member is written before the first relationship
+		uint32_t numberOfMembers = wholeTree ? m_Members.size() : memberIds.size();
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			FamilyMemberClass * pMember = m_Members[wholeTree ? i : memberIds[i]];
+			if(pMember != NULL) {
+				writer.writeMember(pMember->m_Id, pMember->m_pName, pMember->m_NameLength);
+			}
+		}
+
+		// Each sibling pair is written once, from the smaller member ID
+		for(uint32_t i = 0; i < numberOfMembers; i++) {
+			FamilyMemberClass * pMember = m_Members[wholeTree ? i : memberIds[i]];
+			if(pMember == NULL) {
+				continue;
+			}
+
+			FamilyMemberSpan children = pMember->getChildren();
+			for(FamilyMemberSpan::const_iterator it = children.begin(); it != children.end(); ++it) {
+				uint32_t childId = (*it)->getId();
+				if(wholeTree || exported.test(childId)) {
+					writer.writeRelationship(pMember->m_Id, childId, false);
+				}
+			}
+
+			FamilyMemberSpan siblings = pMember->getSiblings();
+			for(FamilyMemberSpan::const_iterator it = siblings.begin(); it != siblings.end(); ++it) {
+				uint32_t siblingId = (*it)->getId();
+				if(siblingId > pMember->m_Id && (wholeTree || exported.test(siblingId))) {
+					writer.writeRelationship(pMember->m_Id, siblingId, true);
+				}
+			}
+		}
+
+		if(writer.close() == false) {
+			FamilyTreeErrorMsg(LOG_ERROR, "Could not write the file: %s", outputFileName.c_str());
+			return OUTPUT_FILE_WRITE_ERROR;
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getKinshipMemberId(string const & memberName, uint32_t & memberId) {
+		memberId = findFamilyMemberId(memberName);
+		if(memberId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+		// The recursion needs the ancestors of the member to be
+		// ordered by generation
+		updateKinship();
+		if(m_Generations[memberId] == INVALID_GENERATION) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is part of or descends from a parent->child cycle.", memberName.c_str());
+			return INVALID_ARG;
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getKinshipCoefficient
+	(
+		string const & firstMemberName,
+		string const & secondMemberName,
+		double & kinship
+	) {
+		uint32_t firstId;
+		uint32_t secondId;
+		FamilyTreeOpResultCode opResult = getKinshipMemberId(firstMemberName, firstId);
+		if(opResult == SUCCESS) {
+			opResult = getKinshipMemberId(secondMemberName, secondId);
+		}
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		kinship = m_Kinship.getKinship(firstId, secondId);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getRelationshipCoefficient
+	(
+		string const & firstMemberName,
+		string const & secondMemberName,
+		double & relationship
+	) {
+		uint32_t firstId;
+		uint32_t secondId;
+		FamilyTreeOpResultCode opResult = getKinshipMemberId(firstMemberName, firstId);
+		if(opResult == SUCCESS) {
+			opResult = getKinshipMemberId(secondMemberName, secondId);
+		}
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		relationship = m_Kinship.getRelationship(firstId, secondId);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getInbreedingCoefficient
+	(
+		string const & memberName,
+		double & inbreeding
+	) {
+		uint32_t memberId;
+		FamilyTreeOpResultCode opResult = getKinshipMemberId(memberName, memberId);
+		if(opResult != SUCCESS) {
+			return opResult;
+		}
+
+		inbreeding = m_Kinship.getInbreeding(memberId);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getKinshipMatrix
+	(
+		vector<string> const & cohortNames,
+		vector<double> & matrix
+	) {
+		matrix.clear();
+
+		vector<uint32_t> memberIds(cohortNames.size());
+		for(uint32_t i = 0; i < cohortNames.size(); i++) {
+			FamilyTreeOpResultCode opResult = getKinshipMemberId(cohortNames[i], memberIds[i]);
+			if(opResult != SUCCESS) {
+				return opResult;
+			}
+		}
+
+		m_Kinship.getKinshipMatrix(memberIds, matrix);
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::updateNameDictionary() {
+		if(m_NameDictionaryVersion == m_NamesVersion) {
+			return;
+		}
+
+		vector<string> names;
+		names.reserve(m_MemberIndex.size());
+		for(unordered_map<string, uint32_t>::const_iterator it = m_MemberIndex.begin(); it != m_MemberIndex.end(); ++it) {
+			names.push_back(it->first);
+		}
+
+		m_NameDictionary.build(names);
+		m_NameDictionaryVersion = m_NamesVersion;
+	}
+
+    void FamilyTreeClass::getDictionaryPage
+	(
+		uint32_t first,
+		uint32_t end,
+		uint32_t offset,
+		uint32_t maxCount,
+		vector<string> & nameList
+	) {
+		if(offset >= end - first) {
+			nameList.clear();
+			return;
+		}
+
+		uint32_t count = std::min(maxCount, end - first - offset);
+		m_NameDictionary.getNames(first + offset, count, nameList);
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersWithNamePrefix
+	(
+		string const & prefix,
+		uint32_t offset,
+		uint32_t maxCount,
+		vector<string> & nameList,
+		uint32_t & numberOfMatches
+	) {
+		updateNameDictionary();
+
+		uint32_t first;
+		uint32_t end;
+		m_NameDictionary.getPrefixRange(prefix, first, end);
+
+		numberOfMatches = end - first;
+		getDictionaryPage(first, end, offset, maxCount, nameList);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getMembersInNameRange
+	(
+		string const & firstName,
+		string const & lastName,
+		uint32_t offset,
+		uint32_t maxCount,
+		vector<string> & nameList,
+		uint32_t & numberOfMatches
+	) {
+		if(lastName < firstName) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is after %s.", firstName.c_str(), lastName.c_str());
+			return INVALID_ARG;
+		}
+
+		updateNameDictionary();
+
+		uint32_t first = m_NameDictionary.lowerBound(firstName);
+		uint32_t end = m_NameDictionary.upperBound(lastName);
+
+		numberOfMatches = end - first;
+		getDictionaryPage(first, end, offset, maxCount, nameList);
+
+		return SUCCESS;
+	}
+
+    void FamilyTreeClass::updateTrigramIndex() {
+		if(m_TrigramIndexVersion == m_NamesVersion) {
+			return;
+		}
+
+		vector<uint32_t> memberIds;
+		vector<string> names;
+		memberIds.reserve(m_MemberIndex.size());
+		names.reserve(m_MemberIndex.size());
+		for(unordered_map<string, uint32_t>::const_iterator it = m_MemberIndex.begin(); it != m_MemberIndex.end(); ++it) {
+			names.push_back(it->first);
+			memberIds.push_back(it->second);
+		}
+
+		m_TrigramIndex.build(memberIds, names);
+		m_TrigramIndexVersion = m_NamesVersion;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getClosestMemberNames
+	(
+		string const & name,
+		uint32_t maxCount,
+		uint32_t maxDistance,
+		vector<string> & nameList,
+		vector<uint32_t> & distances
+	) {
+		nameList.clear();
+		distances.clear();
+		if(maxCount == 0) {
+			return SUCCESS;
+		}
+
+		updateTrigramIndex();
+
+		// Each edit changes at most 3 trigrams, so a name within
+		// maxDistance edits shares at least (query trigrams -
+		// 3 * maxDistance) of them.  Short queries give no useful
+		// bound and every member is a candidate.
+		vector<uint32_t> trigrams;
+		FamilyTreeTrigramIndex::getTrigrams(name.data(), name.size(), trigrams);
+
+		vector<FamilyTreeTrigramIndex::candidate_t> candidates;
+		if(trigrams.size() > 3 * maxDistance) {
+			m_TrigramIndex.findCandidates(name, trigrams.size() - 3 * maxDistance, candidates);
+		}
+		else {
+			for(uint32_t i = 0; i < m_Members.size(); i++) {
+				if(m_Members[i] != NULL) {
+					FamilyTreeTrigramIndex::candidate_t candidate = { i, 0 };
+					candidates.push_back(candidate);
+				}
+			}
+		}
+
+		// Check the candidates that share the most trigrams first.
+		// Once maxCount names are found, the distance bound drops
+		// to the distance of the worst of them.
+		struct {
+			bool operator()(FamilyTreeTrigramIndex::candidate_t const & a, FamilyTreeTrigramIndex::candidate_t const & b) const {
+				return a.sharedTrigrams > b.sharedTrigrams;
+			}
+		} sharesMore;
+		std::stable_sort(candidates.begin(), candidates.end(), sharesMore);
+
+		vector< pair<uint32_t, string> > matches;
+		uint32_t bound = maxDistance;
+		for(uint32_t i = 0; i < candidates.size(); i++) {
+			FamilyMemberClass * pFamilyMember = m_Members[candidates[i].memberId];
+			uint32_t distance = FamilyTreeTrigramIndex::getBoundedEditDistance(name.data(), name.size(),
+				pFamilyMember->m_pName, pFamilyMember->m_NameLength, bound);
+			if(distance > bound) {
+				continue;
+			}
+
+			matches.push_back(make_pair(distance, pFamilyMember->getName()));
+			std::push_heap(matches.begin(), matches.end());
+			if(matches.size() > maxCount) {
+				std::pop_heap(matches.begin(), matches.end());
+				matches.pop_back();
+			}
+			if(matches.size() == maxCount) {
+				bound = matches.front().first;
+			}
+		}
+
+		std::sort_heap(matches.begin(), matches.end());
+		for(uint32_t i = 0; i < matches.size(); i++) {
+			distances.push_back(matches[i].first);
+			nameList.push_back(matches[i].second);
+		}
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::enableResultCache(uint32_t capacity, uint32_t numberOfShards) {
+		if(capacity > 0 && numberOfShards == 0) {
+			FamilyTreeErrorMsg(LOG_ERROR, "The result cache needs at least one shard.");
+			return INVALID_ARG;
+		}
+
+		m_ResultCache.configure(capacity, numberOfShards);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::getResultCacheStats(result_cache_stats_t & stats) {
+		m_ResultCache.getStats(stats);
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::resetResultCacheStats() {
+		m_ResultCache.resetStats();
+
+		return SUCCESS;
+	}
+
+    FamilyTreeOpResultCode FamilyTreeClass::addFamilyMembers(vector<string> const & names) {
+        for(vector<string>::const_iterator it = names.begin(); it != names.end(); ++it) {
+            FamilyTreeOpResultCode result = addFamilyMember(*it);
+            if(result != SUCCESS) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Failed to add family member %s.", it->c_str());
+                return result;
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::removeFamilyMembers(vector<string> const & names) {
+        // Look up every member first so that
+        // nothing is removed if one is missing
+        vector<uint32_t> memberIds;
+        for(vector<string>::const_iterator it = names.begin(); it != names.end(); ++it) {
+            uint32_t memberId = findFamilyMemberId(*it);
+            if(memberId == INVALID_MEMBER_ID) {
+                FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", it->c_str());
+                return FAMILY_MEMBER_NOT_FOUND;
+            }
+            memberIds.push_back(memberId);
+        }
+
+        for(vector<uint32_t>::const_iterator it = memberIds.begin(); it != memberIds.end(); ++it) {
+            // The same name may be listed more than once
+            if(m_Members[*it] == NULL) {
+                continue;
+            }
+
+            FamilyTreeOpResultCode result = removeFamilyMember(*it);
+            if(result != SUCCESS) {
+                return result;
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::addRelationships(vector<relationship_record_t> const & relationships) {
+        // Look up every member first so that
+        // nothing is added if one is missing
+        vector<uint32_t> fromIds;
+        vector<uint32_t> toIds;
+        for(vector<relationship_record_t>::const_iterator it = relationships.begin(); it != relationships.end(); ++it) {
+            uint32_t fromId = findFamilyMemberId(it->from);
+            uint32_t toId = findFamilyMemberId(it->to);
+            if(fromId == INVALID_MEMBER_ID || toId == INVALID_MEMBER_ID) {
+                FamilyTreeErrorMsg(LOG_ERROR, "%s or %s is not in the family tree.", it->from.c_str(), it->to.c_str());
+                return FAMILY_MEMBER_NOT_FOUND;
+            }
+            if(fromId == toId) {
+                FamilyTreeErrorMsg(LOG_ERROR, "%s cannot be related to itself.", it->from.c_str());
+                return INVALID_ARG;
+            }
+            fromIds.push_back(fromId);
+            toIds.push_back(toId);
+        }
+
+        for(unsigned int i = 0; i < relationships.size(); i++) {
+            FamilyTreeOpResultCode result = addFamilyRelationship(fromIds[i], toIds[i], relationships[i].relationship, relationships[i].flags);
+            if(result != SUCCESS) {
+                return result;
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::removeRelationships(vector<relationship_record_t> const & relationships) {
+        // Make sure every relationship is in the tree
+        // first so that nothing is removed if one is missing
+        vector<uint32_t> fromIds;
+        vector<uint32_t> toIds;
+        for(vector<relationship_record_t>::const_iterator it = relationships.begin(); it != relationships.end(); ++it) {
+            uint32_t fromId = findFamilyMemberId(it->from);
+            uint32_t toId = findFamilyMemberId(it->to);
+            if(fromId == INVALID_MEMBER_ID || toId == INVALID_MEMBER_ID) {
+                FamilyTreeErrorMsg(LOG_ERROR, "%s or %s is not in the family tree.", it->from.c_str(), it->to.c_str());
+                return FAMILY_MEMBER_NOT_FOUND;
+            }
+            if(findRelationship(fromId, toId, it->relationship) == NULL) {
+                FamilyTreeErrorMsg(LOG_ERROR, "%s->%s relationship is not in the family tree.", it->from.c_str(), it->to.c_str());
+                return RELATIONSHIP_NOT_FOUND;
+            }
+            fromIds.push_back(fromId);
+            toIds.push_back(toId);
+        }
+
+        for(unsigned int i = 0; i < relationships.size(); i++) {
+            // The same relationship may be listed more than once
+            if(findRelationship(fromIds[i], toIds[i], relationships[i].relationship) == NULL) {
+                continue;
+            }
+
+            FamilyTreeOpResultCode result = removeFamilyRelationship(fromIds[i], toIds[i], relationships[i].relationship);
+            if(result != SUCCESS) {
+                return result;
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::addFamilyRelationship
+    (
+        uint32_t fromId,
+        uint32_t toId,
+        relationship_t relationship,
+        uint32_t flags
+    ) {
+        // Family relationships are stored as a pair of
+        // directed edges.  Normalize child->parent to
+        // parent->child so both cases add the same pair.
+        if(relationship == Child_Parent) {
+            return addFamilyRelationship(toId, fromId, Parent_Child, flags);
+        }
+
+        // Skip relationships that are already in the tree
+        if(findRelationship(fromId, toId, relationship) != NULL) {
+            return SUCCESS;
+        }
+
+        FamilyTreeOpResultCode result = addRelationship(fromId, toId, relationship, flags);
+        if(result != SUCCESS) {
+            return result;
+        }
+
+        return addRelationship(toId, fromId, (relationship == Parent_Child) ? Child_Parent : Sibling, flags);
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::findFamilyRelationship
+    (
+        string const & from,
+        string const & to,
+        relationship_t relationship,
+        FamilyRelationshipClass * & pForward,
+        FamilyRelationshipClass * & pReverse
+    ) {
+        uint32_t fromId = findFamilyMemberId(from);
+        uint32_t toId = findFamilyMemberId(to);
+        if(fromId == INVALID_MEMBER_ID || toId == INVALID_MEMBER_ID) {
+            FamilyTreeErrorMsg(LOG_ERROR, "%s or %s is not in the family tree.", from.c_str(), to.c_str());
+            return FAMILY_MEMBER_NOT_FOUND;
+        }
+
+        relationship_t reverse = (relationship == Parent_Child) ? Child_Parent :
+                                 (relationship == Child_Parent) ? Parent_Child : Sibling;
+        pForward = findRelationship(fromId, toId, relationship);
+        pReverse = findRelationship(toId, fromId, reverse);
+        if(pForward == NULL || pReverse == NULL) {
+            FamilyTreeErrorMsg(LOG_ERROR, "%s->%s relationship is not in the family tree.", from.c_str(), to.c_str());
+            return RELATIONSHIP_NOT_FOUND;
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::getRelationshipFlags
+    (
+        string const & from,
+        string const & to,
+        relationship_t relationship,
+        uint32_t & flags
+    ) {
+        FamilyRelationshipClass * pForward;
+        FamilyRelationshipClass * pReverse;
+        FamilyTreeOpResultCode result = findFamilyRelationship(from, to, relationship, pForward, pReverse);
+        if(result != SUCCESS) {
+            return result;
+        }
+
+        flags = pForward->getFlags();
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::setRelationshipAttribute
+    (
+        string const & from,
+        string const & to,
+        relationship_t relationship,
+        string const & name,
+        int32_t value
+    ) {
+        FamilyRelationshipClass * pForward;
+        FamilyRelationshipClass * pReverse;
+        FamilyTreeOpResultCode result = findFamilyRelationship(from, to, relationship, pForward, pReverse);
+        if(result != SUCCESS) {
+            return result;
+        }
+
+        // Both directions hold the attribute.  The name is
+        // copied into the arena the first time it is set.
+        FamilyRelationshipClass * pRelationships[] = { pForward, pReverse };
+        const char * pName = NULL;
+        for(unsigned int i = 0; i < 2; i++) {
+            int32_t * pValue = pRelationships[i]->getAttributes().getIntAttribute(name.c_str());
+            if(pValue != NULL) {
+                *pValue = value;
+                continue;
+            }
+
+            if(pName == NULL) {
+                pName = m_Arena.copyString(name);
+            }
+            if(pName == NULL || pRelationships[i]->getAttributes().setIntAttribute(pName, value, m_Arena) == false) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Failed to allocate relationship attribute %s.", name.c_str());
+                return ADD_EDGE_ERROR;
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::getRelationshipAttribute
+    (
+        string const & from,
+        string const & to,
+        relationship_t relationship,
+        string const & name,
+        int32_t & value,
+        bool & isSet
+    ) {
+        FamilyRelationshipClass * pForward;
+        FamilyRelationshipClass * pReverse;
+        FamilyTreeOpResultCode result = findFamilyRelationship(from, to, relationship, pForward, pReverse);
+        if(result != SUCCESS) {
+            return result;
+        }
+
+        int32_t * pValue = pForward->getAttributes().getIntAttribute(name.c_str());
+        isSet = (pValue != NULL);
+        if(isSet) {
+            value = *pValue;
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::removeFamilyRelationship
+    (
+        uint32_t fromId,
+        uint32_t toId,
+        relationship_t relationship
+    ) {
+        if(relationship == Child_Parent) {
+            return removeFamilyRelationship(toId, fromId, Parent_Child);
+        }
+
+        FamilyTreeOpResultCode result = removeRelationship(fromId, toId, relationship);
+        if(result != SUCCESS) {
+            return result;
+        }
+
+        // The reverse edge may be missing if the input
+        // file only declared one direction
+        result = removeRelationship(toId, fromId, (relationship == Parent_Child) ? Child_Parent : Sibling);
+        if(result == RELATIONSHIP_NOT_FOUND) {
+            return SUCCESS;
+        }
+
+        return result;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::removeRelationship
+    (
+        uint32_t fromId,
+        uint32_t toId,
+        relationship_t relationship
+    ) {
+        FamilyRelationshipClass * pRelationship = findRelationship(fromId, toId, relationship);
+        if(pRelationship == NULL) {
+            return RELATIONSHIP_NOT_FOUND;
+        }
+
+        // Find the view rows that use the relationship while it is still linked
+        invalidateMaterializedViews(fromId, relationship);
+
+        // Unlink the relationship from both members and
+        // keep it so that the next new relationship reuses it
+        m_Members[fromId]->removeOutgoingRelationship(pRelationship);
+        m_Members[toId]->removeIncomingRelationship(pRelationship);
+        m_Members[fromId]->removeNeighbor(relationship, m_Members[toId]);
+        pRelationship->m_pNextOutgoing = m_pFreeRelationships;
+        m_pFreeRelationships = pRelationship;
+
+        // The family may be split, which the union-find cannot undo
+        m_FamiliesStale = true;
+
+        // Update the derived counts of the from member
+        // and the family unit of a child
+        if(relationship == Parent_Child) {
+            updateCountsForParentChild(fromId, toId, -1);
+        }
+        else if(relationship == Child_Parent) {
+            m_FamilyUnits.removeParent(fromId, toId);
+        }
+        else if(relationship == Sibling) {
+            m_SiblingCounts.adjustCount(fromId, -1);
+        }
+        bumpStructureVersion();
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::removeFamilyMember(uint32_t memberId) {
+        FamilyMemberClass * pFamilyMember = m_Members[memberId];
+
+        // Remove every relationship of the member so that the
+        // derived counts of the other members are updated.
+        // The relationships are read before any of them is
+        // removed because removing a relationship removes both
+        // of its directions.
+        vector<uint32_t> otherIds;
+        vector<relationship_t> otherRelationships;
+        FamilyRelationshipClass * pRelationship = pFamilyMember->getFirstOutgoingRelationship();
+        for (; pRelationship != NULL; pRelationship = pRelationship->getNextOutgoing()) {
+            otherIds.push_back(pRelationship->getTo()->getId());
+            otherRelationships.push_back((relationship_t)pRelationship->getRelationship());
+        }
+
+        for (unsigned int i = 0; i < otherIds.size(); i++) {
+            if(findRelationship(memberId, otherIds[i], otherRelationships[i]) == NULL) {
+                continue;
+            }
+
+            FamilyTreeOpResultCode result = removeFamilyRelationship(memberId, otherIds[i], otherRelationships[i]);
+            if(result != SUCCESS) {
+                return result;
+            }
+        }
+
+        // Remove the incoming relationships that did not
+        // have a matching relationship from the member
+        otherIds.clear();
+        otherRelationships.clear();
+        pRelationship = pFamilyMember->getFirstIncomingRelationship();
+        for (; pRelationship != NULL; pRelationship = pRelationship->getNextIncoming()) {
+            otherIds.push_back(pRelationship->getFrom()->getId());
+            otherRelationships.push_back((relationship_t)pRelationship->getRelationship());
+        }
+
+        for (unsigned int i = 0; i < otherIds.size(); i++) {
+            FamilyTreeOpResultCode result = removeRelationship(otherIds[i], memberId, otherRelationships[i]);
+            if(result != SUCCESS) {
+                return result;
+            }
+        }
+
+        // Remove the member from the indexes.  Its storage
+        // stays in the arena until the tree is cleared.
+        m_MemberIndex.erase(pFamilyMember->getName());
+        m_NamesVersion++;
+        m_ChildCounts.removeMember(memberId);
+        m_SiblingCounts.removeMember(memberId);
+        m_GrandchildCounts.removeMember(memberId);
+        m_AttributeColumns.removeMember(memberId);
+        m_FamilyUnits.removeMember(memberId);
+        m_FamiliesStale = true;
+        m_Members[memberId] = NULL;
+        bumpStructureVersion();
+        m_FreeMemberIds.push_back(memberId);
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::addRelationship
+    (
+        string const & from,
+        string const & to,
+        relationship_t relationship
+    ) {
+    	// Retrieve the FamilyMemberClass objects for
+    	// the from and to family members.  Return
+    	// error if one of them is not present in the tree.
+        uint32_t fromId = findFamilyMemberId(from);
+        if(fromId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", from.c_str());
+        	return FAMILY_MEMBER_NOT_FOUND;
+        }
+
+        uint32_t toId = findFamilyMemberId(to);
+        if(toId == INVALID_MEMBER_ID) {
+			FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", to.c_str());
+			return FAMILY_MEMBER_NOT_FOUND;
+		}
+
+        // Repeated input records must not add the relationship twice
+        if(findRelationship(fromId, toId, relationship) != NULL) {
+            FamilyTreeLogMsg(LOG_DEBUG, "Skipping duplicate relationship %s->%s", from.c_str(), to.c_str());
+            m_DuplicatesSkipped++;
+            return SUCCESS;
+        }
+
+        return addRelationship(fromId, toId, relationship);
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::addRelationship
+    (
+        uint32_t fromId,
+        uint32_t toId,
+        relationship_t relationship,
+        uint32_t flags
+    ) {
+        FamilyMemberClass * fromMember = m_Members[fromId];
+        FamilyMemberClass * toMember = m_Members[toId];
+
+        // Reuse a removed relationship if there is one.
+        // Otherwise create a new one in the arena.
+        FamilyRelationshipClass * newRelationship = m_pFreeRelationships;
+        if(newRelationship != NULL) {
+            m_pFreeRelationships = newRelationship->m_pNextOutgoing;
+        }
+        else {
+            newRelationship = m_Arena.create<FamilyRelationshipClass>();
+            if(newRelationship == NULL) {
+                // Print error Message
+                FamilyTreeErrorMsg(LOG_ERROR, "Failed to allocate relationship %s->%s.",
+                    fromMember->getName().c_str(),
+                    toMember->getName().c_str()
+                );
+
+                // Return error code
+                return ADD_EDGE_ERROR;
+            }
+        }
+
+        // Store the relationship type and flags in the tag of
+        // the relationship.  A reused relationship starts
+        // without any of its previous attributes.
+        newRelationship->setTag(relationship, flags);
+        newRelationship->m_Attributes = FamilyTreeAttributeCollection();
+
+        // Add toMember to the adjacency cache of fromMember
+        if(fromMember->addNeighbor(relationship, toMember, m_Arena) == false) {
+            // Print error Message
+            FamilyTreeErrorMsg(LOG_ERROR, "Failed to add %s to the adjacency cache of %s.",
+                toMember->getName().c_str(),
+                fromMember->getName().c_str()
+            );
+
+            // Keep the relationship for reuse
+            newRelationship->m_pNextOutgoing = m_pFreeRelationships;
+            m_pFreeRelationships = newRelationship;
+
+            // Return error code
+            return ADD_EDGE_ERROR;
+        }
+
+        // Link the relationship from fromMember to toMember
+        newRelationship->m_pFrom = fromMember;
+        newRelationship->m_pTo = toMember;
+        fromMember->addOutgoingRelationship(newRelationship);
+        toMember->addIncomingRelationship(newRelationship);
+        invalidateMaterializedViews(fromId, relationship);
+        if(m_FamiliesStale == false) {
+            m_Families.unite(fromId, toId);
+        }
+
+        // Update the derived counts of the from member
+        // and the family unit of a child
+        if(relationship == Parent_Child) {
+            updateCountsForParentChild(fromId, toId, 1);
+        }
+        else if(relationship == Child_Parent) {
+            m_FamilyUnits.addParent(fromId, toId);
+        }
+        else if(relationship == Sibling) {
+            m_SiblingCounts.adjustCount(fromId, 1);
+        }
+        bumpStructureVersion();
+   
+        // If we have reached here, everything is correct
+        // Return SUCCESS
+        return SUCCESS;
+    }
+    
+    FamilyTreeOpResultCode FamilyTreeClass::addFamilyMember(string const & name) {
+        // Member names MUST be unique.  If the member
+        // is already in the tree there is nothing to do.
+        if(findFamilyMemberId(name) != INVALID_MEMBER_ID) {
+            FamilyTreeLogMsg(LOG_DEBUG, "Family member %s is already in the family tree", name.c_str());
+            return SUCCESS;
+        }
+
+        // Create the member object in the arena
+        FamilyMemberClass * pFamilyMember = m_Arena.create<FamilyMemberClass>();
+        const char * pName = m_Arena.copyString(name);
+        if(pFamilyMember == NULL || pName == NULL) {
+            // Print error Message
+            FamilyTreeErrorMsg(LOG_ERROR, "Failed to allocate family member %s", name.c_str());
+
+            // Return error code
+            return OBJECT_INSTANTIATION_ERROR;
+        }
+
+        // Give the member a member ID (reusing the ID of
+        // a removed member if there is one) and add it to
+        // the name index and count indexes
+        uint32_t memberId;
+        if(m_FreeMemberIds.empty() == false) {
+            memberId = m_FreeMemberIds.back();
+            m_FreeMemberIds.pop_back();
+            m_Members[memberId] = pFamilyMember;
+        }
+        else {
+            memberId = m_Members.size();
+            m_Members.push_back(pFamilyMember);
+        }
+
+        // Set the ID and name of the family member
+        pFamilyMember->m_Id = memberId;
+        pFamilyMember->m_pName = pName;
+        pFamilyMember->m_NameLength = name.size();
+
+        m_MemberIndex[name] = memberId;
+        m_NamesVersion++;
+        m_NameFilter.add(name);
+        if(m_NameFilter.isFull()) {
+            rebuildNameFilter();
+        }
+        m_ChildCounts.addMember(memberId);
+        m_SiblingCounts.addMember(memberId);
+        m_GrandchildCounts.addMember(memberId);
+        m_AttributeColumns.addMember(memberId);
+        m_FamilyUnits.addMember(memberId);
+        if(m_FamiliesStale == false) {
+            m_Families.addMember(memberId);
+        }
+        for(map<string, FamilyTreeMaterializedView>::iterator it = m_MaterializedViews.begin(); it != m_MaterializedViews.end(); ++it) {
+            it->second.markDirty(memberId);
+        }
+        bumpStructureVersion();
+
+        FamilyTreeLogMsg(LOG_DEBUG, "Added family member %s to the family tree",
+            pFamilyMember->getName().c_str());
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::processInputLine(string const & currentLine) {
+        // Skip comment lines or white space lines
+        if(currentLine.empty() || currentLine[0] == '#' || currentLine[0] == '/') {
+            return SUCCESS;
+        }
+
+        // Split the current line into tokens based on the delimeter
+        vector<string> currentLineTokens;
+        boost::split(currentLineTokens, currentLine, boost::is_any_of(":"));
+
+        // Create the member objects and add them as vertices to the graph
+        if(currentLineTokens[0].compare("MEMBERS") == 0) {
+            FamilyTreeLogMsg(LOG_DEBUG, "Adding %lu family members to the family tree", currentLineTokens.size() - 1);
+            for(unsigned int i = 1; i < currentLineTokens.size(); i++) {
+                FamilyTreeOpResultCode result = addFamilyMember(currentLineTokens[i]);
+                if(result != SUCCESS) {
+                    return result;
+                }
+            }
+        }
+        else if (currentLineTokens[0].compare("PARENT") == 0) {
+            FamilyTreeLogMsg(LOG_DEBUG, "Adding the parent-child relationships to the family tree");
+            if(currentLineTokens.size() < 3) {
+                FamilyTreeErrorMsg(LOG_ERROR, "PARENT record formatted incorrectly");
+                return INPUT_FILE_FORMAT_ERROR;
+            }
+
+            // Every member must be in the tree before any of the
+            // relationships is added, so a record that fails is
+            // not left half applied
+            for(unsigned int i = 1; i < currentLineTokens.size(); i++) {
+                if(i != 2 && findFamilyMemberId(currentLineTokens[i]) == INVALID_MEMBER_ID) {
+                    FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", currentLineTokens[i].c_str());
+                    return TREE_CONSTRUCTION_ERROR;
+                }
+            }
+
+            // Find the parent vertex
+            string parentName = currentLineTokens[1];
+
+            FamilyTreeLogMsg
+            (
+                LOG_DEBUG,
+                "Adding the parent->child and child->parent relationships for parent %s to the family tree.",
+                parentName.c_str()
+            );
+
+            // For each child, add a parent->child edge to the graph
+            for(unsigned int i = 3; i < currentLineTokens.size(); i++) {
+                // Find the child vertex
+                string currentChildName = currentLineTokens[i];
+
+                // Add the parent->child relationship to the graph
+                if(addRelationship(parentName, currentChildName, Parent_Child) != SUCCESS) {
+                    // Log error message
+                    FamilyTreeErrorMsg(
+                        LOG_ERROR,
+                        "Failed to add the parent->child relationship %s->%s to the family tree",
+                        parentName.c_str(),
+                        currentChildName.c_str()
+                    );
+
+                    // return error
+                    return TREE_CONSTRUCTION_ERROR;
+                }
+                else {
+                    FamilyTreeLogMsg(
+                        LOG_DEBUG,
+                        "Successfully added the parent->child relationship %s->%s to the family tree",
+                        parentName.c_str(),
+                        currentChildName.c_str()
+                    );
+                }
+
+                // Add the child->parent relationship to the graph
+                if(addRelationship(currentChildName, parentName, Child_Parent) != SUCCESS) {
+                    // Log error message
+                    FamilyTreeErrorMsg(
+                        LOG_ERROR,
+                        "Failed to add the child->parent relationship %s->%s to the family tree",
+                        currentChildName.c_str(),
+                        parentName.c_str()
+                    );
+
+                    // return error
+                    return TREE_CONSTRUCTION_ERROR;
+                }
+                else {
+                    FamilyTreeLogMsg(
+                        LOG_DEBUG,
+                        "Successfully added the child->parent relationship %s->%s to the family tree",
+                        currentChildName.c_str(),
+                        parentName.c_str()
+                    );
+                }
+            }
+        }
+        else if (currentLineTokens[0].compare("SIBLINGS") == 0) {
+            FamilyTreeLogMsg(LOG_DEBUG, "Adding the sibling relationships to the family tree");
+            for(unsigned int i = 1; i < currentLineTokens.size(); i++) {
+                if(findFamilyMemberId(currentLineTokens[i]) == INVALID_MEMBER_ID) {
+                    FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", currentLineTokens[i].c_str());
+                    return TREE_CONSTRUCTION_ERROR;
+                }
+            }
+
+            // Loop through the sibling entries and add
+            // link them together.  Siblings should have
+            // directed edges to and from one another
+            for(unsigned int i = 1; i < currentLineTokens.size(); i++) {
+                // Find the mainSibling vertex
+                string mainSiblingName = currentLineTokens[i];
+
+                for(unsigned int j = 1; j < currentLineTokens.size(); j++) {
+                    // Do not add a relationship for sibling to itself
+                    if(i == j) {
+                        continue;
+                    }
+
+                    // Find the other sibling vertex
+                    string currentSiblingName = currentLineTokens[j];
+                    FamilyTreeLogMsg
+                    (
+                        LOG_DEBUG,
+                        "Adding the %s->%s sibling relationships to the family tree.",
+                        mainSiblingName.c_str(),
+                        currentSiblingName.c_str()
+                    );
+
+                    // Add the sibling->sibling relationship to the graph
+                    if(addRelationship(mainSiblingName, currentSiblingName, Sibling) != SUCCESS) {
+                        // Log error message
+                        FamilyTreeErrorMsg(
+                            LOG_ERROR,
+                            "Failed to add the %s->%s sibling relationship to the family tree",
+                            mainSiblingName.c_str(),
+                            currentSiblingName.c_str()
+                        );
+
+                        // return error
+                        return TREE_CONSTRUCTION_ERROR;
+                    }
+                    else {
+                        // Log error message
+                        FamilyTreeLogMsg(
+                            LOG_DEBUG,
+                            "Successfully added the %s->%s sibling to the family tree",
+                            mainSiblingName.c_str(),
+                            currentSiblingName.c_str()
+                        );
+                    }
+                }
+            }
+        }
+        else if (currentLineTokens[0].compare("ATTRIBUTES") == 0) {
+            return processAttributesRecord(currentLineTokens);
+        }
+        else {
+            // Print error Message
+            FamilyTreeErrorMsg(LOG_ERROR, "Input file formatted incorrectly");
+
+            // Return false
+            return INPUT_FILE_FORMAT_ERROR;
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::processAttributesRecord(vector<string> const & tokens) {
+        // The record is ATTRIBUTES:<name> followed by
+        // <field>:<value> pairs
+        if(tokens.size() < 2 || (tokens.size() % 2) != 0) {
+            FamilyTreeErrorMsg(LOG_ERROR, "ATTRIBUTES record formatted incorrectly");
+            return INPUT_FILE_FORMAT_ERROR;
+        }
+
+        string const & memberName = tokens[1];
+        uint32_t memberId = findFamilyMemberId(memberName);
+        if(memberId == INVALID_MEMBER_ID) {
+            FamilyTreeErrorMsg(LOG_ERROR, "%s is not in the family tree.", memberName.c_str());
+            return TREE_CONSTRUCTION_ERROR;
+        }
+
+        // Parse every field before any of them is applied
+        member_attributes_t attributes;
+        m_AttributeColumns.getAttributes(memberId, attributes);
+        for(unsigned int i = 2; i < tokens.size(); i += 2) {
+            string const & field = tokens[i];
+            string const & value = tokens[i + 1];
+            char * pEnd = NULL;
+
+            if(field.compare("AGE") == 0) {
+                unsigned long age = strtoul(value.c_str(), &pEnd, 10);
+                if(value.empty() || *pEnd != '\0' || age >= FamilyTreeAttributeColumns::INVALID_AGE) {
+                    FamilyTreeErrorMsg(LOG_ERROR, "Invalid age %s for %s", value.c_str(), memberName.c_str());
+                    return INPUT_FILE_FORMAT_ERROR;
+                }
+                attributes.age = (uint8_t)age;
+            }
+            else if(field.compare("GENDER") == 0) {
+                if(value.compare("Male") == 0) {
+                    attributes.gender = FamilyMemberClass::Male;
+                }
+                else if(value.compare("Female") == 0) {
+                    attributes.gender = FamilyMemberClass::Female;
+                }
+                else if(value.compare("Other") == 0) {
+                    attributes.gender = FamilyMemberClass::Other;
+                }
+                else {
+                    FamilyTreeErrorMsg(LOG_ERROR, "Invalid gender %s for %s", value.c_str(), memberName.c_str());
+                    return INPUT_FILE_FORMAT_ERROR;
+                }
+            }
+            else if(field.compare("BIRTH_YEAR") == 0) {
+                long birthYear = strtol(value.c_str(), &pEnd, 10);
+                if(value.empty() || *pEnd != '\0' || birthYear <= FamilyTreeAttributeColumns::INVALID_BIRTH_YEAR || birthYear > INT16_MAX) {
+                    FamilyTreeErrorMsg(LOG_ERROR, "Invalid birth year %s for %s", value.c_str(), memberName.c_str());
+                    return INPUT_FILE_FORMAT_ERROR;
+                }
+                attributes.birthYear = (int16_t)birthYear;
+            }
+            else {
+                FamilyTreeErrorMsg(LOG_ERROR, "Unknown attribute %s for %s", field.c_str(), memberName.c_str());
+                return INPUT_FILE_FORMAT_ERROR;
+            }
+        }
+
+        m_AttributeColumns.setAttributes(memberId, attributes);
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::constructTreeFromFile(string const & inputFileName) {
+
+        // Try and open the input file
+        ifstream infile(inputFileName.c_str(), ios::in | ios::binary);
+
+        if(infile.is_open() == false) {
+            // Print error Message
+            FamilyTreeErrorMsg(LOG_ERROR, "Could not open the file: %s", inputFileName.c_str());
+
+            // Close input file
+            infile.close();
+
+            // Return error code
+            return INPUT_FILE_OPEN_ERROR;
+        }
+
+        // Read from input file line by line and construct the tree.
+        // The last line is applied even if it has no newline.
+        m_inputFileOffset = 0;
+        string currentLine;
+        while(getline(infile, currentLine)) {
+            FamilyTreeOpResultCode result = processInputLine(currentLine);
+            if(result != SUCCESS) {
+                // Close input file
+                infile.close();
+
+                return result;
+            }
+
+            // Remember where the applied records end so that
+            // followInputFile starts from the next one (the end
+            // of the file once the last line has been read)
+            m_inputFileOffset += currentLine.size() + (infile.eof() ? 0 : 1);
+        }
+
+        // Close input file
+		infile.close();
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::addGedcomIndividual
+    (
+        FamilyTreeGedcomReader::record_t const & record,
+        unordered_map<string, uint32_t> & xrefIds
+    ) {
+        if(xrefIds.find(record.xref) != xrefIds.end()) {
+            FamilyTreeErrorMsg(LOG_ERROR, "Individual @%s@ is defined more than once", record.xref.c_str());
+            return INPUT_FILE_FORMAT_ERROR;
+        }
+
+        // Member names must be unique but GEDCOM names are not
+        string name = record.name.empty() ? record.xref : record.name;
+        if(findFamilyMemberId(name) != INVALID_MEMBER_ID) {
+            name += " (" + record.xref + ")";
+            if(findFamilyMemberId(name) != INVALID_MEMBER_ID) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Could not give individual @%s@ a unique name", record.xref.c_str());
+                return TREE_CONSTRUCTION_ERROR;
+            }
+        }
+
+        FamilyTreeOpResultCode result = addFamilyMember(name);
+        if(result != SUCCESS) {
+            return result;
+        }
+        uint32_t memberId = findFamilyMemberId(name);
+        xrefIds[record.xref] = memberId;
+
+        member_attributes_t attributes;
+        m_AttributeColumns.getAttributes(memberId, attributes);
+        switch(record.sex) {
+            case 0:		break;
+            case 'M':	attributes.gender = FamilyMemberClass::Male; break;
+            case 'F':	attributes.gender = FamilyMemberClass::Female; break;
+            case 'U':	attributes.gender = FamilyMemberClass::Unknown; break;
+            default:	attributes.gender = FamilyMemberClass::Other; break;
+        }
+        if(record.birthYear > FamilyTreeAttributeColumns::INVALID_BIRTH_YEAR && record.birthYear <= INT16_MAX) {
+            attributes.birthYear = (int16_t)record.birthYear;
+        }
+        m_AttributeColumns.setAttributes(memberId, attributes);
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::addGedcomFamily
+    (
+        FamilyTreeGedcomReader::record_t const & record,
+        unordered_map<string, uint32_t> const & xrefIds,
+        bool & resolved
+    ) {
+        // Every individual of the family must have been read
+        vector<uint32_t> parentIds;
+        vector<uint32_t> childIds;
+        resolved = false;
+        for(vector<string>::const_iterator it = record.parents.begin(); it != record.parents.end(); ++it) {
+            unordered_map<string, uint32_t>::const_iterator found = xrefIds.find(*it);
+            if(found == xrefIds.end()) {
+                return SUCCESS;
+            }
+            parentIds.push_back(found->second);
+        }
+        for(vector<string>::const_iterator it = record.children.begin(); it != record.children.end(); ++it) {
+            unordered_map<string, uint32_t>::const_iterator found = xrefIds.find(*it);
+            if(found == xrefIds.end()) {
+                return SUCCESS;
+            }
+            childIds.push_back(found->second);
+        }
+        resolved = true;
+
+        // Relationships that are already in the tree (from another
+        // family of the same parents) are skipped
+        for(uint32_t i = 0; i < childIds.size(); i++) {
+            for(uint32_t j = 0; j < parentIds.size(); j++) {
+                if(parentIds[j] == childIds[i]) {
+                    continue;
+                }
+                FamilyTreeOpResultCode result = addFamilyRelationship(parentIds[j], childIds[i], Parent_Child);
+                if(result != SUCCESS) {
+                    return result;
+                }
+            }
+
+            for(uint32_t j = i + 1; j < childIds.size(); j++) {
+                if(childIds[j] == childIds[i]) {
+                    continue;
+                }
+                FamilyTreeOpResultCode result = addFamilyRelationship(childIds[i], childIds[j], Sibling);
+                if(result != SUCCESS) {
+                    return result;
+                }
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::constructTreeFromGedcom(string const & inputFileName) {
+        FamilyTreeGedcomReader reader;
+        if(reader.open(inputFileName) == false) {
+            FamilyTreeErrorMsg(LOG_ERROR, "Could not open the file: %s", inputFileName.c_str());
+            return INPUT_FILE_OPEN_ERROR;
+        }
+
+        // Families are added as soon as they are read.  Only the
+        // families that refer to individuals further down the file
+        // are kept until the end.
+        unordered_map<string, uint32_t> xrefIds;
+        vector<FamilyTreeGedcomReader::record_t> pendingFamilies;
+        FamilyTreeGedcomReader::record_t record;
+        while(reader.readRecord(record)) {
+            FamilyTreeOpResultCode result;
+            if(record.type == FamilyTreeGedcomReader::Record_Individual) {
+                result = addGedcomIndividual(record, xrefIds);
+            }
+            else {
+                bool resolved;
+                result = addGedcomFamily(record, xrefIds, resolved);
+                if(result == SUCCESS && resolved == false) {
+                    pendingFamilies.push_back(record);
+                }
+            }
+
+            if(result != SUCCESS) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Failed to add record @%s@ ending at line %llu",
+                    record.xref.c_str(), (unsigned long long)reader.getLineNumber());
+                return result;
+            }
+        }
+
+        if(reader.failed()) {
+            FamilyTreeErrorMsg(LOG_ERROR, "GEDCOM line %llu formatted incorrectly", (unsigned long long)reader.getLineNumber());
+            return INPUT_FILE_FORMAT_ERROR;
+        }
+
+        for(vector<FamilyTreeGedcomReader::record_t>::const_iterator it = pendingFamilies.begin(); it != pendingFamilies.end(); ++it) {
+            bool resolved;
+            FamilyTreeOpResultCode result = addGedcomFamily(*it, xrefIds, resolved);
+            if(result != SUCCESS) {
+                return result;
+            }
+            if(resolved == false) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Family @%s@ refers to an individual that is not in the file", it->xref.c_str());
+                return TREE_CONSTRUCTION_ERROR;
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    bool FamilyTreeClass::getGraphEdgeRelationship(string const & label, bool directed, relationship_t & relationship) {
+        string type = boost::algorithm::to_lower_copy(label);
+        if(type.empty()) {
+            relationship = directed ? Parent_Child : Sibling;
+        }
+        else if(type == "parent" || type == "parent_child") {
+            relationship = Parent_Child;
+        }
+        else if(type == "child" || type == "child_parent") {
+            relationship = Child_Parent;
+        }
+        else if(type == "sibling" || type == "siblings") {
+            relationship = Sibling;
+        }
+        else {
+            return false;
+        }
+
+        return true;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::constructTreeFromGraph(string const & inputFileName, string const & format) {
+        // OpenGT does not report a file that cannot be opened
+        // so the file is opened here and the stream is imported
+        ifstream infile(inputFileName.c_str(), ios::in | ios::binary);
+        if(infile.is_open() == false) {
+            FamilyTreeErrorMsg(LOG_ERROR, "Could not open the file: %s", inputFileName.c_str());
+            return INPUT_FILE_OPEN_ERROR;
+        }
+
+        // The import filters report errors by throwing a message
+        OpenGraphtheory::Graph graph;
+        try {
+            graph = OpenGraphtheory::Import::ImportFilter::Import(infile, format);
+        }
+        catch(const char * message) {
+            FamilyTreeErrorMsg(LOG_ERROR, "Could not import %s as %s: %s", inputFileName.c_str(), format.c_str(), message);
+            return INPUT_FILE_FORMAT_ERROR;
+        }
+        catch(...) {
+            FamilyTreeErrorMsg(LOG_ERROR, "Could not import %s as %s", inputFileName.c_str(), format.c_str());
+            return INPUT_FILE_FORMAT_ERROR;
+        }
+        infile.close();
+
+        uint32_t numberOfVertices = graph.NumberOfVertices();
+        m_Members.reserve(m_Members.size() + numberOfVertices);
+        m_MemberIndex.reserve(m_MemberIndex.size() + numberOfVertices);
+
+        // Every vertex becomes a member.  Member names must be
+        // unique but vertex labels are not, so a label that is
+        // already in the tree is followed by the vertex ID.
+        unordered_map<OpenGraphtheory::Vertex *, uint32_t> vertexIds;
+        vertexIds.reserve(numberOfVertices);
+        for(OpenGraphtheory::VertexIterator it = graph.BeginVertices(); it != graph.EndVertices(); ++it) {
+            string id = (*it)->GetIDString();
+            string name = (*it)->GetLabel();
+            if(name.empty()) {
+                name = id;
+            }
+            else if(findFamilyMemberId(name) != INVALID_MEMBER_ID) {
+                name += " (" + id + ")";
+            }
+            if(findFamilyMemberId(name) != INVALID_MEMBER_ID) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Could not give vertex %s a unique name", id.c_str());
+                return TREE_CONSTRUCTION_ERROR;
+            }
+
+            FamilyTreeOpResultCode result = addFamilyMember(name);
+            if(result != SUCCESS) {
+                return result;
+            }
+            vertexIds[*it] = findFamilyMemberId(name);
+        }
+
+        // Every edge becomes a relationship typed by its label.
+        // Relationships that are already in the tree are skipped.
+        for(OpenGraphtheory::EdgeIterator it = graph.BeginEdges(); it != graph.EndEdges(); ++it) {
+            relationship_t relationship;
+            string label = (*it)->GetLabel();
+            if(getGraphEdgeRelationship(label, (*it)->IsArc(), relationship) == false) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Edge %s has an unknown relationship: %s", (*it)->GetIDString().c_str(), label.c_str());
+                return INPUT_FILE_FORMAT_ERROR;
+            }
+
+            uint32_t fromId = vertexIds[(*it)->From()];
+            uint32_t toId = vertexIds[(*it)->To()];
+            if(fromId == toId) {
+                continue;
+            }
+
+            FamilyTreeOpResultCode result = addFamilyRelationship(fromId, toId, relationship);
+            if(result != SUCCESS) {
+                return result;
+            }
+        }
+
+        return SUCCESS;
+    }
+
+    FamilyTreeOpResultCode FamilyTreeClass::followInputFile(uint32_t maxLines, uint32_t & linesApplied) {
+        linesApplied = 0;
+
+        // Try and open the input file
+        ifstream infile(m_inputFileName.c_str(), ios::in | ios::binary);
+        if(infile.is_open() == false) {
+            FamilyTreeErrorMsg(LOG_ERROR, "Could not open the file: %s", m_inputFileName.c_str());
+            return INPUT_FILE_OPEN_ERROR;
+        }
+
+        // The input file is append-only.  If it is now shorter
+        // than what has already been applied, it was truncated
+        // or replaced and the tree must be reloaded instead.
+        infile.seekg(0, ios::end);
+        streamoff fileSize = infile.tellg();
+        if(fileSize < m_inputFileOffset) {
+            FamilyTreeErrorMsg(LOG_ERROR, "Input file %s was truncated.  Reload the family tree.", m_inputFileName.c_str());
+            infile.close();
+            return INPUT_FILE_FORMAT_ERROR;
+        }
+
+        infile.seekg(m_inputFileOffset, ios::beg);
+
+        // Apply each complete line that follows the last applied
+        // offset.  A trailing line without a newline is still
+        // being written and is left for the next call.
+        string currentLine;
+        while((maxLines == 0) || (linesApplied < maxLines)) {
+            if(!getline(infile, currentLine) || infile.eof()) {
+                break;
+            }
+
+            // A record that fails changes nothing.  It is skipped
+            // (the offset moves past it) and its error is returned,
+            // so the next call continues with the following line.
+            m_inputFileOffset += currentLine.size() + 1;
+            FamilyTreeOpResultCode result = processInputLine(currentLine);
+            if(result != SUCCESS) {
+                FamilyTreeErrorMsg(LOG_ERROR, "Skipped appended record that could not be applied: %s", currentLine.c_str());
+                infile.close();
+                return result;
+            }
+
+            linesApplied++;
+        }
+
+        // Close input file
+        infile.close();
+
+        return SUCCESS;
+    }
 
-        return SUCCESS;
-    }
-    
 } /* namespace FamilyTree */
@@ -0,0 +1,119 @@
+/**
+ *  @file    FamilyTreeConnectedFamilies.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeConnectedFamilies
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeConnectedFamilies
+ *
+ */
+
+#include "FamilyTreeConnectedFamilies.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyTreeConnectedFamilies::NO_MEMBER;
+
+	FamilyTreeConnectedFamilies::FamilyTreeConnectedFamilies() : m_NumberOfFamilies(0) {
+	}
+
+	FamilyTreeConnectedFamilies::~FamilyTreeConnectedFamilies() {
+	}
+
+	void FamilyTreeConnectedFamilies::clear() {
+		m_Parents.clear();
+		m_Ranks.clear();
+		m_Sizes.clear();
+		m_Next.clear();
+		m_NumberOfFamilies = 0;
+	}
+
+	void FamilyTreeConnectedFamilies::addMember(uint32_t memberId) {
+		if(memberId >= m_Parents.size()) {
+			m_Parents.resize(memberId + 1, NO_MEMBER);
+			m_Ranks.resize(memberId + 1, 0);
+			m_Sizes.resize(memberId + 1, 0);
+			m_Next.resize(memberId + 1, NO_MEMBER);
+		}
+
+		m_Parents[memberId] = memberId;
+		m_Ranks[memberId] = 0;
+		m_Sizes[memberId] = 1;
+		m_Next[memberId] = memberId;
+		m_NumberOfFamilies++;
+	}
+
+	uint32_t FamilyTreeConnectedFamilies::find(uint32_t memberId) {
+		uint32_t root = memberId;
+		while(m_Parents[root] != root) {
+			root = m_Parents[root];
+		}
+
+		// Point every member on the path straight at the root
+		while(m_Parents[memberId] != root) {
+			uint32_t parent = m_Parents[memberId];
+			m_Parents[memberId] = root;
+			memberId = parent;
+		}
+
+		return root;
+	}
+
+	bool FamilyTreeConnectedFamilies::unite(uint32_t firstId, uint32_t secondId) {
+		uint32_t firstRoot = find(firstId);
+		uint32_t secondRoot = find(secondId);
+		if(firstRoot == secondRoot) {
+			return false;
+		}
+
+		// The root of the lower rank tree goes under the other root
+		if(m_Ranks[firstRoot] < m_Ranks[secondRoot]) {
+			uint32_t root = firstRoot;
+			firstRoot = secondRoot;
+			secondRoot = root;
+		}
+		else if(m_Ranks[firstRoot] == m_Ranks[secondRoot]) {
+			m_Ranks[firstRoot]++;
+		}
+
+		m_Parents[secondRoot] = firstRoot;
+		m_Sizes[firstRoot] += m_Sizes[secondRoot];
+
+		// Splice the two circular member lists together
+		uint32_t next = m_Next[firstRoot];
+		m_Next[firstRoot] = m_Next[secondRoot];
+		m_Next[secondRoot] = next;
+
+		m_NumberOfFamilies--;
+
+		return true;
+	}
+
+	void FamilyTreeConnectedFamilies::getFamilyMembers(uint32_t memberId, std::vector<uint32_t> & memberIds) const {
+		memberIds.clear();
+
+		uint32_t current = memberId;
+		do {
+			memberIds.push_back(current);
+			current = m_Next[current];
+		} while(current != memberId);
+	}
+
+	void FamilyTreeConnectedFamilies::getFamilies(std::vector<uint32_t> & roots, std::vector<uint32_t> & sizes) const {
+		roots.clear();
+		sizes.clear();
+		roots.reserve(m_NumberOfFamilies);
+		sizes.reserve(m_NumberOfFamilies);
+
+		for(uint32_t i = 0; i < m_Parents.size(); i++) {
+			if(m_Parents[i] == i) {
+				roots.push_back(i);
+				sizes.push_back(m_Sizes[i]);
+			}
+		}
+	}
+
+} /* namespace FamilyTree */
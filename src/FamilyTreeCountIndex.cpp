@@ -0,0 +1,107 @@
+/**
+ *  @file    FamilyTreeCountIndex.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeCountIndex
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeCountIndex
+ *
+ */
+
+#include "FamilyTreeCountIndex.h"
+
+namespace FamilyTree {
+
+	FamilyTreeCountIndex::FamilyTreeCountIndex() {
+	}
+
+	FamilyTreeCountIndex::~FamilyTreeCountIndex() {
+	}
+
+	void FamilyTreeCountIndex::clear() {
+		m_Counts.clear();
+		m_InUse.clear();
+		m_Buckets.clear();
+		m_BucketPositions.clear();
+	}
+
+	void FamilyTreeCountIndex::removeFromBucket(uint32_t memberId) {
+		// Move the last member of the bucket into the
+		// position of memberId and shrink the bucket
+		std::vector<uint32_t> & bucket = m_Buckets[m_Counts[memberId]];
+		uint32_t position = m_BucketPositions[memberId];
+		uint32_t lastMemberId = bucket.back();
+
+		bucket[position] = lastMemberId;
+		m_BucketPositions[lastMemberId] = position;
+		bucket.pop_back();
+	}
+
+	void FamilyTreeCountIndex::addToBucket(uint32_t memberId) {
+		uint32_t count = m_Counts[memberId];
+		if(count >= m_Buckets.size()) {
+			m_Buckets.resize(count + 1);
+		}
+
+		m_BucketPositions[memberId] = m_Buckets[count].size();
+		m_Buckets[count].push_back(memberId);
+	}
+
+	void FamilyTreeCountIndex::addMember(uint32_t memberId) {
+		if(memberId >= m_Counts.size()) {
+			m_Counts.resize(memberId + 1, 0);
+			m_InUse.resize(memberId + 1, false);
+			m_BucketPositions.resize(memberId + 1, 0);
+		}
+
+		m_Counts[memberId] = 0;
+		m_InUse[memberId] = true;
+		addToBucket(memberId);
+	}
+
+	void FamilyTreeCountIndex::removeMember(uint32_t memberId) {
+		if(memberId >= m_InUse.size() || m_InUse[memberId] == false) {
+			return;
+		}
+
+		removeFromBucket(memberId);
+		m_Counts[memberId] = 0;
+		m_InUse[memberId] = false;
+	}
+
+	void FamilyTreeCountIndex::adjustCount(uint32_t memberId, int64_t delta) {
+		if(delta == 0) {
+			return;
+		}
+
+		removeFromBucket(memberId);
+		m_Counts[memberId] = (uint32_t)((int64_t)m_Counts[memberId] + delta);
+		addToBucket(memberId);
+	}
+
+	uint32_t FamilyTreeCountIndex::getMaxCount() const {
+		// Trailing buckets can be left empty when
+		// counts go down.  Skip over them.
+		for(uint32_t count = m_Buckets.size(); count > 0; count--) {
+			if(m_Buckets[count - 1].empty() == false) {
+				return count - 1;
+			}
+		}
+
+		return 0;
+	}
+
+	const std::vector<uint32_t> & FamilyTreeCountIndex::getMembersWithCount(uint32_t count) const {
+		static const std::vector<uint32_t> emptyBucket;
+
+		if(count >= m_Buckets.size()) {
+			return emptyBucket;
+		}
+
+		return m_Buckets[count];
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,296 @@
+/**
+ *  @file    FamilyTreeFamilyUnits.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeFamilyUnits
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeFamilyUnits
+ *
+ */
+
+#include <algorithm>
+
+#include "FamilyTreeFamilyUnits.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyTreeFamilyUnits::NO_UNIT;
+
+	FamilyTreeFamilyUnits::FamilyTreeFamilyUnits() {
+	}
+
+	FamilyTreeFamilyUnits::~FamilyTreeFamilyUnits() {
+	}
+
+	void FamilyTreeFamilyUnits::clear() {
+		m_Units.clear();
+		m_FreeUnits.clear();
+		m_ChildUnit.clear();
+		m_ParentUnits.clear();
+		m_FullSiblingCounts.clear();
+		m_HalfSiblingCounts.clear();
+	}
+
+	void FamilyTreeFamilyUnits::addMember(uint32_t memberId) {
+		if(memberId >= m_ChildUnit.size()) {
+			m_ChildUnit.resize(memberId + 1, NO_UNIT);
+			m_ParentUnits.resize(memberId + 1);
+		}
+
+		m_FullSiblingCounts.addMember(memberId);
+		m_HalfSiblingCounts.addMember(memberId);
+	}
+
+	void FamilyTreeFamilyUnits::removeMember(uint32_t memberId) {
+		m_FullSiblingCounts.removeMember(memberId);
+		m_HalfSiblingCounts.removeMember(memberId);
+	}
+
+	void FamilyTreeFamilyUnits::addParent(uint32_t childId, uint32_t parentId) {
+		std::vector<uint32_t> parentIds;
+		uint32_t unit = getChildUnit(childId);
+		if(unit != NO_UNIT) {
+			parentIds = m_Units[unit].parents;
+		}
+
+		parentIds.insert(std::upper_bound(parentIds.begin(), parentIds.end(), parentId), parentId);
+		setParents(childId, parentIds);
+	}
+
+	void FamilyTreeFamilyUnits::removeParent(uint32_t childId, uint32_t parentId) {
+		uint32_t unit = getChildUnit(childId);
+		if(unit == NO_UNIT) {
+			return;
+		}
+
+		std::vector<uint32_t> parentIds(m_Units[unit].parents);
+		std::vector<uint32_t>::iterator it = std::lower_bound(parentIds.begin(), parentIds.end(), parentId);
+		if(it == parentIds.end() || *it != parentId) {
+			return;
+		}
+
+		parentIds.erase(it);
+		setParents(childId, parentIds);
+	}
+
+	void FamilyTreeFamilyUnits::setParents(uint32_t memberId, std::vector<uint32_t> const & parentIds) {
+		// Leave the old unit.  Its other children lose a full
+		// sibling and the children of the units that share a
+		// parent with it lose a half sibling.
+		uint32_t oldUnit = m_ChildUnit[memberId];
+		if(oldUnit != NO_UNIT) {
+			std::vector<uint32_t> & children = m_Units[oldUnit].children;
+			children.erase(std::lower_bound(children.begin(), children.end(), memberId));
+			adjustSiblingCounts(oldUnit, -1);
+			if(children.empty()) {
+				freeUnit(oldUnit);
+			}
+		}
+		m_ChildUnit[memberId] = NO_UNIT;
+		m_FullSiblingCounts.adjustCount(memberId, -(int64_t)m_FullSiblingCounts.getCount(memberId));
+		m_HalfSiblingCounts.adjustCount(memberId, -(int64_t)m_HalfSiblingCounts.getCount(memberId));
+
+		if(parentIds.empty()) {
+			return;
+		}
+
+		// Join the new unit and take its sibling counts
+		uint32_t newUnit = findOrAddUnit(parentIds);
+		adjustSiblingCounts(newUnit, 1);
+
+		std::vector<uint32_t> & children = m_Units[newUnit].children;
+		m_FullSiblingCounts.adjustCount(memberId, children.size());
+		children.insert(std::upper_bound(children.begin(), children.end(), memberId), memberId);
+		m_ChildUnit[memberId] = newUnit;
+
+		std::vector<uint32_t> units;
+		getHalfSiblingUnits(newUnit, units);
+		for(std::vector<uint32_t>::const_iterator it = units.begin(); it != units.end(); ++it) {
+			m_HalfSiblingCounts.adjustCount(memberId, m_Units[*it].children.size());
+		}
+	}
+
+	void FamilyTreeFamilyUnits::adjustSiblingCounts(uint32_t unit, int64_t delta) {
+		std::vector<uint32_t> const & children = m_Units[unit].children;
+		for(std::vector<uint32_t>::const_iterator it = children.begin(); it != children.end(); ++it) {
+			m_FullSiblingCounts.adjustCount(*it, delta);
+		}
+
+		std::vector<uint32_t> units;
+		getHalfSiblingUnits(unit, units);
+		for(std::vector<uint32_t>::const_iterator pUnit = units.begin(); pUnit != units.end(); ++pUnit) {
+			std::vector<uint32_t> const & otherChildren = m_Units[*pUnit].children;
+			for(std::vector<uint32_t>::const_iterator it = otherChildren.begin(); it != otherChildren.end(); ++it) {
+				m_HalfSiblingCounts.adjustCount(*it, delta);
+			}
+		}
+	}
+
+	uint32_t FamilyTreeFamilyUnits::findOrAddUnit(std::vector<uint32_t> const & parentIds) {
+		// The unit of the parents is one of the units of the first parent
+		std::vector<uint32_t> const & units = m_ParentUnits[parentIds[0]];
+		for(std::vector<uint32_t>::const_iterator it = units.begin(); it != units.end(); ++it) {
+			if(m_Units[*it].parents == parentIds) {
+				return *it;
+			}
+		}
+
+		uint32_t unit;
+		if(m_FreeUnits.empty() == false) {
+			unit = m_FreeUnits.back();
+			m_FreeUnits.pop_back();
+		}
+		else {
+			unit = m_Units.size();
+			m_Units.push_back(unit_t());
+		}
+
+		m_Units[unit].parents = parentIds;
+		for(std::vector<uint32_t>::const_iterator it = parentIds.begin(); it != parentIds.end(); ++it) {
+			m_ParentUnits[*it].push_back(unit);
+		}
+
+		return unit;
+	}
+
+	void FamilyTreeFamilyUnits::freeUnit(uint32_t unit) {
+		std::vector<uint32_t> & parentIds = m_Units[unit].parents;
+		for(std::vector<uint32_t>::const_iterator it = parentIds.begin(); it != parentIds.end(); ++it) {
+			std::vector<uint32_t> & units = m_ParentUnits[*it];
+			units.erase(std::find(units.begin(), units.end(), unit));
+		}
+
+		parentIds.clear();
+		m_FreeUnits.push_back(unit);
+	}
+
+	const uint32_t * FamilyTreeFamilyUnits::beginParentUnits(uint32_t memberId) const {
+		if(memberId >= m_ParentUnits.size()) {
+			return NULL;
+		}
+
+		return m_ParentUnits[memberId].data();
+	}
+
+	const uint32_t * FamilyTreeFamilyUnits::endParentUnits(uint32_t memberId) const {
+		if(memberId >= m_ParentUnits.size()) {
+			return NULL;
+		}
+
+		return m_ParentUnits[memberId].data() + m_ParentUnits[memberId].size();
+	}
+
+	void FamilyTreeFamilyUnits::getChildren(uint32_t memberId, std::vector<uint32_t> & memberIds) const {
+		memberIds.clear();
+
+		// The units of a member have disjoint children
+		for(const uint32_t * pUnit = beginParentUnits(memberId); pUnit != endParentUnits(memberId); ++pUnit) {
+			memberIds.insert(memberIds.end(), beginChildren(*pUnit), endChildren(*pUnit));
+		}
+		std::sort(memberIds.begin(), memberIds.end());
+	}
+
+	void FamilyTreeFamilyUnits::getSiblings(uint32_t memberId, std::vector<uint32_t> & memberIds) const {
+		memberIds.clear();
+
+		uint32_t unit = getChildUnit(memberId);
+		if(unit == NO_UNIT) {
+			return;
+		}
+
+		// The children of every unit of every parent, which includes
+		// the unit of the member
+		for(const uint32_t * pParent = beginParents(unit); pParent != endParents(unit); ++pParent) {
+			for(const uint32_t * pUnit = beginParentUnits(*pParent); pUnit != endParentUnits(*pParent); ++pUnit) {
+				memberIds.insert(memberIds.end(), beginChildren(*pUnit), endChildren(*pUnit));
+			}
+		}
+
+		std::sort(memberIds.begin(), memberIds.end());
+		memberIds.erase(std::unique(memberIds.begin(), memberIds.end()), memberIds.end());
+		memberIds.erase(std::lower_bound(memberIds.begin(), memberIds.end(), memberId));
+	}
+
+	bool FamilyTreeFamilyUnits::isFirstCommonParent(uint32_t unit, uint32_t otherUnit, uint32_t parentId) const {
+		const uint32_t * pParent = beginParents(unit);
+		const uint32_t * pOtherParent = beginParents(otherUnit);
+		while(pParent != endParents(unit) && pOtherParent != endParents(otherUnit)) {
+			if(*pParent < *pOtherParent) {
+				++pParent;
+			}
+			else if(*pOtherParent < *pParent) {
+				++pOtherParent;
+			}
+			else {
+				return *pParent == parentId;
+			}
+		}
+
+		return false;
+	}
+
+	void FamilyTreeFamilyUnits::getHalfSiblingUnits(uint32_t unit, std::vector<uint32_t> & units) const {
+		units.clear();
+
+		// A unit reached through more than one parent is
+		// only taken for the first parent they share
+		for(const uint32_t * pParent = beginParents(unit); pParent != endParents(unit); ++pParent) {
+			for(const uint32_t * pUnit = beginParentUnits(*pParent); pUnit != endParentUnits(*pParent); ++pUnit) {
+				if(*pUnit != unit && isFirstCommonParent(unit, *pUnit, *pParent)) {
+					units.push_back(*pUnit);
+				}
+			}
+		}
+	}
+
+	void FamilyTreeFamilyUnits::getSiblings
+	(
+		uint32_t memberId,
+		std::vector<uint32_t> & fullSiblings,
+		std::vector<uint32_t> & halfSiblings
+	) const {
+		fullSiblings.clear();
+		halfSiblings.clear();
+
+		uint32_t unit = getChildUnit(memberId);
+		if(unit == NO_UNIT) {
+			return;
+		}
+
+		// Children of the unit are in increasing member ID order
+		for(const uint32_t * pChild = beginChildren(unit); pChild != endChildren(unit); ++pChild) {
+			if(*pChild != memberId) {
+				fullSiblings.push_back(*pChild);
+			}
+		}
+
+		// The units of different parent sets have disjoint children
+		std::vector<uint32_t> units;
+		getHalfSiblingUnits(unit, units);
+		for(std::vector<uint32_t>::const_iterator it = units.begin(); it != units.end(); ++it) {
+			halfSiblings.insert(halfSiblings.end(), beginChildren(*it), endChildren(*it));
+		}
+		std::sort(halfSiblings.begin(), halfSiblings.end());
+	}
+
+	void FamilyTreeFamilyUnits::getStats(unit_stats_t & stats) const {
+		stats.units = getNumberOfUnits();
+		stats.parentEntries = 0;
+		stats.childEntries = 0;
+		stats.memoryBytes = m_Units.capacity() * sizeof(unit_t) + m_ParentUnits.capacity() * sizeof(std::vector<uint32_t>)
+			+ (m_FreeUnits.capacity() + m_ChildUnit.capacity()) * sizeof(uint32_t);
+
+		for(std::vector<unit_t>::const_iterator it = m_Units.begin(); it != m_Units.end(); ++it) {
+			stats.parentEntries += it->parents.size();
+			stats.childEntries += it->children.size();
+			stats.memoryBytes += (it->parents.capacity() + it->children.capacity()) * sizeof(uint32_t);
+		}
+		for(std::vector< std::vector<uint32_t> >::const_iterator it = m_ParentUnits.begin(); it != m_ParentUnits.end(); ++it) {
+			stats.memoryBytes += it->capacity() * sizeof(uint32_t);
+		}
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,247 @@
+/**
+ *  @file    FamilyTreeGedcomReader.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeGedcomReader
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeGedcomReader
+ *
+ */
+
+#include <cctype>
+#include <cstdlib>
+
+#include "FamilyTreeGedcomReader.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyTreeGedcomReader::BUFFER_SIZE;
+	const int32_t FamilyTreeGedcomReader::NO_BIRTH_YEAR;
+
+	FamilyTreeGedcomReader::FamilyTreeGedcomReader() : m_HasNextLine(false), m_LineNumber(0), m_Failed(false) {
+	}
+
+	FamilyTreeGedcomReader::~FamilyTreeGedcomReader() {
+		close();
+	}
+
+	bool FamilyTreeGedcomReader::open(std::string const & fileName) {
+		close();
+
+		// The buffer must be set before the file is opened
+		m_Buffer.resize(BUFFER_SIZE);
+		m_File.rdbuf()->pubsetbuf(&m_Buffer[0], m_Buffer.size());
+		m_File.open(fileName.c_str(), std::ios::in | std::ios::binary);
+
+		return m_File.is_open();
+	}
+
+	void FamilyTreeGedcomReader::close() {
+		if(m_File.is_open()) {
+			m_File.close();
+		}
+		m_File.clear();
+		m_NextLine.clear();
+		m_HasNextLine = false;
+		m_LineNumber = 0;
+		m_Failed = false;
+	}
+
+	bool FamilyTreeGedcomReader::readLine(std::string & line) {
+		while(getline(m_File, line)) {
+			m_LineNumber++;
+
+			// Byte order mark of a UTF-8 file
+			if(m_LineNumber == 1 && line.compare(0, 3, "\xEF\xBB\xBF") == 0) {
+				line.erase(0, 3);
+			}
+
+			// Lines may end with CR LF and be indented
+			std::string::size_type end = line.find_last_not_of(" \t\r");
+			if(end == std::string::npos) {
+				continue;
+			}
+			line.erase(end + 1);
+			line.erase(0, line.find_first_not_of(" \t"));
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool FamilyTreeGedcomReader::parseLine
+	(
+		std::string const & line,
+		uint32_t & level,
+		std::string & xref,
+		std::string & tag,
+		std::string & value
+	) {
+		std::string::size_type position = 0;
+		if(line.empty() || isdigit((unsigned char)line[0]) == false) {
+			return false;
+		}
+
+		level = 0;
+		while(position < line.size() && isdigit((unsigned char)line[position])) {
+			level = level * 10 + (line[position] - '0');
+			position++;
+		}
+
+		// Optional cross reference
+		position = line.find_first_not_of(' ', position);
+		xref.clear();
+		if(position != std::string::npos && line[position] == '@') {
+			std::string::size_type end = line.find(' ', position);
+			if(end == std::string::npos) {
+				return false;
+			}
+			xref = stripXref(line.substr(position, end - position));
+			position = line.find_first_not_of(' ', end);
+		}
+
+		if(position == std::string::npos) {
+			return false;
+		}
+
+		std::string::size_type end = line.find(' ', position);
+		if(end == std::string::npos) {
+			tag = line.substr(position);
+			value.clear();
+		}
+		else {
+			tag = line.substr(position, end - position);
+			value = line.substr(end + 1);
+		}
+
+		return true;
+	}
+
+	std::string FamilyTreeGedcomReader::stripXref(std::string const & value) {
+		if(value.size() >= 2 && value[0] == '@' && value[value.size() - 1] == '@') {
+			return value.substr(1, value.size() - 2);
+		}
+
+		return value;
+	}
+
+	int32_t FamilyTreeGedcomReader::parseYear(std::string const & date) {
+		std::string::size_type position = 0;
+		while(position < date.size()) {
+			if(isdigit((unsigned char)date[position]) == false) {
+				position++;
+				continue;
+			}
+
+			std::string::size_type end = position;
+			while(end < date.size() && isdigit((unsigned char)date[end])) {
+				end++;
+			}
+			if(end - position == 3 || end - position == 4) {
+				return atoi(date.substr(position, end - position).c_str());
+			}
+			position = end;
+		}
+
+		return NO_BIRTH_YEAR;
+	}
+
+	bool FamilyTreeGedcomReader::readRecord(record_t & record) {
+		std::string line;
+		uint32_t level;
+		std::string xref;
+		std::string tag;
+		std::string value;
+
+		// Find the next INDI or FAM record
+		while(true) {
+			if(m_HasNextLine) {
+				line.swap(m_NextLine);
+				m_HasNextLine = false;
+			}
+			else if(readLine(line) == false) {
+				return false;
+			}
+
+			if(parseLine(line, level, xref, tag, value) == false) {
+				m_Failed = true;
+				return false;
+			}
+
+			if(level != 0) {
+				continue;
+			}
+			if(tag == "TRLR") {
+				return false;
+			}
+			if(tag == "INDI" || tag == "FAM") {
+				break;
+			}
+		}
+
+		record.type = (tag == "INDI") ? Record_Individual : Record_Family;
+		record.xref = xref;
+		record.name.clear();
+		record.sex = 0;
+		record.birthYear = NO_BIRTH_YEAR;
+		record.parents.clear();
+		record.children.clear();
+
+		// Read the lines of the record up to the next level 0 line
+		std::string structureTag;
+		while(readLine(line)) {
+			if(parseLine(line, level, xref, tag, value) == false) {
+				m_Failed = true;
+				return false;
+			}
+
+			if(level == 0) {
+				m_NextLine.swap(line);
+				m_HasNextLine = true;
+				break;
+			}
+
+			if(level == 1) {
+				structureTag = tag;
+				if(record.type == Record_Individual) {
+					if(tag == "NAME" && record.name.empty()) {
+						// The surname is between slashes and
+						// whitespace is collapsed
+						bool space = false;
+						for(std::string::size_type i = 0; i < value.size(); i++) {
+							char c = value[i];
+							if(c == '/' || isspace((unsigned char)c)) {
+								space = true;
+								continue;
+							}
+							if(space && record.name.empty() == false) {
+								record.name += ' ';
+							}
+							space = false;
+							record.name += c;
+						}
+					}
+					else if(tag == "SEX" && value.empty() == false) {
+						record.sex = value[0];
+					}
+				}
+				else if(tag == "HUSB" || tag == "WIFE") {
+					record.parents.push_back(stripXref(value));
+				}
+				else if(tag == "CHIL") {
+					record.children.push_back(stripXref(value));
+				}
+			}
+			else if(level == 2 && structureTag == "BIRT" && tag == "DATE" && record.birthYear == NO_BIRTH_YEAR) {
+				record.birthYear = parseYear(value);
+			}
+		}
+
+		return true;
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,282 @@
+/**
+ *  @file    FamilyTreeGraphWriter.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeGraphWriter
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeGraphWriter
+ *
+ */
+
+#include <cctype>
+#include <cstring>
+
+#include "FamilyTreeGraphWriter.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyTreeGraphWriter::BUFFER_SIZE;
+
+	FamilyTreeGraphWriter::FamilyTreeGraphWriter() : m_Used(0), m_Format(Format_Dot), m_WritingEdges(false), m_BytesWritten(0), m_Failed(false) {
+	}
+
+	FamilyTreeGraphWriter::~FamilyTreeGraphWriter() {
+		if(m_File.is_open()) {
+			close();
+		}
+	}
+
+	bool FamilyTreeGraphWriter::getFormat(std::string const & name, format_t & format) {
+		std::string lowerName;
+		for(std::string::size_type i = 0; i < name.size(); i++) {
+			lowerName += (char)tolower((unsigned char)name[i]);
+		}
+
+		if(lowerName == "dot" || lowerName == "gv") {
+			format = Format_Dot;
+		}
+		else if(lowerName == "graphml") {
+			format = Format_GraphML;
+		}
+		else if(lowerName == "tgf") {
+			format = Format_Tgf;
+		}
+		else {
+			return false;
+		}
+
+		return true;
+	}
+
+	void FamilyTreeGraphWriter::flush() {
+		if(m_Used == 0) {
+			return;
+		}
+
+		m_File.write(&m_Buffer[0], m_Used);
+		if(m_File.fail()) {
+			m_Failed = true;
+		}
+		m_Used = 0;
+	}
+
+	void FamilyTreeGraphWriter::write(const char * pText, uint32_t length) {
+		m_BytesWritten += length;
+		if(m_Used + length > m_Buffer.size()) {
+			flush();
+
+			// Text that does not fit in the buffer goes straight to the file
+			if(length > m_Buffer.size()) {
+				m_File.write(pText, length);
+				if(m_File.fail()) {
+					m_Failed = true;
+				}
+				return;
+			}
+		}
+
+		memcpy(&m_Buffer[m_Used], pText, length);
+		m_Used += length;
+	}
+
+	void FamilyTreeGraphWriter::write(const char * pText) {
+		write(pText, strlen(pText));
+	}
+
+	void FamilyTreeGraphWriter::writeNumber(uint32_t value) {
+		char digits[10];
+		uint32_t position = sizeof(digits);
+		do {
+			digits[--position] = '0' + (value % 10);
+			value /= 10;
+		} while(value != 0);
+
+		write(digits + position, sizeof(digits) - position);
+	}
+
+	void FamilyTreeGraphWriter::writeEscaped(const char * pName, uint32_t nameLength) {
+		// Runs of characters that need no escaping are written together
+		uint32_t start = 0;
+		for(uint32_t i = 0; i < nameLength; i++) {
+			const char * pReplacement = NULL;
+			char c = pName[i];
+			switch(m_Format) {
+				case Format_Dot:
+					if(c == '"') {
+						pReplacement = "\\\"";
+					}
+					else if(c == '\\') {
+						pReplacement = "\\\\";
+					}
+					else if(c == '\n' || c == '\r') {
+						pReplacement = " ";
+					}
+					break;
+
+				case Format_GraphML:
+					if(c == '&') {
+						pReplacement = "&amp;";
+					}
+					else if(c == '<') {
+						pReplacement = "&lt;";
+					}
+					else if(c == '>') {
+						pReplacement = "&gt;";
+					}
+					else if(c == '"') {
+						pReplacement = "&quot;";
+					}
+					break;
+
+				case Format_Tgf:
+					// The label is the rest of the line
+					if(c == '\n' || c == '\r') {
+						pReplacement = " ";
+					}
+					break;
+			}
+
+			if(pReplacement != NULL) {
+				write(pName + start, i - start);
+				write(pReplacement);
+				start = i + 1;
+			}
+		}
+
+		write(pName + start, nameLength - start);
+	}
+
+	bool FamilyTreeGraphWriter::open(std::string const & fileName, format_t format) {
+		if(m_File.is_open()) {
+			close();
+		}
+
+		m_Buffer.resize(BUFFER_SIZE);
+		m_Used = 0;
+		m_Format = format;
+		m_WritingEdges = false;
+		m_BytesWritten = 0;
+		m_Failed = false;
+
+		m_File.clear();
+		m_File.open(fileName.c_str(), std::ios::out | std::ios::trunc | std::ios::binary);
+		if(m_File.is_open() == false) {
+			return false;
+		}
+
+		switch(m_Format) {
+			case Format_Dot:
+				write("digraph FamilyTree {\n");
+				break;
+
+			case Format_GraphML:
+				write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+					  "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+					  "  <key id=\"name\" for=\"node\" attr.name=\"name\" attr.type=\"string\"/>\n"
+					  "  <key id=\"relationship\" for=\"edge\" attr.name=\"relationship\" attr.type=\"string\"/>\n"
+					  "  <graph id=\"FamilyTree\" edgedefault=\"directed\">\n");
+				break;
+
+			case Format_Tgf:
+				break;
+		}
+
+		return true;
+	}
+
+	bool FamilyTreeGraphWriter::close() {
+		if(m_File.is_open() == false) {
+			return false;
+		}
+
+		switch(m_Format) {
+			case Format_Dot:
+				write("}\n");
+				break;
+
+			case Format_GraphML:
+				write("  </graph>\n</graphml>\n");
+				break;
+
+			case Format_Tgf:
+				if(m_WritingEdges == false) {
+					write("#\n");
+				}
+				break;
+		}
+
+		flush();
+		m_File.close();
+		if(m_File.fail()) {
+			m_Failed = true;
+		}
+
+		// The buffer is only kept while a file is open
+		std::vector<char>().swap(m_Buffer);
+
+		return m_Failed == false;
+	}
+
+	void FamilyTreeGraphWriter::writeMember(uint32_t memberId, const char * pName, uint32_t nameLength) {
+		switch(m_Format) {
+			case Format_Dot:
+				write("  ");
+				writeNumber(memberId);
+				write(" [label=\"");
+				writeEscaped(pName, nameLength);
+				write("\"];\n");
+				break;
+
+			case Format_GraphML:
+				write("    <node id=\"n");
+				writeNumber(memberId);
+				write("\"><data key=\"name\">");
+				writeEscaped(pName, nameLength);
+				write("</data></node>\n");
+				break;
+
+			case Format_Tgf:
+				writeNumber(memberId);
+				write(" ");
+				writeEscaped(pName, nameLength);
+				write("\n");
+				break;
+		}
+	}
+
+	void FamilyTreeGraphWriter::writeRelationship(uint32_t fromId, uint32_t toId, bool sibling) {
+		switch(m_Format) {
+			case Format_Dot:
+				write("  ");
+				writeNumber(fromId);
+				write(" -> ");
+				writeNumber(toId);
+				write(sibling ? " [label=\"sibling\", dir=none];\n" : " [label=\"parent\"];\n");
+				break;
+
+			case Format_GraphML:
+				write("    <edge source=\"n");
+				writeNumber(fromId);
+				write("\" target=\"n");
+				writeNumber(toId);
+				write(sibling ? "\" directed=\"false\"><data key=\"relationship\">sibling</data></edge>\n"
+							  : "\"><data key=\"relationship\">parent</data></edge>\n");
+				break;
+
+			case Format_Tgf:
+				if(m_WritingEdges == false) {
+					write("#\n");
+					m_WritingEdges = true;
+				}
+				writeNumber(fromId);
+				write(" ");
+				writeNumber(toId);
+				write(sibling ? " sibling\n" : " parent\n");
+				break;
+		}
+	}
+
+} /* namespace FamilyTree */
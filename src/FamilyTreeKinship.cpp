@@ -0,0 +1,186 @@
+/**
+ *  @file    FamilyTreeKinship.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeKinship
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeKinship
+ *
+ */
+
+#include <cmath>
+
+#include "FamilyTreeKinship.h"
+#include "FamilyTreeParallel.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyTreeKinship::NO_PARENT;
+	const uint32_t FamilyTreeKinship::TILE_SIZE;
+	const uint32_t FamilyTreeKinship::MAX_MEMO_ENTRIES;
+
+	// Memo key of an unordered pair
+	static inline uint64_t getPairKey(uint32_t a, uint32_t b) {
+		return (a < b) ? (((uint64_t)a << 32) | b) : (((uint64_t)b << 32) | a);
+	}
+
+	FamilyTreeKinship::FamilyTreeKinship() {
+	}
+
+	FamilyTreeKinship::~FamilyTreeKinship() {
+	}
+
+	void FamilyTreeKinship::build(std::vector<uint32_t> const & parents, std::vector<uint32_t> const & generations) {
+		m_Parents = parents;
+		m_Generations = generations;
+		m_Memo.clear();
+	}
+
+	void FamilyTreeKinship::clear() {
+		m_Parents.clear();
+		m_Generations.clear();
+		m_Memo.clear();
+	}
+
+	double FamilyTreeKinship::computeKinship(uint32_t a, uint32_t b, memo_t & memo) const {
+		if(memo.size() > MAX_MEMO_ENTRIES) {
+			memo.clear();
+		}
+
+		uint64_t rootKey = getPairKey(a, b);
+		memo_t::const_iterator found = memo.find(rootKey);
+		if(found != memo.end()) {
+			return found->second;
+		}
+
+		// A pair is computed once the pairs it depends on are in
+		// the memo table.  Until then they are pushed on top of it.
+		// Every dependency replaces the member of the later generation
+		// by one of its parents, so the stack cannot loop.
+		std::vector<uint64_t> stack(1, rootKey);
+		while(stack.empty() == false) {
+			uint64_t key = stack.back();
+			if(memo.find(key) != memo.end()) {
+				// Pushed again by another pair before it was computed
+				stack.pop_back();
+				continue;
+			}
+
+			uint32_t x = (uint32_t)(key >> 32);
+			uint32_t y = (uint32_t)key;
+
+			// x is the member whose parents the pair depends on
+			uint32_t other = y;
+			if(x != y && m_Generations[y] > m_Generations[x]) {
+				other = x;
+				x = y;
+			}
+
+			uint32_t firstParent = m_Parents[2 * x];
+			uint32_t secondParent = m_Parents[2 * x + 1];
+
+			uint64_t dependencies[2];
+			uint32_t numberOfDependencies = 0;
+			if(x == other) {
+				if(firstParent != NO_PARENT && secondParent != NO_PARENT) {
+					dependencies[numberOfDependencies++] = getPairKey(firstParent, secondParent);
+				}
+			}
+			else {
+				if(firstParent != NO_PARENT) {
+					dependencies[numberOfDependencies++] = getPairKey(firstParent, other);
+				}
+				if(secondParent != NO_PARENT) {
+					dependencies[numberOfDependencies++] = getPairKey(secondParent, other);
+				}
+			}
+
+			double values[2] = { 0.0, 0.0 };
+			bool ready = true;
+			for(uint32_t i = 0; i < numberOfDependencies; i++) {
+				found = memo.find(dependencies[i]);
+				if(found == memo.end()) {
+					stack.push_back(dependencies[i]);
+					ready = false;
+				}
+				else {
+					values[i] = found->second;
+				}
+			}
+			if(ready == false) {
+				continue;
+			}
+
+			stack.pop_back();
+			if(x == other) {
+				memo[key] = 0.5 * (1.0 + values[0]);
+			}
+			else {
+				memo[key] = 0.5 * (values[0] + values[1]);
+			}
+		}
+
+		return memo[rootKey];
+	}
+
+	double FamilyTreeKinship::getKinship(uint32_t a, uint32_t b) {
+		return computeKinship(a, b, m_Memo);
+	}
+
+	double FamilyTreeKinship::getInbreeding(uint32_t memberId) {
+		uint32_t firstParent = m_Parents[2 * memberId];
+		uint32_t secondParent = m_Parents[2 * memberId + 1];
+		if(firstParent == NO_PARENT || secondParent == NO_PARENT) {
+			return 0.0;
+		}
+
+		return computeKinship(firstParent, secondParent, m_Memo);
+	}
+
+	double FamilyTreeKinship::getRelationship(uint32_t a, uint32_t b) {
+		double kinship = getKinship(a, b);
+
+		return 2.0 * kinship / sqrt((1.0 + getInbreeding(a)) * (1.0 + getInbreeding(b)));
+	}
+
+	void FamilyTreeKinship::getKinshipMatrix(std::vector<uint32_t> const & memberIds, std::vector<double> & matrix) const {
+		uint32_t size = memberIds.size();
+		matrix.assign((size_t)size * size, 0.0);
+
+		// Tiles (row block, column block) of the upper triangle, row block by row block
+		uint32_t numberOfBlocks = (size + TILE_SIZE - 1) / TILE_SIZE;
+		std::vector<uint32_t> tiles;
+		tiles.reserve((size_t)numberOfBlocks * (numberOfBlocks + 1));
+		for(uint32_t rowBlock = 0; rowBlock < numberOfBlocks; rowBlock++) {
+			for(uint32_t columnBlock = rowBlock; columnBlock < numberOfBlocks; columnBlock++) {
+				tiles.push_back(rowBlock);
+				tiles.push_back(columnBlock);
+			}
+		}
+
+		// Tiles write disjoint cells, so the threads share the matrix
+		double * pMatrix = matrix.empty() ? NULL : &matrix[0];
+		FamilyTreeParallel::forEachRange(0, tiles.size() / 2, 1,
+			[&](uint32_t threadIndex, uint32_t begin, uint32_t end) {
+				memo_t memo;
+				for(uint32_t tile = begin; tile < end; tile++) {
+					uint32_t rowBegin = tiles[2 * tile] * TILE_SIZE;
+					uint32_t rowEnd = (rowBegin + TILE_SIZE < size) ? rowBegin + TILE_SIZE : size;
+					uint32_t columnBegin = tiles[2 * tile + 1] * TILE_SIZE;
+					uint32_t columnEnd = (columnBegin + TILE_SIZE < size) ? columnBegin + TILE_SIZE : size;
+
+					for(uint32_t row = rowBegin; row < rowEnd; row++) {
+						for(uint32_t column = (columnBegin > row) ? columnBegin : row; column < columnEnd; column++) {
+							double kinship = computeKinship(memberIds[row], memberIds[column], memo);
+							pMatrix[(size_t)row * size + column] = kinship;
+							pMatrix[(size_t)column * size + row] = kinship;
+						}
+					}
+				}
+			});
+	}
+
+} /* namespace FamilyTree */
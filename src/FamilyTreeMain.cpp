@@ -17,6 +17,7 @@
  */
 
 #include <cstdlib>
+#include <iostream>
 #include <limits>
 
 #include "FamilyTreeClass.h"
@@ -41,6 +42,26 @@ void printFamilyMembersList() {
 	}
 }
 
+// Number of suggestions and largest edit distance of a suggestion
+// printed when a family member name is not in the tree
+static const uint32_t NUMBER_OF_SUGGESTIONS = 3;
+static const uint32_t MAX_SUGGESTION_DISTANCE = 2;
+
+void printClosestMemberNames(string const & familyMemberName) {
+	vector<string> nameList;
+	vector<uint32_t> distances;
+	if(g_FamilyTree.getClosestMemberNames(familyMemberName, NUMBER_OF_SUGGESTIONS,
+		MAX_SUGGESTION_DISTANCE, nameList, distances) != SUCCESS || nameList.empty()) {
+		return;
+	}
+
+	cout << "Did you mean:";
+	for(vector<string>::iterator it = nameList.begin(); it != nameList.end(); ++it) {
+		cout << " " << *it;
+	}
+	cout << endl;
+}
+
 void findGrandparentForSpecifiedMember() {
 	// Get the family member name from the user
 	cout << "Please Type the name of the family member: ";
@@ -57,8 +78,12 @@ void findGrandparentForSpecifiedMember() {
 	// Retrieve the grandparent name list
 	// If there is an error, log the error and return
 	vector<string> grandparentNameList;
-	if(g_FamilyTree.getGrandparentNameList(familyMemberName, grandparentNameList) != SUCCESS) {
+	FamilyTreeOpResultCode result = g_FamilyTree.getGrandparentNameList(familyMemberName, grandparentNameList);
+	if(result != SUCCESS) {
 		cout << "Unable to retrieve grandparent info for " << familyMemberName << endl;
+		if(result == FAMILY_MEMBER_NOT_FOUND) {
+			printClosestMemberNames(familyMemberName);
+		}
 		return;
 	}
 
@@ -178,6 +203,60 @@ void printMemberWithMostGrandchildren() {
 	}
 }
 
+void applyAppendedRecords() {
+	// Apply every complete record that has been
+	// appended to the input file since the last read
+	uint32_t linesApplied;
+	if(g_FamilyTree.followInputFile(0, linesApplied) != SUCCESS) {
+		cout << "Unable to apply the records appended to the input file" << endl;
+		return;
+	}
+
+	cout << "Applied " << linesApplied << " new record(s) from the input file" << endl;
+}
+
+// Number of names printed per page by findMembersByNamePrefix
+static const uint32_t NAMES_PER_PAGE = 20;
+
+void findMembersByNamePrefix() {
+	// Get the beginning of the name from the user
+	cout << "Please type the beginning of the name of the family member: ";
+
+	string prefix;
+	cin >> prefix;
+
+	// Print the matching names one page at a time
+	uint32_t offset = 0;
+	while(true) {
+		vector<string> nameList;
+		uint32_t numberOfMatches;
+		if(g_FamilyTree.getMembersWithNamePrefix(prefix, offset, NAMES_PER_PAGE, nameList, numberOfMatches) != SUCCESS) {
+			cout << "Unable to retrieve the names that start with " << prefix << endl;
+			return;
+		}
+
+		if(numberOfMatches == 0) {
+			cout << "There are no family members whose name starts with " << prefix << endl;
+			return;
+		}
+
+		for(unsigned int i = 0; i < nameList.size(); i++) {
+			cout << offset + i + 1 << ".\t" << nameList[i] << endl;
+		}
+		offset += nameList.size();
+
+		if(offset >= numberOfMatches) {
+			return;
+		}
+
+		cout << "Showing " << offset << " of " << numberOfMatches << " names.  Show more (y/n)? ";
+		string answer;
+		cin >> answer;
+		if(answer != "y" && answer != "Y") {
+			return;
+		}
+	}
+}
 
 int main(int argc, char** argv) {
     
@@ -208,12 +287,14 @@ int main(int argc, char** argv) {
 		cout << "3. Print the names of family members with a specified number of siblings" << endl;
 		cout << "4. Print the names of family members with a specified number of children" << endl;
 		cout << "5. Print the name of the person with largest number of grand children" << endl;
-		cout << "6. Exit program" << endl << endl;
+		cout << "6. Apply new records appended to the input file" << endl;
+		cout << "7. Find family members by the beginning of their name" << endl;
+		cout << "8. Exit program" << endl << endl;
 		cout << "Selection: ";
 
 		int menuSelection;
-		while(!(cin >> menuSelection) || (menuSelection < 1) || (menuSelection > 6)) {
-			cout << "You did not input a valid value.  Please input a selection between 1-5: ";
+		while(!(cin >> menuSelection) || (menuSelection < 1) || (menuSelection > 8)) {
+			cout << "You did not input a valid value.  Please input a selection between 1-8: ";
 			// Clear the cin error flag and reset the buffer
 			cin.clear();
 			cin.ignore(numeric_limits<streamsize>::max(), '\n');
@@ -237,9 +318,15 @@ int main(int argc, char** argv) {
 			printMemberWithMostGrandchildren();
 			break;
 		case 6:
+			applyAppendedRecords();
+			break;
+		case 7:
+			findMembersByNamePrefix();
+			break;
+		case 8:
 			exit(0);
 		default:
-			cout << "Invalid option.  Please select an option between 1-5:" << endl;
+			cout << "Invalid option.  Please select an option between 1-8:" << endl;
 		}
 
 		cout << endl;
@@ -0,0 +1,144 @@
+/**
+ *  @file    FamilyTreeMaterializedView.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeMaterializedView
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeMaterializedView
+ *
+ */
+
+#include "FamilyTreeMaterializedView.h"
+
+namespace FamilyTree {
+
+	FamilyTreeMaterializedView::FamilyTreeMaterializedView() : m_Offsets(1, 0), m_NumberOfDirtyRows(0), m_Stale(true) {
+	}
+
+	FamilyTreeMaterializedView::~FamilyTreeMaterializedView() {
+	}
+
+	bool FamilyTreeMaterializedView::compile(std::string const & expression) {
+		m_Expression = expression;
+		markStale();
+
+		return m_Automaton.compile(expression);
+	}
+
+	void FamilyTreeMaterializedView::assign(std::vector<uint32_t> & offsets, std::vector<uint32_t> & memberIds) {
+		m_Offsets.swap(offsets);
+		m_MemberIds.swap(memberIds);
+		m_Overlay.clear();
+		m_Dirty.assign(m_Offsets.size() - 1, false);
+		m_NumberOfDirtyRows = 0;
+		m_Stale = false;
+	}
+
+	void FamilyTreeMaterializedView::markStale() {
+		m_Overlay.clear();
+		m_Dirty.clear();
+		m_NumberOfDirtyRows = 0;
+		m_Stale = true;
+	}
+
+	void FamilyTreeMaterializedView::markDirty(uint32_t memberId) {
+		if(m_Stale || isDirty(memberId)) {
+			return;
+		}
+
+		if(memberId >= m_Dirty.size()) {
+			m_Dirty.resize(memberId + 1, false);
+		}
+		m_Dirty[memberId] = true;
+		m_NumberOfDirtyRows++;
+
+		// Rebuilding is cheaper than recomputing most of the rows one by one
+		if(m_NumberOfDirtyRows > m_Dirty.size() / DIRTY_DIVISOR + 64) {
+			markStale();
+		}
+	}
+
+	void FamilyTreeMaterializedView::setRow(uint32_t memberId, std::vector<uint32_t> const & memberIds) {
+		if(isDirty(memberId)) {
+			m_Dirty[memberId] = false;
+			m_NumberOfDirtyRows--;
+		}
+
+		m_Overlay[memberId] = memberIds;
+		if(m_Overlay.size() > (m_Offsets.size() - 1) / OVERLAY_DIVISOR + 64) {
+			compact();
+		}
+	}
+
+	void FamilyTreeMaterializedView::getRow(uint32_t memberId, const uint32_t * & pMemberIds, uint32_t & count) const {
+		std::unordered_map<uint32_t, std::vector<uint32_t> >::const_iterator it = m_Overlay.find(memberId);
+		if(it != m_Overlay.end()) {
+			pMemberIds = it->second.data();
+			count = it->second.size();
+			return;
+		}
+
+		if(memberId + 1 >= m_Offsets.size()) {
+			pMemberIds = NULL;
+			count = 0;
+			return;
+		}
+
+		pMemberIds = m_MemberIds.data() + m_Offsets[memberId];
+		count = m_Offsets[memberId + 1] - m_Offsets[memberId];
+	}
+
+	void FamilyTreeMaterializedView::compact() {
+		if(m_Overlay.empty()) {
+			return;
+		}
+
+		// The overlay may have rows past the end of the CSR arrays
+		uint32_t numberOfRows = m_Offsets.size() - 1;
+		for(std::unordered_map<uint32_t, std::vector<uint32_t> >::const_iterator it = m_Overlay.begin(); it != m_Overlay.end(); ++it) {
+			if(it->first >= numberOfRows) {
+				numberOfRows = it->first + 1;
+			}
+		}
+
+		std::vector<uint32_t> offsets;
+		std::vector<uint32_t> memberIds;
+		offsets.reserve(numberOfRows + 1);
+		memberIds.reserve(m_MemberIds.size());
+		offsets.push_back(0);
+		for(uint32_t i = 0; i < numberOfRows; i++) {
+			const uint32_t * pRow;
+			uint32_t count;
+			getRow(i, pRow, count);
+			memberIds.insert(memberIds.end(), pRow, pRow + count);
+			offsets.push_back(memberIds.size());
+		}
+
+		m_Offsets.swap(offsets);
+		m_MemberIds.swap(memberIds);
+		m_Overlay.clear();
+		if(m_Dirty.size() < numberOfRows) {
+			m_Dirty.resize(numberOfRows, false);
+		}
+	}
+
+	void FamilyTreeMaterializedView::getStats(view_stats_t & stats) const {
+		stats.rows = m_Offsets.size() - 1;
+		stats.entries = m_MemberIds.size();
+		stats.overlayRows = m_Overlay.size();
+		stats.dirtyRows = m_NumberOfDirtyRows;
+		stats.stale = m_Stale;
+
+		stats.memoryBytes = m_Offsets.capacity() * sizeof(uint32_t) + m_MemberIds.capacity() * sizeof(uint32_t) + m_Dirty.capacity() / 8;
+		for(std::unordered_map<uint32_t, std::vector<uint32_t> >::const_iterator it = m_Overlay.begin(); it != m_Overlay.end(); ++it) {
+			// Hash node (key, vector and next pointer) and the row
+			stats.entries += it->second.size();
+			stats.memoryBytes += sizeof(uint32_t) + sizeof(std::vector<uint32_t>) + sizeof(void *) + it->second.capacity() * sizeof(uint32_t);
+		}
+		stats.memoryBytes += m_Overlay.bucket_count() * sizeof(void *);
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,88 @@
+/**
+ *  @file    FamilyTreeMemberBitmap.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeMemberBitmap
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeMemberBitmap
+ *
+ */
+
+#include "FamilyTreeMemberBitmap.h"
+
+namespace FamilyTree {
+
+	FamilyTreeMemberBitmap::FamilyTreeMemberBitmap() : m_NumberOfBits(0) {
+	}
+
+	FamilyTreeMemberBitmap::FamilyTreeMemberBitmap(uint32_t numberOfBits) : m_NumberOfBits(0) {
+		reset(numberOfBits);
+	}
+
+	void FamilyTreeMemberBitmap::clearTrailingBits() {
+		if((m_NumberOfBits & 63) != 0) {
+			m_Words.back() &= (1ULL << (m_NumberOfBits & 63)) - 1;
+		}
+	}
+
+	void FamilyTreeMemberBitmap::reset(uint32_t numberOfBits) {
+		m_NumberOfBits = numberOfBits;
+		m_Words.assign((numberOfBits + 63) / 64, 0);
+	}
+
+	void FamilyTreeMemberBitmap::setAll() {
+		m_Words.assign(m_Words.size(), ~0ULL);
+		clearTrailingBits();
+	}
+
+	void FamilyTreeMemberBitmap::andWith(FamilyTreeMemberBitmap const & other) {
+		uint64_t * pWords = getWords();
+		const uint64_t * pOtherWords = other.getWords();
+		for(uint32_t i = 0; i < m_Words.size(); i++) {
+			pWords[i] &= pOtherWords[i];
+		}
+	}
+
+	void FamilyTreeMemberBitmap::orWith(FamilyTreeMemberBitmap const & other) {
+		uint64_t * pWords = getWords();
+		const uint64_t * pOtherWords = other.getWords();
+		for(uint32_t i = 0; i < m_Words.size(); i++) {
+			pWords[i] |= pOtherWords[i];
+		}
+	}
+
+	void FamilyTreeMemberBitmap::andNotWith(FamilyTreeMemberBitmap const & other) {
+		uint64_t * pWords = getWords();
+		const uint64_t * pOtherWords = other.getWords();
+		for(uint32_t i = 0; i < m_Words.size(); i++) {
+			pWords[i] &= ~pOtherWords[i];
+		}
+	}
+
+	uint32_t FamilyTreeMemberBitmap::count() const {
+		uint32_t numberOfSetBits = 0;
+		for(uint32_t i = 0; i < m_Words.size(); i++) {
+			numberOfSetBits += __builtin_popcountll(m_Words[i]);
+		}
+
+		return numberOfSetBits;
+	}
+
+	void FamilyTreeMemberBitmap::getMemberIds(std::vector<uint32_t> & memberIds) const {
+		memberIds.clear();
+		memberIds.reserve(count());
+
+		// Pop the lowest set bit of each word until it is empty
+		for(uint32_t i = 0; i < m_Words.size(); i++) {
+			uint64_t word = m_Words[i];
+			while(word != 0) {
+				memberIds.push_back((i << 6) + __builtin_ctzll(word));
+				word &= word - 1;
+			}
+		}
+	}
+
+} /* namespace FamilyTree */
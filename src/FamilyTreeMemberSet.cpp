@@ -0,0 +1,463 @@
+/**
+ *  @file    FamilyTreeMemberSet.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeMemberSet
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeMemberSet
+ *
+ */
+
+#include <algorithm>
+#include <iterator>
+
+#include "FamilyTreeMemberSet.h"
+
+namespace FamilyTree {
+
+	FamilyTreeMemberSet::FamilyTreeMemberSet() {
+	}
+
+	FamilyTreeMemberSet::~FamilyTreeMemberSet() {
+	}
+
+	uint32_t FamilyTreeMemberSet::findContainer(uint16_t key) const {
+		// Binary search of the sorted container keys
+		uint32_t low = 0;
+		uint32_t high = m_Containers.size();
+		while(low < high) {
+			uint32_t middle = (low + high) / 2;
+			if(m_Containers[middle].key < key) {
+				low = middle + 1;
+			}
+			else {
+				high = middle;
+			}
+		}
+
+		return low;
+	}
+
+	void FamilyTreeMemberSet::convertToBitmap(container_t & container) {
+		container.bitmap.assign(BITMAP_CONTAINER_WORDS, 0);
+		for(uint32_t i = 0; i < container.array.size(); i++) {
+			uint16_t value = container.array[i];
+			container.bitmap[value >> 6] |= (1ULL << (value & 63));
+		}
+
+		std::vector<uint16_t>().swap(container.array);
+	}
+
+	void FamilyTreeMemberSet::convertToArray(container_t & container) {
+		container.array.clear();
+		container.array.reserve(container.cardinality);
+		for(uint32_t i = 0; i < BITMAP_CONTAINER_WORDS; i++) {
+			uint64_t word = container.bitmap[i];
+			while(word != 0) {
+				container.array.push_back((uint16_t)((i << 6) + __builtin_ctzll(word)));
+				word &= word - 1;
+			}
+		}
+
+		std::vector<uint64_t>().swap(container.bitmap);
+	}
+
+	void FamilyTreeMemberSet::normalizeContainer(container_t & container) {
+		bool isBitmap = (container.bitmap.empty() == false);
+		if(isBitmap && container.cardinality <= ARRAY_CONTAINER_MAX) {
+			convertToArray(container);
+		}
+		else if(isBitmap == false && container.cardinality > ARRAY_CONTAINER_MAX) {
+			convertToBitmap(container);
+		}
+	}
+
+	bool FamilyTreeMemberSet::containerContains(container_t const & container, uint16_t value) {
+		if(container.bitmap.empty() == false) {
+			return (container.bitmap[value >> 6] >> (value & 63)) & 1;
+		}
+
+		return std::binary_search(container.array.begin(), container.array.end(), value);
+	}
+
+	void FamilyTreeMemberSet::unionContainers(container_t & target, container_t const & other) {
+		if(target.bitmap.empty() == false || other.bitmap.empty() == false) {
+			if(target.bitmap.empty()) {
+				convertToBitmap(target);
+			}
+
+			uint64_t * pWords = &target.bitmap[0];
+			if(other.bitmap.empty() == false) {
+				const uint64_t * pOtherWords = &other.bitmap[0];
+				for(uint32_t i = 0; i < BITMAP_CONTAINER_WORDS; i++) {
+					pWords[i] |= pOtherWords[i];
+				}
+			}
+			else {
+				for(uint32_t i = 0; i < other.array.size(); i++) {
+					pWords[other.array[i] >> 6] |= (1ULL << (other.array[i] & 63));
+				}
+			}
+
+			uint32_t cardinality = 0;
+			for(uint32_t i = 0; i < BITMAP_CONTAINER_WORDS; i++) {
+				cardinality += __builtin_popcountll(pWords[i]);
+			}
+			target.cardinality = cardinality;
+		}
+		else {
+			std::vector<uint16_t> merged;
+			merged.reserve(target.array.size() + other.array.size());
+			std::set_union(target.array.begin(), target.array.end(),
+				other.array.begin(), other.array.end(), std::back_inserter(merged));
+			target.array.swap(merged);
+			target.cardinality = target.array.size();
+		}
+
+		normalizeContainer(target);
+	}
+
+	void FamilyTreeMemberSet::intersectContainers(container_t & target, container_t const & other) {
+		if(target.bitmap.empty() == false && other.bitmap.empty() == false) {
+			uint64_t * pWords = &target.bitmap[0];
+			const uint64_t * pOtherWords = &other.bitmap[0];
+			uint32_t cardinality = 0;
+			for(uint32_t i = 0; i < BITMAP_CONTAINER_WORDS; i++) {
+				pWords[i] &= pOtherWords[i];
+				cardinality += __builtin_popcountll(pWords[i]);
+			}
+			target.cardinality = cardinality;
+		}
+		else if(target.bitmap.empty() == false) {
+			// Keep the IDs of the other array that are in the bitmap
+			std::vector<uint16_t> kept;
+			for(uint32_t i = 0; i < other.array.size(); i++) {
+				if(containerContains(target, other.array[i])) {
+					kept.push_back(other.array[i]);
+				}
+			}
+			std::vector<uint64_t>().swap(target.bitmap);
+			target.array.swap(kept);
+			target.cardinality = target.array.size();
+		}
+		else if(other.bitmap.empty() == false) {
+			std::vector<uint16_t> kept;
+			for(uint32_t i = 0; i < target.array.size(); i++) {
+				if(containerContains(other, target.array[i])) {
+					kept.push_back(target.array[i]);
+				}
+			}
+			target.array.swap(kept);
+			target.cardinality = target.array.size();
+		}
+		else {
+			std::vector<uint16_t> kept;
+			std::set_intersection(target.array.begin(), target.array.end(),
+				other.array.begin(), other.array.end(), std::back_inserter(kept));
+			target.array.swap(kept);
+			target.cardinality = target.array.size();
+		}
+
+		normalizeContainer(target);
+	}
+
+	void FamilyTreeMemberSet::differenceContainers(container_t & target, container_t const & other) {
+		if(target.bitmap.empty() == false) {
+			uint64_t * pWords = &target.bitmap[0];
+			if(other.bitmap.empty() == false) {
+				const uint64_t * pOtherWords = &other.bitmap[0];
+				for(uint32_t i = 0; i < BITMAP_CONTAINER_WORDS; i++) {
+					pWords[i] &= ~pOtherWords[i];
+				}
+			}
+			else {
+				for(uint32_t i = 0; i < other.array.size(); i++) {
+					pWords[other.array[i] >> 6] &= ~(1ULL << (other.array[i] & 63));
+				}
+			}
+
+			uint32_t cardinality = 0;
+			for(uint32_t i = 0; i < BITMAP_CONTAINER_WORDS; i++) {
+				cardinality += __builtin_popcountll(pWords[i]);
+			}
+			target.cardinality = cardinality;
+		}
+		else if(other.bitmap.empty() == false) {
+			std::vector<uint16_t> kept;
+			for(uint32_t i = 0; i < target.array.size(); i++) {
+				if(containerContains(other, target.array[i]) == false) {
+					kept.push_back(target.array[i]);
+				}
+			}
+			target.array.swap(kept);
+			target.cardinality = target.array.size();
+		}
+		else {
+			std::vector<uint16_t> kept;
+			std::set_difference(target.array.begin(), target.array.end(),
+				other.array.begin(), other.array.end(), std::back_inserter(kept));
+			target.array.swap(kept);
+			target.cardinality = target.array.size();
+		}
+
+		normalizeContainer(target);
+	}
+
+	void FamilyTreeMemberSet::removeEmptyContainers() {
+		uint32_t kept = 0;
+		for(uint32_t i = 0; i < m_Containers.size(); i++) {
+			if(m_Containers[i].cardinality != 0) {
+				if(kept != i) {
+					m_Containers[kept].key = m_Containers[i].key;
+					m_Containers[kept].cardinality = m_Containers[i].cardinality;
+					m_Containers[kept].array.swap(m_Containers[i].array);
+					m_Containers[kept].bitmap.swap(m_Containers[i].bitmap);
+				}
+				kept++;
+			}
+		}
+
+		m_Containers.resize(kept);
+	}
+
+	void FamilyTreeMemberSet::clear() {
+		m_Containers.clear();
+	}
+
+	bool FamilyTreeMemberSet::add(uint32_t memberId) {
+		uint16_t key = (uint16_t)(memberId >> 16);
+		uint16_t value = (uint16_t)(memberId & 0xFFFF);
+
+		uint32_t index = findContainer(key);
+		if(index == m_Containers.size() || m_Containers[index].key != key) {
+			container_t container;
+			container.key = key;
+			container.cardinality = 0;
+			m_Containers.insert(m_Containers.begin() + index, container);
+		}
+
+		container_t & container = m_Containers[index];
+		if(container.bitmap.empty() == false) {
+			uint64_t & word = container.bitmap[value >> 6];
+			uint64_t bit = 1ULL << (value & 63);
+			if(word & bit) {
+				return false;
+			}
+			word |= bit;
+		}
+		else {
+			std::vector<uint16_t>::iterator it = std::lower_bound(container.array.begin(), container.array.end(), value);
+			if(it != container.array.end() && *it == value) {
+				return false;
+			}
+			container.array.insert(it, value);
+		}
+
+		container.cardinality++;
+		normalizeContainer(container);
+
+		return true;
+	}
+
+	bool FamilyTreeMemberSet::remove(uint32_t memberId) {
+		uint16_t key = (uint16_t)(memberId >> 16);
+		uint16_t value = (uint16_t)(memberId & 0xFFFF);
+
+		uint32_t index = findContainer(key);
+		if(index == m_Containers.size() || m_Containers[index].key != key) {
+			return false;
+		}
+
+		container_t & container = m_Containers[index];
+		if(container.bitmap.empty() == false) {
+			uint64_t & word = container.bitmap[value >> 6];
+			uint64_t bit = 1ULL << (value & 63);
+			if((word & bit) == 0) {
+				return false;
+			}
+			word &= ~bit;
+		}
+		else {
+			std::vector<uint16_t>::iterator it = std::lower_bound(container.array.begin(), container.array.end(), value);
+			if(it == container.array.end() || *it != value) {
+				return false;
+			}
+			container.array.erase(it);
+		}
+
+		container.cardinality--;
+		if(container.cardinality == 0) {
+			m_Containers.erase(m_Containers.begin() + index);
+		}
+		else {
+			normalizeContainer(container);
+		}
+
+		return true;
+	}
+
+	bool FamilyTreeMemberSet::contains(uint32_t memberId) const {
+		uint16_t key = (uint16_t)(memberId >> 16);
+		uint32_t index = findContainer(key);
+		if(index == m_Containers.size() || m_Containers[index].key != key) {
+			return false;
+		}
+
+		return containerContains(m_Containers[index], (uint16_t)(memberId & 0xFFFF));
+	}
+
+	uint32_t FamilyTreeMemberSet::size() const {
+		uint32_t numberOfMembers = 0;
+		for(uint32_t i = 0; i < m_Containers.size(); i++) {
+			numberOfMembers += m_Containers[i].cardinality;
+		}
+
+		return numberOfMembers;
+	}
+
+	void FamilyTreeMemberSet::unionWith(FamilyTreeMemberSet const & other) {
+		// Merge the two sorted container lists
+		std::vector<container_t> merged;
+		merged.reserve(m_Containers.size() + other.m_Containers.size());
+
+		uint32_t i = 0;
+		uint32_t j = 0;
+		while(i < m_Containers.size() || j < other.m_Containers.size()) {
+			if(j == other.m_Containers.size() ||
+				(i < m_Containers.size() && m_Containers[i].key < other.m_Containers[j].key)) {
+				merged.push_back(container_t());
+				merged.back().key = m_Containers[i].key;
+				merged.back().cardinality = m_Containers[i].cardinality;
+				merged.back().array.swap(m_Containers[i].array);
+				merged.back().bitmap.swap(m_Containers[i].bitmap);
+				i++;
+			}
+			else if(i == m_Containers.size() || other.m_Containers[j].key < m_Containers[i].key) {
+				merged.push_back(other.m_Containers[j]);
+				j++;
+			}
+			else {
+				unionContainers(m_Containers[i], other.m_Containers[j]);
+				merged.push_back(container_t());
+				merged.back().key = m_Containers[i].key;
+				merged.back().cardinality = m_Containers[i].cardinality;
+				merged.back().array.swap(m_Containers[i].array);
+				merged.back().bitmap.swap(m_Containers[i].bitmap);
+				i++;
+				j++;
+			}
+		}
+
+		m_Containers.swap(merged);
+	}
+
+	void FamilyTreeMemberSet::intersectWith(FamilyTreeMemberSet const & other) {
+		// Containers without a matching key in other become empty
+		uint32_t j = 0;
+		for(uint32_t i = 0; i < m_Containers.size(); i++) {
+			while(j < other.m_Containers.size() && other.m_Containers[j].key < m_Containers[i].key) {
+				j++;
+			}
+
+			if(j < other.m_Containers.size() && other.m_Containers[j].key == m_Containers[i].key) {
+				intersectContainers(m_Containers[i], other.m_Containers[j]);
+			}
+			else {
+				m_Containers[i].cardinality = 0;
+			}
+		}
+
+		removeEmptyContainers();
+	}
+
+	void FamilyTreeMemberSet::differenceWith(FamilyTreeMemberSet const & other) {
+		uint32_t j = 0;
+		for(uint32_t i = 0; i < m_Containers.size(); i++) {
+			while(j < other.m_Containers.size() && other.m_Containers[j].key < m_Containers[i].key) {
+				j++;
+			}
+
+			if(j < other.m_Containers.size() && other.m_Containers[j].key == m_Containers[i].key) {
+				differenceContainers(m_Containers[i], other.m_Containers[j]);
+			}
+		}
+
+		removeEmptyContainers();
+	}
+
+	void FamilyTreeMemberSet::assignBitmap(FamilyTreeMemberBitmap const & bitmap) {
+		clear();
+
+		// Each container covers BITMAP_CONTAINER_WORDS words of the bitmap
+		const uint64_t * pWords = bitmap.getWords();
+		uint32_t numberOfWords = bitmap.getNumberOfWords();
+		for(uint32_t first = 0; first < numberOfWords; first += BITMAP_CONTAINER_WORDS) {
+			uint32_t end = std::min(first + BITMAP_CONTAINER_WORDS, numberOfWords);
+
+			uint32_t cardinality = 0;
+			for(uint32_t i = first; i < end; i++) {
+				cardinality += __builtin_popcountll(pWords[i]);
+			}
+			if(cardinality == 0) {
+				continue;
+			}
+
+			m_Containers.push_back(container_t());
+			container_t & container = m_Containers.back();
+			container.key = (uint16_t)(first / BITMAP_CONTAINER_WORDS);
+			container.cardinality = cardinality;
+			container.bitmap.assign(BITMAP_CONTAINER_WORDS, 0);
+			std::copy(pWords + first, pWords + end, container.bitmap.begin());
+			normalizeContainer(container);
+		}
+	}
+
+	void FamilyTreeMemberSet::getMemberIds(std::vector<uint32_t> & memberIds) const {
+		memberIds.clear();
+		memberIds.reserve(size());
+
+		for(uint32_t i = 0; i < m_Containers.size(); i++) {
+			container_t const & container = m_Containers[i];
+			uint32_t high = (uint32_t)container.key << 16;
+			if(container.bitmap.empty() == false) {
+				for(uint32_t w = 0; w < BITMAP_CONTAINER_WORDS; w++) {
+					uint64_t word = container.bitmap[w];
+					while(word != 0) {
+						memberIds.push_back(high + (w << 6) + __builtin_ctzll(word));
+						word &= word - 1;
+					}
+				}
+			}
+			else {
+				for(uint32_t a = 0; a < container.array.size(); a++) {
+					memberIds.push_back(high + container.array[a]);
+				}
+			}
+		}
+	}
+
+	bool FamilyTreeMemberSet::operator==(FamilyTreeMemberSet const & other) const {
+		if(m_Containers.size() != other.m_Containers.size()) {
+			return false;
+		}
+
+		// Containers are normalized so equal sets have
+		// equal containers
+		for(uint32_t i = 0; i < m_Containers.size(); i++) {
+			container_t const & container = m_Containers[i];
+			container_t const & otherContainer = other.m_Containers[i];
+			if(container.key != otherContainer.key ||
+				container.cardinality != otherContainer.cardinality ||
+				container.array != otherContainer.array ||
+				container.bitmap != otherContainer.bitmap) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,171 @@
+/**
+ *  @file    FamilyTreeNameDictionary.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeNameDictionary
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeNameDictionary
+ *
+ */
+
+#include <algorithm>
+
+#include "FamilyTreeNameDictionary.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyTreeNameDictionary::BLOCK_SIZE;
+
+	FamilyTreeNameDictionary::FamilyTreeNameDictionary() : m_NumberOfNames(0) {
+	}
+
+	FamilyTreeNameDictionary::~FamilyTreeNameDictionary() {
+	}
+
+	void FamilyTreeNameDictionary::appendLength(uint32_t length) {
+		// 7 bits per byte, high bit set on every byte but the last
+		while(length >= 0x80) {
+			m_Data.push_back((uint8_t)(length | 0x80));
+			length >>= 7;
+		}
+		m_Data.push_back((uint8_t)length);
+	}
+
+	uint32_t FamilyTreeNameDictionary::readLength(uint64_t & offset) const {
+		uint32_t length = 0;
+		uint32_t shift = 0;
+		uint8_t byte;
+		do {
+			byte = m_Data[offset++];
+			length |= (uint32_t)(byte & 0x7F) << shift;
+			shift += 7;
+		} while(byte & 0x80);
+
+		return length;
+	}
+
+	void FamilyTreeNameDictionary::decodeName(uint64_t & offset, bool firstInBlock, std::string & name) const {
+		uint32_t sharedLength = firstInBlock ? 0 : readLength(offset);
+		uint32_t suffixLength = readLength(offset);
+
+		name.resize(sharedLength);
+		name.append((const char *)&m_Data[offset], suffixLength);
+		offset += suffixLength;
+	}
+
+	void FamilyTreeNameDictionary::clear() {
+		m_Data.clear();
+		m_BlockOffsets.clear();
+		m_NumberOfNames = 0;
+	}
+
+	void FamilyTreeNameDictionary::build(std::vector<std::string> names) {
+		clear();
+
+		std::sort(names.begin(), names.end());
+		names.erase(std::unique(names.begin(), names.end()), names.end());
+
+		for(uint32_t i = 0; i < names.size(); i++) {
+			std::string const & name = names[i];
+			if(i % BLOCK_SIZE == 0) {
+				m_BlockOffsets.push_back(m_Data.size());
+				appendLength(name.size());
+				m_Data.insert(m_Data.end(), name.begin(), name.end());
+				continue;
+			}
+
+			// Length of the prefix shared with the previous name
+			std::string const & previous = names[i - 1];
+			uint32_t maxShared = std::min(previous.size(), name.size());
+			uint32_t shared = 0;
+			while(shared < maxShared && previous[shared] == name[shared]) {
+				shared++;
+			}
+
+			appendLength(shared);
+			appendLength(name.size() - shared);
+			m_Data.insert(m_Data.end(), name.begin() + shared, name.end());
+		}
+
+		m_NumberOfNames = names.size();
+	}
+
+	uint32_t FamilyTreeNameDictionary::findRank(std::string const & key, bool prefixOnly, bool upper) const {
+		// A name is "before" the key if it is less than the key
+		// (or not greater for upper).  With prefixOnly only the
+		// first key.size() characters of the name are compared.
+		struct {
+			bool operator()(std::string const & name, std::string const & key, bool prefixOnly, bool upper) const {
+				int order = prefixOnly ? name.compare(0, key.size(), key) : name.compare(key);
+				return upper ? (order <= 0) : (order < 0);
+			}
+		} isBefore;
+
+		// Find the last block whose first name is before the key
+		uint32_t low = 0;
+		uint32_t high = m_BlockOffsets.size();
+		std::string name;
+		while(low < high) {
+			uint32_t middle = (low + high) / 2;
+			uint64_t offset = m_BlockOffsets[middle];
+			decodeName(offset, true, name);
+			if(isBefore(name, key, prefixOnly, upper)) {
+				low = middle + 1;
+			}
+			else {
+				high = middle;
+			}
+		}
+
+		if(low == 0) {
+			return 0;
+		}
+
+		// Scan the block for the first name that is not before the key
+		uint32_t block = low - 1;
+		uint32_t rank = block * BLOCK_SIZE;
+		uint32_t end = std::min(rank + BLOCK_SIZE, m_NumberOfNames);
+		uint64_t offset = m_BlockOffsets[block];
+		for(; rank < end; rank++) {
+			decodeName(offset, rank == block * BLOCK_SIZE, name);
+			if(isBefore(name, key, prefixOnly, upper) == false) {
+				break;
+			}
+		}
+
+		return rank;
+	}
+
+	void FamilyTreeNameDictionary::getPrefixRange(std::string const & prefix, uint32_t & first, uint32_t & end) const {
+		first = findRank(prefix, true, false);
+		end = findRank(prefix, true, true);
+	}
+
+	void FamilyTreeNameDictionary::getNames(uint32_t first, uint32_t count, std::vector<std::string> & names) const {
+		names.clear();
+		if(first >= m_NumberOfNames) {
+			return;
+		}
+
+		uint32_t end = (count > m_NumberOfNames - first) ? m_NumberOfNames : first + count;
+		names.reserve(end - first);
+
+		// Decode from the start of the block of the first name
+		uint32_t rank = (first / BLOCK_SIZE) * BLOCK_SIZE;
+		uint64_t offset = m_BlockOffsets[first / BLOCK_SIZE];
+		std::string name;
+		for(; rank < end; rank++) {
+			if(rank % BLOCK_SIZE == 0) {
+				offset = m_BlockOffsets[rank / BLOCK_SIZE];
+			}
+			decodeName(offset, rank % BLOCK_SIZE == 0, name);
+			if(rank >= first) {
+				names.push_back(name);
+			}
+		}
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,107 @@
+/**
+ *  @file    FamilyTreeNameFilter.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeNameFilter
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeNameFilter
+ *
+ */
+
+#include <cstring>
+
+#include "FamilyTreeNameFilter.h"
+
+namespace FamilyTree {
+
+	const uint32_t FamilyTreeNameFilter::WORDS_PER_BLOCK;
+	const uint32_t FamilyTreeNameFilter::BITS_PER_NAME;
+	const uint32_t FamilyTreeNameFilter::MIN_CAPACITY;
+
+	// Odd constants used to pick the bit of each word of a block
+	static const uint32_t BLOCK_SALTS[FamilyTreeNameFilter::WORDS_PER_BLOCK] = {
+		0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+		0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+	};
+
+	FamilyTreeNameFilter::FamilyTreeNameFilter() : m_NumberOfBlocks(0), m_Capacity(0), m_NumberOfNames(0) {
+		reset(MIN_CAPACITY);
+	}
+
+	FamilyTreeNameFilter::~FamilyTreeNameFilter() {
+	}
+
+	uint64_t FamilyTreeNameFilter::hashName(const char * pName, size_t length) {
+		// Multiply-xorshift hash over 8 bytes at a time
+		const uint64_t multiplier = 0x9E3779B97F4A7C15ULL;
+		uint64_t hash = length * multiplier;
+
+		while(length >= 8) {
+			uint64_t word;
+			memcpy(&word, pName, 8);
+			hash = (hash ^ word) * multiplier;
+			hash ^= hash >> 29;
+			pName += 8;
+			length -= 8;
+		}
+
+		if(length > 0) {
+			uint64_t word = 0;
+			memcpy(&word, pName, length);
+			hash = (hash ^ word) * multiplier;
+			hash ^= hash >> 29;
+		}
+
+		// Final avalanche so that every output bit depends on every input bit
+		hash *= 0xBF58476D1CE4E5B9ULL;
+		hash ^= hash >> 32;
+
+		return hash;
+	}
+
+	void FamilyTreeNameFilter::reset(uint32_t capacity) {
+		if(capacity < MIN_CAPACITY) {
+			capacity = MIN_CAPACITY;
+		}
+
+		uint64_t numberOfBits = (uint64_t)capacity * BITS_PER_NAME;
+		m_NumberOfBlocks = (uint32_t)((numberOfBits + WORDS_PER_BLOCK * 64 - 1) / (WORDS_PER_BLOCK * 64));
+		m_Words.assign((size_t)m_NumberOfBlocks * WORDS_PER_BLOCK, 0);
+		m_Capacity = capacity;
+		m_NumberOfNames = 0;
+	}
+
+	void FamilyTreeNameFilter::add(std::string const & name) {
+		uint64_t hash = hashName(name.data(), name.size());
+
+		// The high half of the hash picks the block and the
+		// low half picks one bit in each word of the block
+		uint64_t * pBlock = &m_Words[(size_t)(((hash >> 32) * m_NumberOfBlocks) >> 32) * WORDS_PER_BLOCK];
+		uint32_t key = (uint32_t)hash;
+		for(uint32_t i = 0; i < WORDS_PER_BLOCK; i++) {
+			pBlock[i] |= 1ULL << ((key * BLOCK_SALTS[i]) >> 26);
+		}
+
+		m_NumberOfNames++;
+	}
+
+	bool FamilyTreeNameFilter::mayContain(std::string const & name) const {
+		uint64_t hash = hashName(name.data(), name.size());
+
+		const uint64_t * pBlock = &m_Words[(size_t)(((hash >> 32) * m_NumberOfBlocks) >> 32) * WORDS_PER_BLOCK];
+		uint32_t key = (uint32_t)hash;
+
+		// Every word must have its bit set.  The loop has no
+		// early exit so the compiler can vectorize it.
+		uint64_t missing = 0;
+		for(uint32_t i = 0; i < WORDS_PER_BLOCK; i++) {
+			missing |= ~pBlock[i] & (1ULL << ((key * BLOCK_SALTS[i]) >> 26));
+		}
+
+		return missing == 0;
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,36 @@
+/**
+ *  @file    FamilyTreeParallel.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeParallel
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeParallel
+ *
+ */
+
+#include "FamilyTreeParallel.h"
+
+namespace FamilyTree {
+
+	uint32_t FamilyTreeParallel::s_NumberOfThreads = 0;
+
+	void FamilyTreeParallel::setNumberOfThreads(uint32_t numberOfThreads) {
+		s_NumberOfThreads = numberOfThreads;
+	}
+
+	uint32_t FamilyTreeParallel::getNumberOfThreads() {
+		if(s_NumberOfThreads == 0) {
+			// hardware_concurrency returns 0 when it is not known
+			s_NumberOfThreads = std::thread::hardware_concurrency();
+			if(s_NumberOfThreads == 0) {
+				s_NumberOfThreads = 1;
+			}
+		}
+
+		return s_NumberOfThreads;
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,274 @@
+/**
+ *  @file    FamilyTreePathExpression.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreePathExpression
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreePathExpression
+ *
+ */
+
+#include <algorithm>
+#include <cctype>
+
+#include "FamilyTreePathExpression.h"
+
+namespace FamilyTree {
+
+	// Orders transitions by step, then next state
+	static bool transitionLess
+	(
+		FamilyTreePathExpression::transition_t const & a,
+		FamilyTreePathExpression::transition_t const & b
+	) {
+		return (a.step != b.step) ? (a.step < b.step) : (a.nextState < b.nextState);
+	}
+
+	static bool transitionEqual
+	(
+		FamilyTreePathExpression::transition_t const & a,
+		FamilyTreePathExpression::transition_t const & b
+	) {
+		return a.step == b.step && a.nextState == b.nextState;
+	}
+
+	FamilyTreePathExpression::FamilyTreePathExpression() : m_Offsets(1, 0), m_Position(0) {
+	}
+
+	FamilyTreePathExpression::~FamilyTreePathExpression() {
+	}
+
+	void FamilyTreePathExpression::skipWhitespace() {
+		while(m_Position < m_Expression.size() && isspace((unsigned char)m_Expression[m_Position])) {
+			m_Position++;
+		}
+	}
+
+	uint32_t FamilyTreePathExpression::addParserState() {
+		m_ParserStates.push_back(parser_state_t());
+		return m_ParserStates.size() - 1;
+	}
+
+	bool FamilyTreePathExpression::parseExpression(fragment_t & fragment) {
+		if(parseSequence(fragment) == false) {
+			return false;
+		}
+
+		skipWhitespace();
+		while(m_Position < m_Expression.size() && m_Expression[m_Position] == '|') {
+			m_Position++;
+
+			fragment_t other;
+			if(parseSequence(other) == false) {
+				return false;
+			}
+
+			// Either branch leads from the new start to the new accept state
+			uint32_t start = addParserState();
+			uint32_t accept = addParserState();
+			m_ParserStates[start].epsilons.push_back(fragment.start);
+			m_ParserStates[start].epsilons.push_back(other.start);
+			m_ParserStates[fragment.accept].epsilons.push_back(accept);
+			m_ParserStates[other.accept].epsilons.push_back(accept);
+			fragment.start = start;
+			fragment.accept = accept;
+
+			skipWhitespace();
+		}
+
+		return true;
+	}
+
+	bool FamilyTreePathExpression::parseSequence(fragment_t & fragment) {
+		if(parseRepetition(fragment) == false) {
+			return false;
+		}
+
+		skipWhitespace();
+		while(m_Position < m_Expression.size() && m_Expression[m_Position] == '.') {
+			m_Position++;
+
+			fragment_t other;
+			if(parseRepetition(other) == false) {
+				return false;
+			}
+
+			m_ParserStates[fragment.accept].epsilons.push_back(other.start);
+			fragment.accept = other.accept;
+
+			skipWhitespace();
+		}
+
+		return true;
+	}
+
+	bool FamilyTreePathExpression::parseRepetition(fragment_t & fragment) {
+		if(parseStep(fragment) == false) {
+			return false;
+		}
+
+		skipWhitespace();
+		while(m_Position < m_Expression.size()) {
+			char op = m_Expression[m_Position];
+			if(op != '+' && op != '*' && op != '?') {
+				break;
+			}
+			m_Position++;
+
+			uint32_t start = addParserState();
+			uint32_t accept = addParserState();
+			m_ParserStates[start].epsilons.push_back(fragment.start);
+			m_ParserStates[fragment.accept].epsilons.push_back(accept);
+			if(op != '?') {
+				// Repeat the fragment
+				m_ParserStates[fragment.accept].epsilons.push_back(fragment.start);
+			}
+			if(op != '+') {
+				// Skip the fragment
+				m_ParserStates[start].epsilons.push_back(accept);
+			}
+			fragment.start = start;
+			fragment.accept = accept;
+
+			skipWhitespace();
+		}
+
+		return true;
+	}
+
+	bool FamilyTreePathExpression::parseStep(fragment_t & fragment) {
+		skipWhitespace();
+		if(m_Position >= m_Expression.size()) {
+			return false;
+		}
+
+		if(m_Expression[m_Position] == '(') {
+			m_Position++;
+			if(parseExpression(fragment) == false) {
+				return false;
+			}
+
+			skipWhitespace();
+			if(m_Position >= m_Expression.size() || m_Expression[m_Position] != ')') {
+				return false;
+			}
+			m_Position++;
+
+			return true;
+		}
+
+		uint32_t nameStart = m_Position;
+		std::string name;
+		while(m_Position < m_Expression.size() && isalpha((unsigned char)m_Expression[m_Position])) {
+			name += (char)tolower((unsigned char)m_Expression[m_Position]);
+			m_Position++;
+		}
+
+		step_t step;
+		if(name == "parent" || name == "parents") {
+			step = Step_Parent;
+		}
+		else if(name == "child" || name == "children") {
+			step = Step_Child;
+		}
+		else if(name == "sibling" || name == "siblings") {
+			step = Step_Sibling;
+		}
+		else {
+			m_Position = nameStart;
+			return false;
+		}
+
+		fragment.start = addParserState();
+		fragment.accept = addParserState();
+		transition_t transition = { step, fragment.accept };
+		m_ParserStates[fragment.start].transitions.push_back(transition);
+
+		return true;
+	}
+
+	void FamilyTreePathExpression::removeEpsilons(fragment_t const & fragment) {
+		uint32_t numberOfParserStates = m_ParserStates.size();
+
+		// Compiled state of each parser state (UINT32_MAX if none).  Only
+		// the start state and the targets of step transitions are kept.
+		std::vector<uint32_t> compiledStates(numberOfParserStates, UINT32_MAX);
+		std::vector<uint32_t> parserStates(1, fragment.start);
+		compiledStates[fragment.start] = 0;
+
+		// Parser states in the epsilon closure of the state being compiled
+		std::vector<uint32_t> closureMarks(numberOfParserStates, UINT32_MAX);
+		std::vector<uint32_t> closure;
+		std::vector<transition_t> transitions;
+
+		for(uint32_t state = 0; state < parserStates.size(); state++) {
+			closure.assign(1, parserStates[state]);
+			closureMarks[parserStates[state]] = state;
+			for(uint32_t i = 0; i < closure.size(); i++) {
+				std::vector<uint32_t> const & epsilons = m_ParserStates[closure[i]].epsilons;
+				for(uint32_t j = 0; j < epsilons.size(); j++) {
+					if(closureMarks[epsilons[j]] != state) {
+						closureMarks[epsilons[j]] = state;
+						closure.push_back(epsilons[j]);
+					}
+				}
+			}
+
+			// The state has the transitions of its whole closure
+			transitions.clear();
+			bool accepting = false;
+			for(uint32_t i = 0; i < closure.size(); i++) {
+				if(closure[i] == fragment.accept) {
+					accepting = true;
+				}
+
+				std::vector<transition_t> const & closureTransitions = m_ParserStates[closure[i]].transitions;
+				for(uint32_t j = 0; j < closureTransitions.size(); j++) {
+					uint32_t target = closureTransitions[j].nextState;
+					if(compiledStates[target] == UINT32_MAX) {
+						compiledStates[target] = parserStates.size();
+						parserStates.push_back(target);
+					}
+
+					transition_t transition = { closureTransitions[j].step, compiledStates[target] };
+					transitions.push_back(transition);
+				}
+			}
+
+			std::sort(transitions.begin(), transitions.end(), transitionLess);
+			transitions.erase(std::unique(transitions.begin(), transitions.end(), transitionEqual), transitions.end());
+
+			m_Transitions.insert(m_Transitions.end(), transitions.begin(), transitions.end());
+			m_Offsets.push_back(m_Transitions.size());
+			m_Accepting.push_back(accepting);
+		}
+	}
+
+	bool FamilyTreePathExpression::compile(std::string const & expression) {
+		m_Offsets.assign(1, 0);
+		m_Transitions.clear();
+		m_Accepting.clear();
+
+		m_Expression = expression;
+		m_Position = 0;
+		m_ParserStates.clear();
+
+		fragment_t fragment;
+		bool valid = parseExpression(fragment);
+		skipWhitespace();
+		if(valid && m_Position == m_Expression.size()) {
+			removeEpsilons(fragment);
+		}
+		else {
+			valid = false;
+		}
+
+		m_ParserStates.clear();
+
+		return valid;
+	}
+
+} /* namespace FamilyTree */
@@ -0,0 +1,215 @@
+/**
+ *  @file    FamilyTreeResultCache.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeResultCache
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeResultCache
+ *
+ */
+
+#include "FamilyTreeResultCache.h"
+
+namespace FamilyTree {
+
+	uint64_t FamilyTreeResultCache::hashQuery(query_kind_t queryKind, std::string const & memberName, uint64_t parameter) {
+		// Mix the fields of the query (64-bit finalizer of MurmurHash3)
+		uint64_t hash = ((uint64_t)queryKind << 32) ^ (uint64_t)std::hash<std::string>()(memberName);
+		hash ^= parameter * 0x9E3779B97F4A7C15ULL;
+		hash ^= hash >> 33;
+		hash *= 0xFF51AFD7ED558CCDULL;
+		hash ^= hash >> 33;
+		hash *= 0xC4CEB9FE1A85EC53ULL;
+		hash ^= hash >> 33;
+
+		return hash;
+	}
+
+	bool FamilyTreeResultCache::matches(cache_entry_t const & entry, query_kind_t queryKind, std::string const & memberName, uint64_t parameter) {
+		return entry.queryKind == (uint32_t)queryKind && entry.parameter == parameter && entry.memberName == memberName;
+	}
+
+	FamilyTreeResultCache::FamilyTreeResultCache() {
+	}
+
+	FamilyTreeResultCache::~FamilyTreeResultCache() {
+		configure(0, 0);
+	}
+
+	FamilyTreeResultCache::shard_t & FamilyTreeResultCache::getShard(uint64_t hash) const {
+		// Use the high bits of the hash so that the shard
+		// and the bucket within the shard are independent
+		return *m_Shards[(hash >> 32) % m_Shards.size()];
+	}
+
+	void FamilyTreeResultCache::invalidateShard(shard_t & shard, uint64_t version) {
+		if(shard.version == version) {
+			return;
+		}
+
+		shard.invalidations += shard.index.size();
+		shard.entries.clear();
+		shard.index.clear();
+		shard.version = version;
+	}
+
+	void FamilyTreeResultCache::configure(uint32_t capacity, uint32_t numberOfShards) {
+		for(uint32_t i = 0; i < m_Shards.size(); i++) {
+			delete m_Shards[i];
+		}
+		m_Shards.clear();
+
+		if(capacity == 0) {
+			return;
+		}
+
+		// Split the capacity over the shards.  Every
+		// shard can hold at least one entry.
+		if(numberOfShards == 0) {
+			numberOfShards = 1;
+		}
+		if(numberOfShards > capacity) {
+			numberOfShards = capacity;
+		}
+
+		for(uint32_t i = 0; i < numberOfShards; i++) {
+			shard_t * pShard = new shard_t();
+			pShard->version = 0;
+			pShard->capacity = capacity / numberOfShards + ((i < capacity % numberOfShards) ? 1 : 0);
+			pShard->index.reserve(pShard->capacity);
+			pShard->hits = 0;
+			pShard->misses = 0;
+			pShard->evictions = 0;
+			pShard->invalidations = 0;
+			m_Shards.push_back(pShard);
+		}
+	}
+
+	void FamilyTreeResultCache::clear() {
+		for(uint32_t i = 0; i < m_Shards.size(); i++) {
+			std::lock_guard<std::mutex> guard(m_Shards[i]->lock);
+			m_Shards[i]->entries.clear();
+			m_Shards[i]->index.clear();
+		}
+	}
+
+	bool FamilyTreeResultCache::lookup
+	(
+		query_kind_t queryKind,
+		std::string const & memberName,
+		uint64_t parameter,
+		uint64_t version,
+		name_list_row_t & nameList
+	) {
+		if(m_Shards.empty()) {
+			return false;
+		}
+
+		uint64_t hash = hashQuery(queryKind, memberName, parameter);
+		shard_t & shard = getShard(hash);
+		std::lock_guard<std::mutex> guard(shard.lock);
+
+		invalidateShard(shard, version);
+
+		entry_index_t::iterator it = shard.index.find(hash);
+		if(it == shard.index.end() || matches(*it->second, queryKind, memberName, parameter) == false) {
+			shard.misses++;
+			return false;
+		}
+
+		// Move the entry to the front of the list and share its name list
+		shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+		nameList = it->second->nameList;
+		shard.hits++;
+
+		return true;
+	}
+
+	void FamilyTreeResultCache::insert
+	(
+		query_kind_t queryKind,
+		std::string const & memberName,
+		uint64_t parameter,
+		uint64_t version,
+		name_list_row_t const & nameList
+	) {
+		if(m_Shards.empty()) {
+			return;
+		}
+
+		uint64_t hash = hashQuery(queryKind, memberName, parameter);
+		shard_t & shard = getShard(hash);
+		std::lock_guard<std::mutex> guard(shard.lock);
+
+		// Results computed for an older version are not stored
+		if(version < shard.version) {
+			return;
+		}
+		invalidateShard(shard, version);
+
+		// Replace the entry with the same hash (the same
+		// query, or one whose hash collides with it)
+		entry_index_t::iterator it = shard.index.find(hash);
+		if(it != shard.index.end()) {
+			cache_entry_t & entry = *it->second;
+			if(matches(entry, queryKind, memberName, parameter) == false) {
+				entry.queryKind = (uint32_t)queryKind;
+				entry.parameter = parameter;
+				entry.memberName = memberName;
+			}
+			entry.nameList = nameList;
+			shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+			return;
+		}
+
+		// When the shard is full the least recently used entry
+		// is evicted and its list node reused for the result
+		if(shard.index.size() >= shard.capacity) {
+			shard.index.erase(shard.entries.back().hash);
+			shard.entries.splice(shard.entries.begin(), shard.entries, --shard.entries.end());
+			shard.evictions++;
+		}
+		else {
+			shard.entries.push_front(cache_entry_t());
+		}
+
+		cache_entry_t & entry = shard.entries.front();
+		entry.hash = hash;
+		entry.queryKind = (uint32_t)queryKind;
+		entry.parameter = parameter;
+		entry.memberName = memberName;
+		entry.nameList = nameList;
+		shard.index[hash] = shard.entries.begin();
+	}
+
+	void FamilyTreeResultCache::getStats(cache_stats_t & stats) const {
+		stats.hits = 0;
+		stats.misses = 0;
+		stats.evictions = 0;
+		stats.invalidations = 0;
+		stats.entries = 0;
+
+		for(uint32_t i = 0; i < m_Shards.size(); i++) {
+			std::lock_guard<std::mutex> guard(m_Shards[i]->lock);
+			stats.hits += m_Shards[i]->hits;
+			stats.misses += m_Shards[i]->misses;
+			stats.evictions += m_Shards[i]->evictions;
+			stats.invalidations += m_Shards[i]->invalidations;
+			stats.entries += m_Shards[i]->index.size();
+		}
+	}
+
+	void FamilyTreeResultCache::resetStats() {
+		for(uint32_t i = 0; i < m_Shards.size(); i++) {
+			std::lock_guard<std::mutex> guard(m_Shards[i]->lock);
+			m_Shards[i]->hits = 0;
+			m_Shards[i]->misses = 0;
+			m_Shards[i]->evictions = 0;
+			m_Shards[i]->invalidations = 0;
+		}
+	}
+
+} /* namespace FamilyTree */
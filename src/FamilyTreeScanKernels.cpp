@@ -0,0 +1,369 @@
+/**
+ *  @file    FamilyTreeScanKernels.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeScanKernels
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeScanKernels.
+ *
+ *  The SIMD kernels are compiled for their instruction set with
+ *  the GCC target attribute so that the rest of the program does
+ *  not need to be built with -msse4.1 or -mavx2.  They are only
+ *  called after __builtin_cpu_supports reports that the CPU has
+ *  the instruction set.
+ *
+ *  A value v is in [minValue, maxValue] when the unsigned value
+ *  v - minValue is <= maxValue - minValue, so each vector needs
+ *  one subtraction and one unsigned compare.
+ *
+ */
+
+#include <immintrin.h>
+
+#include "FamilyTreeScanKernels.h"
+
+namespace FamilyTree {
+
+	FamilyTreeScanKernels::range_scan_t FamilyTreeScanKernels::s_pRangeScan = NULL;
+	FamilyTreeScanKernels::range_bitmap_t FamilyTreeScanKernels::s_pRangeBitmap = NULL;
+	FamilyTreeScanKernels::kernel_t FamilyTreeScanKernels::s_Kernel = FamilyTreeScanKernels::Kernel_Auto;
+
+	// Shuffle control for _mm_shuffle_epi8 that moves the
+	// 32-bit lanes selected by a 4-bit mask to the front
+	static uint8_t s_SSECompressShuffles[16][16];
+
+	// Permutation for _mm256_permutevar8x32_epi32 that moves the
+	// 32-bit lanes selected by an 8-bit mask to the front
+	static uint32_t s_AVX2CompressPermutations[256][8];
+
+	static bool s_CompressTablesBuilt = false;
+
+	// Scalar scan of the values from position first onwards.
+	// Always writes the position and only advances the
+	// output when the value matches.
+	static inline uint32_t scanRangeFrom
+	(
+		const uint32_t * pValues,
+		uint32_t first,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t range,
+		uint32_t * pPositions
+	) {
+		uint32_t numberOfMatches = 0;
+		for(uint32_t i = first; i < numberOfValues; i++) {
+			pPositions[numberOfMatches] = i;
+			numberOfMatches += ((pValues[i] - minValue) <= range);
+		}
+
+		return numberOfMatches;
+	}
+
+	static void buildCompressTables() {
+		for(uint32_t mask = 0; mask < 16; mask++) {
+			uint32_t out = 0;
+			for(uint32_t lane = 0; lane < 4; lane++) {
+				if(mask & (1 << lane)) {
+					for(uint32_t byte = 0; byte < 4; byte++) {
+						s_SSECompressShuffles[mask][out * 4 + byte] = lane * 4 + byte;
+					}
+					out++;
+				}
+			}
+			for(; out < 4; out++) {
+				for(uint32_t byte = 0; byte < 4; byte++) {
+					s_SSECompressShuffles[mask][out * 4 + byte] = 0x80;
+				}
+			}
+		}
+
+		for(uint32_t mask = 0; mask < 256; mask++) {
+			uint32_t out = 0;
+			for(uint32_t lane = 0; lane < 8; lane++) {
+				if(mask & (1 << lane)) {
+					s_AVX2CompressPermutations[mask][out++] = lane;
+				}
+			}
+			for(; out < 8; out++) {
+				s_AVX2CompressPermutations[mask][out] = 0;
+			}
+		}
+
+		s_CompressTablesBuilt = true;
+	}
+
+	uint32_t FamilyTreeScanKernels::scanRangeScalar
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint32_t * pPositions
+	) {
+		return scanRangeFrom(pValues, 0, numberOfValues, minValue, maxValue - minValue, pPositions);
+	}
+
+	__attribute__((target("sse4.1,popcnt")))
+	uint32_t FamilyTreeScanKernels::scanRangeSSE41
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint32_t * pPositions
+	) {
+		const __m128i minVector = _mm_set1_epi32((int32_t)minValue);
+		const __m128i rangeVector = _mm_set1_epi32((int32_t)(maxValue - minValue));
+		const __m128i step = _mm_set1_epi32(4);
+		__m128i positions = _mm_setr_epi32(0, 1, 2, 3);
+
+		uint32_t numberOfMatches = 0;
+		uint32_t i = 0;
+		for(; i + 4 <= numberOfValues; i += 4) {
+			__m128i values = _mm_loadu_si128((const __m128i *)(pValues + i));
+			__m128i offsets = _mm_sub_epi32(values, minVector);
+
+			// offsets <= range (unsigned) when max(offsets, range) == range
+			__m128i inRange = _mm_cmpeq_epi32(_mm_max_epu32(offsets, rangeVector), rangeVector);
+			uint32_t mask = _mm_movemask_ps(_mm_castsi128_ps(inRange));
+
+			__m128i shuffle = _mm_loadu_si128((const __m128i *)s_SSECompressShuffles[mask]);
+			_mm_storeu_si128((__m128i *)(pPositions + numberOfMatches), _mm_shuffle_epi8(positions, shuffle));
+			numberOfMatches += __builtin_popcount(mask);
+
+			positions = _mm_add_epi32(positions, step);
+		}
+
+		// Finish the values that do not fill a vector
+		return numberOfMatches + scanRangeFrom(pValues, i, numberOfValues, minValue, maxValue - minValue, pPositions + numberOfMatches);
+	}
+
+	__attribute__((target("avx2,popcnt")))
+	uint32_t FamilyTreeScanKernels::scanRangeAVX2
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint32_t * pPositions
+	) {
+		const __m256i minVector = _mm256_set1_epi32((int32_t)minValue);
+		const __m256i rangeVector = _mm256_set1_epi32((int32_t)(maxValue - minValue));
+		const __m256i step = _mm256_set1_epi32(8);
+		__m256i positions = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+
+		uint32_t numberOfMatches = 0;
+		uint32_t i = 0;
+		for(; i + 8 <= numberOfValues; i += 8) {
+			__m256i values = _mm256_loadu_si256((const __m256i *)(pValues + i));
+			__m256i offsets = _mm256_sub_epi32(values, minVector);
+
+			// offsets <= range (unsigned) when max(offsets, range) == range
+			__m256i inRange = _mm256_cmpeq_epi32(_mm256_max_epu32(offsets, rangeVector), rangeVector);
+			uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(inRange));
+
+			__m256i permutation = _mm256_loadu_si256((const __m256i *)s_AVX2CompressPermutations[mask]);
+			_mm256_storeu_si256((__m256i *)(pPositions + numberOfMatches), _mm256_permutevar8x32_epi32(positions, permutation));
+			numberOfMatches += __builtin_popcount(mask);
+
+			positions = _mm256_add_epi32(positions, step);
+		}
+
+		// Finish the values that do not fill a vector
+		return numberOfMatches + scanRangeFrom(pValues, i, numberOfValues, minValue, maxValue - minValue, pPositions + numberOfMatches);
+	}
+
+	// Scalar bitmap of the values from position first (a
+	// multiple of 64) onwards
+	static inline void rangeBitmapFrom
+	(
+		const uint32_t * pValues,
+		uint32_t first,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t range,
+		uint64_t * pWords
+	) {
+		for(uint32_t i = first; i < numberOfValues; i += 64) {
+			uint32_t end = (numberOfValues - i < 64) ? numberOfValues : i + 64;
+			uint64_t word = 0;
+			for(uint32_t j = i; j < end; j++) {
+				word |= (uint64_t)((pValues[j] - minValue) <= range) << (j - i);
+			}
+			pWords[i >> 6] = word;
+		}
+	}
+
+	void FamilyTreeScanKernels::rangeBitmapScalar
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint64_t * pWords
+	) {
+		rangeBitmapFrom(pValues, 0, numberOfValues, minValue, maxValue - minValue, pWords);
+	}
+
+	__attribute__((target("sse4.1,popcnt")))
+	void FamilyTreeScanKernels::rangeBitmapSSE41
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint64_t * pWords
+	) {
+		const __m128i minVector = _mm_set1_epi32((int32_t)minValue);
+		const __m128i rangeVector = _mm_set1_epi32((int32_t)(maxValue - minValue));
+
+		// Each vector of 4 values gives 4 bits of the word
+		uint32_t i = 0;
+		for(; i + 64 <= numberOfValues; i += 64) {
+			uint64_t word = 0;
+			for(uint32_t j = 0; j < 64; j += 4) {
+				__m128i offsets = _mm_sub_epi32(_mm_loadu_si128((const __m128i *)(pValues + i + j)), minVector);
+				__m128i inRange = _mm_cmpeq_epi32(_mm_max_epu32(offsets, rangeVector), rangeVector);
+				word |= (uint64_t)_mm_movemask_ps(_mm_castsi128_ps(inRange)) << j;
+			}
+			pWords[i >> 6] = word;
+		}
+
+		// Finish the values that do not fill a word
+		rangeBitmapFrom(pValues, i, numberOfValues, minValue, maxValue - minValue, pWords);
+	}
+
+	__attribute__((target("avx2,popcnt")))
+	void FamilyTreeScanKernels::rangeBitmapAVX2
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint64_t * pWords
+	) {
+		const __m256i minVector = _mm256_set1_epi32((int32_t)minValue);
+		const __m256i rangeVector = _mm256_set1_epi32((int32_t)(maxValue - minValue));
+
+		// Each vector of 8 values gives 8 bits of the word
+		uint32_t i = 0;
+		for(; i + 64 <= numberOfValues; i += 64) {
+			uint64_t word = 0;
+			for(uint32_t j = 0; j < 64; j += 8) {
+				__m256i offsets = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *)(pValues + i + j)), minVector);
+				__m256i inRange = _mm256_cmpeq_epi32(_mm256_max_epu32(offsets, rangeVector), rangeVector);
+				word |= (uint64_t)_mm256_movemask_ps(_mm256_castsi256_ps(inRange)) << j;
+			}
+			pWords[i >> 6] = word;
+		}
+
+		// Finish the values that do not fill a word
+		rangeBitmapFrom(pValues, i, numberOfValues, minValue, maxValue - minValue, pWords);
+	}
+
+	bool FamilyTreeScanKernels::isSupported(kernel_t kernel) {
+		switch(kernel) {
+			case Kernel_Auto:	return true;
+			case Kernel_Scalar:	return true;
+			case Kernel_SSE41:	return __builtin_cpu_supports("sse4.1") && __builtin_cpu_supports("popcnt");
+			case Kernel_AVX2:	return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+			default:			return false;
+		}
+	}
+
+	bool FamilyTreeScanKernels::setKernel(kernel_t kernel) {
+		if(isSupported(kernel) == false) {
+			return false;
+		}
+
+		if(s_CompressTablesBuilt == false) {
+			buildCompressTables();
+		}
+
+		if(kernel == Kernel_Auto) {
+			kernel = isSupported(Kernel_AVX2) ? Kernel_AVX2 :
+					 isSupported(Kernel_SSE41) ? Kernel_SSE41 : Kernel_Scalar;
+		}
+
+		switch(kernel) {
+			case Kernel_AVX2:
+				s_pRangeScan = scanRangeAVX2;
+				s_pRangeBitmap = rangeBitmapAVX2;
+				break;
+			case Kernel_SSE41:
+				s_pRangeScan = scanRangeSSE41;
+				s_pRangeBitmap = rangeBitmapSSE41;
+				break;
+			default:
+				s_pRangeScan = scanRangeScalar;
+				s_pRangeBitmap = rangeBitmapScalar;
+				break;
+		}
+		s_Kernel = kernel;
+
+		return true;
+	}
+
+	FamilyTreeScanKernels::kernel_t FamilyTreeScanKernels::getKernel() {
+		if(s_pRangeScan == NULL) {
+			setKernel(Kernel_Auto);
+		}
+
+		return s_Kernel;
+	}
+
+	const char * FamilyTreeScanKernels::getKernelName(kernel_t kernel) {
+		switch(kernel) {
+			case Kernel_Auto:	return "auto";
+			case Kernel_Scalar:	return "scalar";
+			case Kernel_SSE41:	return "sse4.1";
+			case Kernel_AVX2:	return "avx2";
+			default:			return "unknown";
+		}
+	}
+
+	uint32_t FamilyTreeScanKernels::scanRange
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint32_t * pPositions
+	) {
+		if(s_pRangeScan == NULL) {
+			setKernel(Kernel_Auto);
+		}
+
+		if(minValue > maxValue) {
+			return 0;
+		}
+
+		return s_pRangeScan(pValues, numberOfValues, minValue, maxValue, pPositions);
+	}
+
+	void FamilyTreeScanKernels::scanRangeToBitmap
+	(
+		const uint32_t * pValues,
+		uint32_t numberOfValues,
+		uint32_t minValue,
+		uint32_t maxValue,
+		uint64_t * pWords
+	) {
+		if(s_pRangeBitmap == NULL) {
+			setKernel(Kernel_Auto);
+		}
+
+		if(minValue > maxValue) {
+			for(uint32_t i = 0; i < (numberOfValues + 63) / 64; i++) {
+				pWords[i] = 0;
+			}
+			return;
+		}
+
+		s_pRangeBitmap(pValues, numberOfValues, minValue, maxValue, pWords);
+	}
+
+} /* namespace FamilyTree */
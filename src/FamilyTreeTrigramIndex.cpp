@@ -0,0 +1,196 @@
+/**
+ *  @file    FamilyTreeTrigramIndex.cpp
+ *  @author  Kevin Dious
+ *  @date    6/15/2015
+ *
+ *  @brief Implementation of the FamilyTreeTrigramIndex
+ *
+ *  @section DESCRIPTION
+ *
+ *  Implements the FamilyTreeTrigramIndex
+ *
+ */
+
+#include <algorithm>
+#include <cctype>
+
+#include "FamilyTreeTrigramIndex.h"
+
+namespace FamilyTree {
+
+	// Characters used to pad the beginning and end of a name
+	static const uint8_t LEADING_PAD = 0x01;
+	static const uint8_t TRAILING_PAD = 0x02;
+
+	FamilyTreeTrigramIndex::FamilyTreeTrigramIndex() {
+	}
+
+	FamilyTreeTrigramIndex::~FamilyTreeTrigramIndex() {
+	}
+
+	void FamilyTreeTrigramIndex::getTrigrams(const char * pName, size_t length, std::vector<uint32_t> & trigrams) {
+		trigrams.clear();
+
+		// Slide a 3 byte window over the padded, lower cased name
+		uint32_t window = (LEADING_PAD << 8) | LEADING_PAD;
+		for(size_t i = 0; i <= length; i++) {
+			uint8_t c = (i < length) ? (uint8_t)tolower((unsigned char)pName[i]) : TRAILING_PAD;
+			window = ((window << 8) | c) & 0xFFFFFF;
+			trigrams.push_back(window);
+		}
+
+		std::sort(trigrams.begin(), trigrams.end());
+		trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+	}
+
+	uint32_t FamilyTreeTrigramIndex::getBoundedEditDistance
+	(
+		const char * pA,
+		size_t lengthA,
+		const char * pB,
+		size_t lengthB,
+		uint32_t maxDistance
+	) {
+		size_t lengthDifference = (lengthA > lengthB) ? lengthA - lengthB : lengthB - lengthA;
+		if(lengthDifference > maxDistance) {
+			return maxDistance + 1;
+		}
+
+		// Levenshtein distance (ignoring case), one row at a time.  Stop as soon
+		// as every entry of a row is larger than maxDistance.
+		std::vector<uint32_t> previous(lengthB + 1);
+		std::vector<uint32_t> current(lengthB + 1);
+		for(size_t j = 0; j <= lengthB; j++) {
+			previous[j] = j;
+		}
+
+		for(size_t i = 1; i <= lengthA; i++) {
+			current[0] = i;
+			uint32_t rowMinimum = current[0];
+			for(size_t j = 1; j <= lengthB; j++) {
+				uint32_t substitution = previous[j - 1] + ((tolower((unsigned char)pA[i - 1]) == tolower((unsigned char)pB[j - 1])) ? 0 : 1);
+				uint32_t deletion = previous[j] + 1;
+				uint32_t insertion = current[j - 1] + 1;
+				current[j] = std::min(substitution, std::min(deletion, insertion));
+				rowMinimum = std::min(rowMinimum, current[j]);
+			}
+
+			if(rowMinimum > maxDistance) {
+				return maxDistance + 1;
+			}
+			previous.swap(current);
+		}
+
+		return std::min(previous[lengthB], maxDistance + 1);
+	}
+
+	void FamilyTreeTrigramIndex::clear() {
+		m_Trigrams.clear();
+		m_Offsets.clear();
+		m_MemberIds.clear();
+		m_Counts.clear();
+	}
+
+	void FamilyTreeTrigramIndex::build(std::vector<uint32_t> const & memberIds, std::vector<std::string> const & names) {
+		clear();
+
+		// (trigram, member ID) pairs sorted by trigram then member ID
+		std::vector<uint64_t> postings;
+		std::vector<uint32_t> trigrams;
+		for(size_t i = 0; i < names.size(); i++) {
+			getTrigrams(names[i].data(), names[i].size(), trigrams);
+			for(size_t t = 0; t < trigrams.size(); t++) {
+				postings.push_back(((uint64_t)trigrams[t] << 32) | memberIds[i]);
+			}
+		}
+		std::sort(postings.begin(), postings.end());
+
+		// Group the pairs by trigram
+		m_MemberIds.reserve(postings.size());
+		for(size_t i = 0; i < postings.size(); i++) {
+			uint32_t trigram = (uint32_t)(postings[i] >> 32);
+			if(m_Trigrams.empty() || m_Trigrams.back() != trigram) {
+				m_Trigrams.push_back(trigram);
+				m_Offsets.push_back(m_MemberIds.size());
+			}
+			m_MemberIds.push_back((uint32_t)postings[i]);
+		}
+		m_Offsets.push_back(m_MemberIds.size());
+
+		uint32_t maxMemberId = 0;
+		for(size_t i = 0; i < memberIds.size(); i++) {
+			maxMemberId = std::max(maxMemberId, memberIds[i]);
+		}
+		m_Counts.assign(memberIds.empty() ? 0 : maxMemberId + 1, 0);
+	}
+
+	void FamilyTreeTrigramIndex::findCandidates
+	(
+		std::string const & query,
+		uint32_t minShared,
+		std::vector<candidate_t> & candidates
+	) const {
+		candidates.clear();
+		if(minShared == 0) {
+			minShared = 1;
+		}
+
+		std::vector<uint32_t> trigrams;
+		getTrigrams(query.data(), query.size(), trigrams);
+
+		// Posting lists of the query trigrams, shortest first
+		std::vector< std::pair<uint32_t, uint32_t> > lists;
+		for(size_t t = 0; t < trigrams.size(); t++) {
+			std::vector<uint32_t>::const_iterator it = std::lower_bound(m_Trigrams.begin(), m_Trigrams.end(), trigrams[t]);
+			if(it != m_Trigrams.end() && *it == trigrams[t]) {
+				size_t index = it - m_Trigrams.begin();
+				lists.push_back(std::make_pair(m_Offsets[index + 1] - m_Offsets[index], (uint32_t)index));
+			}
+		}
+		if(lists.size() < minShared) {
+			return;
+		}
+		std::sort(lists.begin(), lists.end());
+
+		// A member in none of the (lists - minShared + 1) shortest
+		// lists shares fewer than minShared trigrams, so only those
+		// lists produce candidates.  m_Counts is all zeros between calls.
+		size_t numberOfProbeLists = lists.size() - minShared + 1;
+		std::vector<uint32_t> touched;
+		for(size_t l = 0; l < numberOfProbeLists; l++) {
+			uint32_t index = lists[l].second;
+			for(uint32_t p = m_Offsets[index]; p < m_Offsets[index + 1]; p++) {
+				uint32_t memberId = m_MemberIds[p];
+				if(m_Counts[memberId]++ == 0) {
+					touched.push_back(memberId);
+				}
+			}
+		}
+
+		// Look the candidates up in the longer lists (which
+		// are sorted by member ID) instead of walking them
+		std::sort(touched.begin(), touched.end());
+		for(size_t i = 0; i < touched.size(); i++) {
+			uint32_t memberId = touched[i];
+			uint32_t count = m_Counts[memberId];
+			m_Counts[memberId] = 0;
+
+			for(size_t l = numberOfProbeLists; l < lists.size() && count + (lists.size() - l) >= minShared; l++) {
+				uint32_t index = lists[l].second;
+				if(std::binary_search(m_MemberIds.begin() + m_Offsets[index], m_MemberIds.begin() + m_Offsets[index + 1], memberId)) {
+					count++;
+				}
+			}
+
+			if(count >= minShared) {
+				candidate_t candidate = { memberId, count };
+				candidates.push_back(candidate);
+			}
+		}
+	}
+
+	uint64_t FamilyTreeTrigramIndex::getIndexSize() const {
+		return (m_Trigrams.size() + m_Offsets.size() + m_MemberIds.size() + m_Counts.size()) * sizeof(uint32_t);
+	}
+
+} /* namespace FamilyTree */
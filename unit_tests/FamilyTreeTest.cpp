@@ -18,8 +18,22 @@
 //#include <gtest/gtest.h>		// gtest libs installed on machine
 #include "libs/gtest/gtest.h"	// local gtest libs
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
 #include "FamilyTreeClass.h"
+#include "FamilyTreeConnectedFamilies.h"
+#include "FamilyTreeMaterializedView.h"
+#include "FamilyTreeMemberSet.h"
+#include "FamilyTreeNameDictionary.h"
+#include "FamilyTreeNameFilter.h"
 #include "FamilyTreeOpResultCode.h"
+#include "FamilyTreeParallel.h"
+#include "FamilyTreePathExpression.h"
+#include "FamilyTreeScanKernels.h"
+#include "FamilyTreeTrigramIndex.h"
 
 using namespace FamilyTree;
 
@@ -37,6 +51,20 @@ TEST_F(FamilyTreeTest, initialize) {
     EXPECT_EQ(INPUT_FILE_OPEN_ERROR, testTree.initialize("invalidFileName.txt"));
 
     EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    // Reloading the file replaces the whole tree
+    vector<string> nameList;
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    size_t numberOfMembers = nameList.size();
+
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+    nameList.clear();
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(numberOfMembers, nameList.size());
+
+    nameList.clear();
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    EXPECT_EQ(3, nameList.size());
 }
 
 // Test the FamilyTreeClass::getSiblingNameList method
@@ -574,6 +602,2415 @@ TEST_F(FamilyTreeTest, getMembersWithMostGrandchildren) {
     EXPECT_EQ("Jill", nameList[0]);
 }
 
+// Test the FamilyTreeClass::followInputFile method
+TEST_F(FamilyTreeTest, followInputFile) {
+    string followFilePath = "follow_input_file_test.txt";
+
+    // Write the initial family tree
+    ofstream followFile(followFilePath.c_str());
+    followFile << "MEMBERS:Nancy:Carl:Jill" << endl;
+    followFile << "PARENT:Nancy:CHILDREN:Carl" << endl;
+    followFile.close();
+
+    FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(followFilePath));
+
+    vector<string> nameList;
+    uint32_t linesApplied;
+
+    // NOTHING APPENDED
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(0, linesApplied);
+
+    // Append new records.  The last record is still being written.
+    followFile.open(followFilePath.c_str(), ios::app);
+    followFile << "MEMBERS:Adam" << endl;
+    followFile << "PARENT:Nancy:CHILDREN:Jill:Adam" << endl;
+    followFile << "SIBLINGS:Carl:Jill:Adam";
+    followFile.close();
+
+    // BATCH OF ONE LINE
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(1, linesApplied));
+    EXPECT_EQ(1, linesApplied);
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Adam", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCount(1, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+
+    // REMAINING COMPLETE LINES
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(1, linesApplied);
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCount(3, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Carl", nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // FINISH THE PARTIAL LINE
+
+    followFile.open(followFilePath.c_str(), ios::app);
+    followFile << endl;
+    followFile.close();
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(1, linesApplied);
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(2, nameList));
+    EXPECT_EQ(3, nameList.size());
+
+    // APPENDED RECORD THAT FAILS
+
+    // Zed is not in the tree, so none of the record is applied.
+    // It is skipped and the following line is applied by the next call.
+    followFile.open(followFilePath.c_str(), ios::app);
+    followFile << "PARENT:Carl:CHILDREN:Dave:Zed" << endl;
+    followFile << "MEMBERS:Eve" << endl;
+    followFile.close();
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(vector<string>(1, "Dave")));
+
+    EXPECT_EQ(TREE_CONSTRUCTION_ERROR, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(0, linesApplied);
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Carl", nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(1, linesApplied);
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Carl", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(6, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(0, linesApplied);
+
+    // INITIAL LOAD WITHOUT A TRAILING NEWLINE
+
+    // The last line is applied and following starts at the end of the file
+    followFile.open(followFilePath.c_str());
+    followFile << "MEMBERS:Nancy:Carl:Adam" << endl;
+    followFile << "SIBLINGS:Carl:Adam";
+    followFile.close();
+
+    EXPECT_EQ(SUCCESS, testTree.initialize(followFilePath));
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(3, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Carl", nameList));
+    EXPECT_EQ(1, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(0, linesApplied);
+
+    followFile.open(followFilePath.c_str(), ios::app);
+    followFile << "PARENT:Nancy:CHILDREN:Adam" << endl;
+    followFile.close();
+
+    EXPECT_EQ(SUCCESS, testTree.followInputFile(0, linesApplied));
+    EXPECT_EQ(1, linesApplied);
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Adam", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Carl", nameList));
+    EXPECT_EQ(1, nameList.size());
+
+    remove(followFilePath.c_str());
+
+    // MISSING INPUT FILE
+
+    EXPECT_EQ(INPUT_FILE_OPEN_ERROR, testTree.followInputFile(0, linesApplied));
+}
+
+// Test the FamilyTreeClass::addFamilyMembers method
+TEST_F(FamilyTreeTest, addFamilyMembers) {
+    FamilyTreeClass testTree;
+
+    // Initialize the tree
+    testTree.initialize(g_validInputFilePath);
+
+    vector<string> nameList;
+    vector<string> newMembers;
+    vector<string>::iterator nameIterator;
+
+    // NEW MEMBERS (Nancy is already in the tree and is skipped)
+
+    newMembers.push_back("Zoe");
+    newMembers.push_back("Nancy");
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(newMembers));
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(15, nameList.size());
+    nameIterator = find(nameList.begin(), nameList.end(), "Zoe");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+
+    // The new member has no relationships
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Zoe", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(0, nameList));
+    nameIterator = find(nameList.begin(), nameList.end(), "Zoe");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+}
+
+// Test the FamilyTreeClass::removeFamilyMembers method
+TEST_F(FamilyTreeTest, removeFamilyMembers) {
+    FamilyTreeClass testTree;
+
+    // Initialize the tree
+    testTree.initialize(g_validInputFilePath);
+
+    vector<string> nameList;
+    vector<string> removedMembers;
+
+    // INVALID FAMILY MEMBER (nothing is removed)
+
+    removedMembers.push_back("Kevin");
+    removedMembers.push_back("Invalid_Family_Member_Name");
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.removeFamilyMembers(removedMembers));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(4, nameList.size());
+
+    // REMOVE KEVIN
+
+    removedMembers.pop_back();
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(removedMembers));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(13, nameList.size());
+
+    // Jill no longer has children and Aaron no longer has grandparents
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Jill", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("Aaron", nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // Nancy now has the most grandchildren (Joseph and Catherine)
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithMostGrandchildren(nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+
+    // The member can be added back
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(removedMembers));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(0, nameList.size());
+}
+
+// Test the FamilyTreeClass::addRelationships method
+TEST_F(FamilyTreeTest, addRelationships) {
+    FamilyTreeClass testTree;
+
+    // Initialize the tree
+    testTree.initialize(g_validInputFilePath);
+
+    vector<string> nameList;
+    vector<string> newMembers;
+    vector<string>::iterator nameIterator;
+
+    newMembers.push_back("Zoe");
+    newMembers.push_back("Yuri");
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(newMembers));
+
+    // INVALID FAMILY MEMBER
+
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Adam", "Zoe", FamilyTreeClass::Parent_Child},
+        {"Adam", "Invalid_Family_Member_Name", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Adam", nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // SELF RELATIONSHIP
+
+    relationships = { {"Adam", "Adam", FamilyTreeClass::Sibling} };
+    EXPECT_EQ(INVALID_ARG, testTree.addRelationships(relationships));
+
+    // PARENT AND CHILD
+
+    relationships = {
+        {"Adam", "Zoe", FamilyTreeClass::Parent_Child},
+        {"Yuri", "Adam", FamilyTreeClass::Child_Parent}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Adam", nameList));
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("Yuri", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+
+    // Nancy now has 5 grandchildren
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithMostGrandchildren(nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+
+    // Relationships already in the tree are skipped
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCount(2, nameList));
+    nameIterator = find(nameList.begin(), nameList.end(), "Adam");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+
+    // SIBLINGS
+
+    relationships = { {"Zoe", "Yuri", FamilyTreeClass::Sibling} };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Yuri", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Zoe", nameList[0]);
+}
+
+// Test the FamilyTreeClass::removeRelationships method
+TEST_F(FamilyTreeTest, removeRelationships) {
+    FamilyTreeClass testTree;
+
+    // Initialize the tree
+    testTree.initialize(g_validInputFilePath);
+
+    vector<string> nameList;
+    vector<string>::iterator nameIterator;
+
+    // RELATIONSHIP NOT IN THE TREE (nothing is removed)
+
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Jill", "Kevin", FamilyTreeClass::Parent_Child},
+        {"Nancy", "Kevin", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(RELATIONSHIP_NOT_FOUND, testTree.removeRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Jill", nameList));
+    EXPECT_EQ(1, nameList.size());
+
+    // PARENT AND CHILD
+
+    relationships.pop_back();
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Jill", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("Aaron", nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // Kevin now has the most grandchildren (Mary, Robert and Patrick)
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithMostGrandchildren(nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Kevin", nameList[0]);
+
+    // SIBLINGS
+
+    relationships = { {"Carl", "Jill", FamilyTreeClass::Sibling} };
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Jill", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Adam", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(1, nameList));
+    nameIterator = find(nameList.begin(), nameList.end(), "Carl");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+}
+
+// Test the neighbor lists of the members (read through FamilyMemberSpan)
+TEST_F(FamilyTreeTest, FamilyMemberSpan) {
+    FamilyTreeClass testTree;
+
+    // Ten children and nine siblings of Child 0 grow the neighbor
+    // lists past their initial capacity of four more than once
+    vector<string> names(1, "Nancy");
+    vector<FamilyTreeClass::relationship_record_t> relationships;
+    for(uint32_t i = 0; i < 10; i++) {
+        string childName = "Child " + to_string(i);
+        names.push_back(childName);
+        relationships.push_back({"Nancy", childName, FamilyTreeClass::Parent_Child});
+        if(i > 0) {
+            relationships.push_back({"Child 0", childName, FamilyTreeClass::Sibling});
+        }
+    }
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(names));
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    vector<string> nameList;
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(vector<string>(names.begin() + 1, names.end()), nameList);
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Child 0", nameList));
+    EXPECT_EQ(9, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCount(10, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+
+    // REMOVED RELATIONSHIPS
+
+    // The member is removed from the lists at both ends
+    relationships = {
+        {"Nancy", "Child 4", FamilyTreeClass::Parent_Child},
+        {"Child 0", "Child 4", FamilyTreeClass::Sibling}
+    };
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    EXPECT_EQ(9, nameList.size());
+    EXPECT_EQ(true, find(nameList.begin(), nameList.end(), "Child 4") == nameList.end());
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Child 0", nameList));
+    EXPECT_EQ(8, nameList.size());
+    EXPECT_EQ(true, find(nameList.begin(), nameList.end(), "Child 4") == nameList.end());
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Child 4", nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // REUSED RELATIONSHIPS
+
+    // The removed relationships are reused and only show up
+    // in the lists of their new members
+    relationships = { {"Child 4", "Child 5", FamilyTreeClass::Parent_Child} };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Child 4", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Child 5", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    EXPECT_EQ(9, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Child 5", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Child 0", nameList[0]);
+
+    // REUSED MEMBER ID
+
+    FamilyTreeMemberSet members;
+    vector<uint32_t> memberIds;
+    EXPECT_EQ(SUCCESS, testTree.getMemberSet(vector<string>(1, "Nancy"), members));
+    members.getMemberIds(memberIds);
+    uint32_t nancyId = memberIds[0];
+
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(vector<string>(1, "Nancy")));
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(vector<string>(1, "Zoe")));
+    EXPECT_EQ(SUCCESS, testTree.getMemberSet(vector<string>(1, "Zoe"), members));
+    members.getMemberIds(memberIds);
+    EXPECT_EQ(nancyId, memberIds[0]);
+
+    // The new member starts without neighbors
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Zoe", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Zoe", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("Child 5", nameList));
+    EXPECT_EQ(0, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCount(9, nameList));
+    EXPECT_EQ(0, nameList.size());
+}
+
+// The tag test is a friend of FamilyRelationshipClass and FamilyTreeClass,
+// so it is in their namespace
+namespace FamilyTree {
+
+// Test the relationship type and flags packed in the FamilyRelationshipClass tag
+TEST_F(FamilyTreeTest, FamilyRelationshipClass) {
+    FamilyRelationshipClass relationship;
+
+    // TYPE AND FLAGS
+
+    // The type is recovered from its one-hot bit and the flags
+    // are kept apart from it
+    FamilyTreeClass::relationship_t types[] = {FamilyTreeClass::Parent_Child, FamilyTreeClass::Child_Parent, FamilyTreeClass::Sibling};
+    for(uint32_t i = 0; i < 3; i++) {
+        relationship.setTag(types[i], FamilyRelationshipClass::FLAG_ADOPTIVE | FamilyRelationshipClass::FLAG_STEP);
+        EXPECT_EQ(types[i], relationship.getRelationship());
+        EXPECT_EQ(FamilyRelationshipClass::FLAG_ADOPTIVE | FamilyRelationshipClass::FLAG_STEP, relationship.getFlags());
+    }
+
+    // Flags outside of the flag bits cannot change the type
+    relationship.setTag(FamilyTreeClass::Child_Parent, FamilyRelationshipClass::FLAG_BIOLOGICAL | FamilyRelationshipClass::typeBit(FamilyTreeClass::Parent_Child) | 0x10000);
+    EXPECT_EQ(FamilyTreeClass::Child_Parent, relationship.getRelationship());
+    EXPECT_EQ(FamilyRelationshipClass::FLAG_BIOLOGICAL, relationship.getFlags());
+
+    // MASK TESTS
+
+    relationship.setTag(FamilyTreeClass::Parent_Child, FamilyRelationshipClass::FLAG_ADOPTIVE);
+    uint32_t parentBit = FamilyRelationshipClass::typeBit(FamilyTreeClass::Parent_Child);
+    uint32_t siblingBit = FamilyRelationshipClass::typeBit(FamilyTreeClass::Sibling);
+    uint32_t childBit = FamilyRelationshipClass::typeBit(FamilyTreeClass::Child_Parent);
+
+    EXPECT_EQ(true, relationship.matchesAny(parentBit | siblingBit));
+    EXPECT_EQ(false, relationship.matchesAny(siblingBit | childBit));
+    EXPECT_EQ(true, relationship.matchesAny(FamilyRelationshipClass::FLAG_ADOPTIVE | FamilyRelationshipClass::FLAG_STEP));
+    EXPECT_EQ(false, relationship.matchesAny(FamilyRelationshipClass::FLAG_BIOLOGICAL));
+
+    EXPECT_EQ(true, relationship.matchesAll(parentBit | FamilyRelationshipClass::FLAG_ADOPTIVE));
+    EXPECT_EQ(false, relationship.matchesAll(parentBit | FamilyRelationshipClass::FLAG_BIOLOGICAL));
+    EXPECT_EQ(false, relationship.matchesAll(parentBit | siblingBit));
+    EXPECT_EQ(false, relationship.matchesAll(FamilyRelationshipClass::FLAG_ADOPTIVE | FamilyRelationshipClass::FLAG_STEP));
+
+    // FLAGS AND ATTRIBUTES OF RELATIONSHIPS IN THE TREE
+
+    FamilyTreeClass testTree;
+    const char * names[] = {"Nancy", "Carl", "Jill"};
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(vector<string>(names, names + 3)));
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Nancy", "Carl", FamilyTreeClass::Parent_Child, FamilyRelationshipClass::FLAG_ADOPTIVE}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    // Both directions have the flags and the attributes
+    uint32_t flags = 0;
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipFlags("Nancy", "Carl", FamilyTreeClass::Parent_Child, flags));
+    EXPECT_EQ(FamilyRelationshipClass::FLAG_ADOPTIVE, flags);
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipFlags("Carl", "Nancy", FamilyTreeClass::Child_Parent, flags));
+    EXPECT_EQ(FamilyRelationshipClass::FLAG_ADOPTIVE, flags);
+    EXPECT_EQ(RELATIONSHIP_NOT_FOUND, testTree.getRelationshipFlags("Carl", "Jill", FamilyTreeClass::Sibling, flags));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getRelationshipFlags("Zoe", "Carl", FamilyTreeClass::Parent_Child, flags));
+
+    int32_t value = 0;
+    bool isSet = false;
+    EXPECT_EQ(SUCCESS, testTree.setRelationshipAttribute("Nancy", "Carl", FamilyTreeClass::Parent_Child, "weight", 7));
+    EXPECT_EQ(SUCCESS, testTree.setRelationshipAttribute("Carl", "Nancy", FamilyTreeClass::Child_Parent, "weight", 8));
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipAttribute("Nancy", "Carl", FamilyTreeClass::Parent_Child, "weight", value, isSet));
+    EXPECT_EQ(true, isSet);
+    EXPECT_EQ(8, value);
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipAttribute("Nancy", "Carl", FamilyTreeClass::Parent_Child, "height", value, isSet));
+    EXPECT_EQ(false, isSet);
+    EXPECT_EQ(RELATIONSHIP_NOT_FOUND, testTree.setRelationshipAttribute("Carl", "Jill", FamilyTreeClass::Sibling, "weight", 7));
+
+    // REUSED RELATIONSHIP
+
+    // The removed relationships are reused by the sibling pair
+    // and start without flags and without attributes
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+    relationships = { {"Carl", "Jill", FamilyTreeClass::Sibling} };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipFlags("Carl", "Jill", FamilyTreeClass::Sibling, flags));
+    EXPECT_EQ(0, flags);
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipFlags("Jill", "Carl", FamilyTreeClass::Sibling, flags));
+    EXPECT_EQ(0, flags);
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipAttribute("Jill", "Carl", FamilyTreeClass::Sibling, "weight", value, isSet));
+    EXPECT_EQ(false, isSet);
+}
+
+} /* namespace FamilyTree */
+
+// Test the FamilyTreeClass::setMemberAttributes method
+TEST_F(FamilyTreeTest, setMemberAttributes) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeClass::member_attributes_t attributes;
+    attributes.age = 30;
+    attributes.gender = FamilyMemberClass::Male;
+    attributes.birthYear = 1985;
+
+    EXPECT_EQ(SUCCESS, testTree.setMemberAttributes("Aaron", attributes));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.setMemberAttributes("Zoe", attributes));
+
+    attributes.age = 0;
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Aaron", attributes));
+    EXPECT_EQ(30, attributes.age);
+    EXPECT_EQ(FamilyMemberClass::Male, attributes.gender);
+    EXPECT_EQ(1985, attributes.birthYear);
+}
+
+// Test the FamilyTreeClass::getMemberAttributes method
+TEST_F(FamilyTreeTest, getMemberAttributes) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeClass::member_attributes_t attributes;
+
+    // Attributes from the input file
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Nancy", attributes));
+    EXPECT_EQ(88, attributes.age);
+    EXPECT_EQ(FamilyMemberClass::Female, attributes.gender);
+    EXPECT_EQ(1927, attributes.birthYear);
+
+    // Fields that are not in the input file are unknown
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Kevin", attributes));
+    EXPECT_EQ(40, attributes.age);
+    EXPECT_EQ(FamilyMemberClass::Male, attributes.gender);
+    EXPECT_EQ(FamilyTreeAttributeColumns::INVALID_BIRTH_YEAR, attributes.birthYear);
+
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Mary", attributes));
+    EXPECT_EQ(FamilyTreeAttributeColumns::INVALID_AGE, attributes.age);
+    EXPECT_EQ(FamilyMemberClass::Unknown, attributes.gender);
+
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getMemberAttributes("Zoe", attributes));
+}
+
+// Test the FamilyTreeClass::getMembersMatchingFilter method
+TEST_F(FamilyTreeTest, getMembersMatchingFilter) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    vector<string>::iterator nameIterator;
+
+    // EMPTY FILTER MATCHES EVERY MEMBER
+
+    FamilyTreeClass::member_filter_t filter;
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingFilter(filter, nameList));
+    EXPECT_EQ(14, nameList.size());
+
+    // FEMALE MEMBERS OVER 60 WITH CHILDREN
+
+    filter.minAge = 61;
+    filter.genderMask = (1 << FamilyMemberClass::Female);
+    filter.minChildren = 1;
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingFilter(filter, nameList));
+    EXPECT_EQ(2, nameList.size());
+    nameIterator = find(nameList.begin(), nameList.end(), "Nancy");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+    nameIterator = find(nameList.begin(), nameList.end(), "Jill");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+
+    // FEMALE MEMBERS OVER 60 WITH 3 OR MORE CHILDREN
+
+    filter.minChildren = 3;
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingFilter(filter, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+
+    // BIRTH YEAR RANGE (unknown birth years do not match)
+
+    FamilyTreeClass::member_filter_t yearFilter;
+    yearFilter.minBirthYear = 1950;
+    yearFilter.maxBirthYear = 1960;
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingFilter(yearFilter, nameList));
+    EXPECT_EQ(2, nameList.size());
+
+    // REMOVED MEMBERS DO NOT MATCH
+
+    vector<string> names;
+    names.push_back("Jill");
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(names));
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingFilter(yearFilter, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Carl", nameList[0]);
+}
+
+// Test the FamilyTreeClass::getMembersWithChildCountInRange method
+TEST_F(FamilyTreeTest, getMembersWithChildCountInRange) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    vector<string>::iterator nameIterator;
+
+    // Every kernel that the CPU supports must find the same members
+    FamilyTreeScanKernels::kernel_t kernels[] = {
+		FamilyTreeScanKernels::Kernel_Scalar,
+		FamilyTreeScanKernels::Kernel_SSE41,
+		FamilyTreeScanKernels::Kernel_AVX2
+    };
+
+    for(unsigned int i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+    	if(FamilyTreeScanKernels::setKernel(kernels[i]) == false) {
+    		continue;
+    	}
+
+		// BETWEEN 2 AND 5 CHILDREN
+
+		EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCountInRange(2, 5, nameList));
+		EXPECT_EQ(4, nameList.size());
+		nameIterator = find(nameList.begin(), nameList.end(), "Nancy");
+		EXPECT_EQ(true, nameIterator != nameList.end());
+		nameIterator = find(nameList.begin(), nameList.end(), "Carl");
+		EXPECT_EQ(true, nameIterator != nameList.end());
+		nameIterator = find(nameList.begin(), nameList.end(), "Kevin");
+		EXPECT_EQ(true, nameIterator != nameList.end());
+		nameIterator = find(nameList.begin(), nameList.end(), "George");
+		EXPECT_EQ(true, nameIterator != nameList.end());
+
+		// EXACTLY 1 CHILD
+
+		EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCountInRange(1, 1, nameList));
+		EXPECT_EQ(2, nameList.size());
+		nameIterator = find(nameList.begin(), nameList.end(), "Jill");
+		EXPECT_EQ(true, nameIterator != nameList.end());
+		nameIterator = find(nameList.begin(), nameList.end(), "James");
+		EXPECT_EQ(true, nameIterator != nameList.end());
+
+		// EVERY MEMBER
+
+		EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCountInRange(0, UINT32_MAX, nameList));
+		EXPECT_EQ(14, nameList.size());
+
+		// NO MEMBERS
+
+		EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCountInRange(5, 10, nameList));
+		EXPECT_EQ(0, nameList.size());
+    }
+
+    EXPECT_EQ(true, FamilyTreeScanKernels::setKernel(FamilyTreeScanKernels::Kernel_Auto));
+
+    // INVALID RANGE
+
+    EXPECT_EQ(INVALID_ARG, testTree.getMembersWithChildCountInRange(3, 2, nameList));
+
+    // REMOVED MEMBERS DO NOT MATCH
+
+    vector<string> names;
+    names.push_back("Mary");
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(names));
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithChildCountInRange(0, 0, nameList));
+    EXPECT_EQ(8, nameList.size());
+}
+
+// Test the FamilyTreeClass::getMembersWithSiblingCountInRange method
+TEST_F(FamilyTreeTest, getMembersWithSiblingCountInRange) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    vector<string>::iterator nameIterator;
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCountInRange(1, 2, nameList));
+    EXPECT_EQ(7, nameList.size());
+    nameIterator = find(nameList.begin(), nameList.end(), "Adam");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+    nameIterator = find(nameList.begin(), nameList.end(), "Robert");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCountInRange(3, 3, nameList));
+    EXPECT_EQ(4, nameList.size());
+}
+
+// Test the FamilyTreeClass::getMembersWithGrandchildCountInRange method
+TEST_F(FamilyTreeTest, getMembersWithGrandchildCountInRange) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    vector<string>::iterator nameIterator;
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithGrandchildCountInRange(3, 4, nameList));
+    EXPECT_EQ(3, nameList.size());
+    nameIterator = find(nameList.begin(), nameList.end(), "Nancy");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+    nameIterator = find(nameList.begin(), nameList.end(), "Jill");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+    nameIterator = find(nameList.begin(), nameList.end(), "Kevin");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithGrandchildCountInRange(4, 4, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Jill", nameList[0]);
+}
+
+// Test the FamilyTreeClass::getMemberGeneration method
+TEST_F(FamilyTreeTest, getMemberGeneration) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    uint32_t generation;
+    EXPECT_EQ(SUCCESS, testTree.getMemberGeneration("Nancy", generation));
+    EXPECT_EQ(0, generation);
+    EXPECT_EQ(SUCCESS, testTree.getMemberGeneration("Adam", generation));
+    EXPECT_EQ(1, generation);
+    EXPECT_EQ(SUCCESS, testTree.getMemberGeneration("Kevin", generation));
+    EXPECT_EQ(2, generation);
+    EXPECT_EQ(SUCCESS, testTree.getMemberGeneration("Robert", generation));
+    EXPECT_EQ(4, generation);
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getMemberGeneration("Zoe", generation));
+
+    // Generations follow changes to the tree
+    vector<FamilyTreeClass::relationship_record_t> relationships;
+    FamilyTreeClass::relationship_record_t relationship = { "Robert", "Adam", FamilyTreeClass::Parent_Child };
+    relationships.push_back(relationship);
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getMemberGeneration("Adam", generation));
+    EXPECT_EQ(5, generation);
+
+    // Members in a parent->child cycle have no generation
+    relationships[0].from = "Adam";
+    relationships[0].to = "Nancy";
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getMemberGeneration("Nancy", generation));
+    EXPECT_EQ(FamilyTreeClass::INVALID_GENERATION, generation);
+}
+
+// Test the FamilyTreeClass::getMembersMatchingPredicate method
+TEST_F(FamilyTreeTest, getMembersMatchingPredicate) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    vector<string>::iterator nameIterator;
+    FamilyTreeClass::member_predicate_t predicate;
+    FamilyTreeClass::condition_conjunction_t conjunction;
+    FamilyTreeClass::range_condition_t condition;
+
+    // EMPTY PREDICATE MATCHES NO MEMBERS
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // EMPTY CONJUNCTION MATCHES EVERY MEMBER
+
+    predicate.push_back(conjunction);
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(14, nameList.size());
+
+    // 2 TO 5 CHILDREN AND GENERATION 1
+
+    condition.field = FamilyTreeClass::Field_ChildCount;
+    condition.minValue = 2;
+    condition.maxValue = 5;
+    predicate[0].push_back(condition);
+    condition.field = FamilyTreeClass::Field_Generation;
+    condition.minValue = 1;
+    condition.maxValue = 1;
+    predicate[0].push_back(condition);
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Carl", nameList[0]);
+
+    // ... OR AGE 60 AND OVER
+
+    condition.field = FamilyTreeClass::Field_Age;
+    condition.minValue = 60;
+    condition.maxValue = FamilyTreeAttributeColumns::INVALID_AGE - 1;
+    conjunction.push_back(condition);
+    predicate.push_back(conjunction);
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(3, nameList.size());
+    nameIterator = find(nameList.begin(), nameList.end(), "Nancy");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+    nameIterator = find(nameList.begin(), nameList.end(), "Jill");
+    EXPECT_EQ(true, nameIterator != nameList.end());
+
+    // FEMALE MEMBERS WITH CHILDREN
+
+    predicate.clear();
+    conjunction.clear();
+    condition.field = FamilyTreeClass::Field_Gender;
+    condition.minValue = FamilyMemberClass::Female;
+    condition.maxValue = FamilyMemberClass::Female;
+    conjunction.push_back(condition);
+    condition.field = FamilyTreeClass::Field_ChildCount;
+    condition.minValue = 1;
+    condition.maxValue = INT64_MAX;
+    conjunction.push_back(condition);
+    predicate.push_back(conjunction);
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(2, nameList.size());
+
+    // INVALID FIELD
+
+    predicate[0][0].field = (FamilyTreeClass::member_field_t)100;
+    EXPECT_EQ(INVALID_ARG, testTree.getMembersMatchingPredicate(predicate, nameList));
+
+    // LARGER TREE WITH EVERY KERNEL
+
+    vector<string> names;
+    vector<FamilyTreeClass::relationship_record_t> relationships;
+    for(unsigned int i = 0; i < 150; i++) {
+    	char name[16];
+    	snprintf(name, sizeof(name), "Extra%u", i);
+    	names.push_back(name);
+    	FamilyTreeClass::relationship_record_t relationship = { "Mary", name, FamilyTreeClass::Parent_Child };
+    	relationships.push_back(relationship);
+    }
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(names));
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    predicate.clear();
+    conjunction.clear();
+    condition.field = FamilyTreeClass::Field_Generation;
+    condition.minValue = 5;
+    condition.maxValue = 5;
+    conjunction.push_back(condition);
+    predicate.push_back(conjunction);
+    conjunction.clear();
+    condition.field = FamilyTreeClass::Field_ChildCount;
+    condition.minValue = 150;
+    condition.maxValue = 150;
+    conjunction.push_back(condition);
+    predicate.push_back(conjunction);
+
+    FamilyTreeScanKernels::kernel_t kernels[] = {
+		FamilyTreeScanKernels::Kernel_Scalar,
+		FamilyTreeScanKernels::Kernel_SSE41,
+		FamilyTreeScanKernels::Kernel_AVX2
+    };
+    for(unsigned int i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++) {
+    	if(FamilyTreeScanKernels::setKernel(kernels[i]) == false) {
+    		continue;
+    	}
+
+    	EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    	EXPECT_EQ(151, nameList.size());
+    	nameIterator = find(nameList.begin(), nameList.end(), "Mary");
+    	EXPECT_EQ(true, nameIterator != nameList.end());
+    }
+    EXPECT_EQ(true, FamilyTreeScanKernels::setKernel(FamilyTreeScanKernels::Kernel_Auto));
+
+    // MEMBERS IN A CYCLE HAVE NO GENERATION
+
+    predicate.clear();
+    conjunction.clear();
+    condition.field = FamilyTreeClass::Field_Generation;
+    condition.minValue = 0;
+    condition.maxValue = UINT32_MAX;
+    conjunction.push_back(condition);
+    predicate.push_back(conjunction);
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(164, nameList.size());
+
+    relationships.clear();
+    FamilyTreeClass::relationship_record_t cycle = { "Adam", "Nancy", FamilyTreeClass::Parent_Child };
+    relationships.push_back(cycle);
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    uint32_t generation;
+    EXPECT_EQ(SUCCESS, testTree.getMemberGeneration("Nancy", generation));
+    EXPECT_EQ(FamilyTreeClass::INVALID_GENERATION, generation);
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(true, nameList.size() < 164);
+    nameIterator = find(nameList.begin(), nameList.end(), "Nancy");
+    EXPECT_EQ(true, nameIterator == nameList.end());
+    nameIterator = find(nameList.begin(), nameList.end(), "Adam");
+    EXPECT_EQ(true, nameIterator == nameList.end());
+
+    predicate[0][0].minValue = FamilyTreeClass::INVALID_GENERATION;
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, nameList));
+    EXPECT_EQ(0, nameList.size());
+}
+
+// Test the FamilyTreeMemberSet set algebra
+TEST_F(FamilyTreeTest, FamilyTreeMemberSet) {
+	FamilyTreeMemberSet evens;
+	FamilyTreeMemberSet threes;
+	vector<uint32_t> memberIds;
+
+	// Array containers
+	for(uint32_t i = 0; i < 30; i += 2) {
+		EXPECT_EQ(true, evens.add(i));
+	}
+	EXPECT_EQ(false, evens.add(0));
+	for(uint32_t i = 0; i < 30; i += 3) {
+		threes.add(i);
+	}
+	EXPECT_EQ(15, evens.size());
+	EXPECT_EQ(true, evens.contains(4));
+	EXPECT_EQ(false, evens.contains(5));
+
+	FamilyTreeMemberSet result = evens;
+	result.intersectWith(threes);
+	result.getMemberIds(memberIds);
+	EXPECT_EQ(5, memberIds.size());
+	EXPECT_EQ(0, memberIds[0]);
+	EXPECT_EQ(24, memberIds[4]);
+
+	result = evens;
+	result.unionWith(threes);
+	EXPECT_EQ(20, result.size());
+
+	result = evens;
+	result.differenceWith(threes);
+	EXPECT_EQ(10, result.size());
+	EXPECT_EQ(false, result.contains(6));
+
+	EXPECT_EQ(true, evens.remove(4));
+	EXPECT_EQ(false, evens.remove(4));
+	EXPECT_EQ(false, evens.contains(4));
+
+	// Bitmap containers in several high 16 bit ranges
+	FamilyTreeMemberSet large;
+	FamilyTreeMemberSet odds;
+	for(uint32_t i = 0; i < 200000; i++) {
+		large.add(i);
+		if(i & 1) {
+			odds.add(i);
+		}
+	}
+	EXPECT_EQ(200000, large.size());
+	EXPECT_EQ(100000, odds.size());
+
+	result = large;
+	result.differenceWith(odds);
+	EXPECT_EQ(100000, result.size());
+	EXPECT_EQ(true, result.contains(131072));
+	EXPECT_EQ(false, result.contains(131073));
+
+	result.unionWith(odds);
+	EXPECT_EQ(true, result == large);
+
+	result.intersectWith(threes);
+	result.getMemberIds(memberIds);
+	EXPECT_EQ(10, memberIds.size());
+	EXPECT_EQ(27, memberIds[9]);
+
+	// Bitmap conversion
+	FamilyTreeMemberBitmap bitmap(200000);
+	bitmap.set(3);
+	bitmap.set(70000);
+	bitmap.set(199999);
+	result.assignBitmap(bitmap);
+	result.getMemberIds(memberIds);
+	EXPECT_EQ(3, memberIds.size());
+	EXPECT_EQ(70000, memberIds[1]);
+	EXPECT_EQ(199999, memberIds[2]);
+
+	result.clear();
+	EXPECT_EQ(true, result.empty());
+}
+
+// Test the FamilyTreeClass::getMemberSet and FamilyTreeClass::getNameList methods
+TEST_F(FamilyTreeTest, getMemberSet) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet members;
+    vector<string> names;
+    vector<string> nameList;
+    names.push_back("Kevin");
+    names.push_back("Nancy");
+    names.push_back("Kevin");
+    EXPECT_EQ(SUCCESS, testTree.getMemberSet(names, members));
+    EXPECT_EQ(2, members.size());
+
+    EXPECT_EQ(SUCCESS, testTree.getNameList(members, nameList));
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ(true, find(nameList.begin(), nameList.end(), "Kevin") != nameList.end());
+    EXPECT_EQ(true, find(nameList.begin(), nameList.end(), "Nancy") != nameList.end());
+
+    names.push_back("Zoe");
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getMemberSet(names, members));
+    EXPECT_EQ(0, members.size());
+
+    // Member IDs that are not in the tree
+    members.add(1000);
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getNameList(members, nameList));
+
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersSet(members));
+    EXPECT_EQ(14, members.size());
+    EXPECT_EQ(SUCCESS, testTree.getNameList(members, nameList));
+    EXPECT_EQ(14, nameList.size());
+}
+
+// Test the FamilyTreeClass::getChildrenSet, FamilyTreeClass::getSiblingSet
+// and FamilyTreeClass::getGrandparentSet methods
+TEST_F(FamilyTreeTest, getChildrenSet) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet members;
+    FamilyTreeMemberSet children;
+    FamilyTreeMemberSet siblings;
+    vector<string> nameList;
+
+    EXPECT_EQ(SUCCESS, testTree.getChildrenSet("Kevin", children));
+    EXPECT_EQ(4, children.size());
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getChildrenSet("Zoe", children));
+
+    // Grandchildren of Nancy
+    EXPECT_EQ(SUCCESS, testTree.getChildrenSet("Nancy", members));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenSet(members, children));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(children, nameList));
+    EXPECT_EQ(3, nameList.size());
+
+    // The input set can also be the output set
+    EXPECT_EQ(SUCCESS, testTree.getChildrenSet(members, members));
+    EXPECT_EQ(true, members == children);
+
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentSet("Kevin", members));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(members, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getGrandparentSet("Zoe", members));
+
+    // Siblings of Aaron who have no children
+    EXPECT_EQ(SUCCESS, testTree.getSiblingSet("Aaron", siblings));
+    EXPECT_EQ(3, siblings.size());
+    FamilyTreeClass::member_predicate_t predicate(1);
+    FamilyTreeClass::range_condition_t condition;
+    condition.field = FamilyTreeClass::Field_ChildCount;
+    condition.minValue = 0;
+    condition.maxValue = 0;
+    predicate[0].push_back(condition);
+    EXPECT_EQ(SUCCESS, testTree.getMembersMatchingPredicate(predicate, members));
+    siblings.intersectWith(members);
+    EXPECT_EQ(SUCCESS, testTree.getNameList(siblings, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Samuel", nameList[0]);
+
+    // Siblings of the children of Kevin
+    EXPECT_EQ(SUCCESS, testTree.getChildrenSet("Kevin", children));
+    EXPECT_EQ(SUCCESS, testTree.getSiblingSet(children, siblings));
+    EXPECT_EQ(true, siblings == children);
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getSiblingSet("Zoe", siblings));
+}
+
+// Test the FamilyTreeClass::enableResultCache and FamilyTreeClass::getResultCacheStats methods
+TEST_F(FamilyTreeTest, enableResultCache) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    FamilyTreeClass::result_cache_stats_t stats;
+
+    // DISABLED CACHE
+
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(SUCCESS, testTree.getResultCacheStats(stats));
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(0, stats.misses);
+
+    EXPECT_EQ(INVALID_ARG, testTree.enableResultCache(8, 0));
+    EXPECT_EQ(SUCCESS, testTree.enableResultCache(8, 2));
+
+    // REPEATED QUERIES HIT THE CACHE
+
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(4, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(4, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("Kevin", nameList));
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("Kevin", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Joseph", nameList));
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Joseph", nameList));
+    EXPECT_EQ(1, nameList.size());
+    // An unknown name is rejected by the name filter
+    // before the cache is read, so it is not a miss
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getSiblingNameList("Zoe", nameList));
+
+    EXPECT_EQ(SUCCESS, testTree.getResultCacheStats(stats));
+    EXPECT_EQ(3, stats.hits);
+    EXPECT_EQ(3, stats.misses);
+    EXPECT_EQ(3, stats.entries);
+
+    // HITS SHARE THE CACHED NAME LIST
+
+    FamilyTreeClass::name_list_row_t firstRow;
+    FamilyTreeClass::name_list_row_t secondRow;
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", firstRow));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", secondRow));
+    EXPECT_EQ(firstRow.get(), secondRow.get());
+    EXPECT_EQ(4, firstRow->size());
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getChildrenNameList("Zoe", secondRow));
+
+    // CHANGES TO THE TREE INVALIDATE THE CACHE
+
+    vector<string> names;
+    names.push_back("Zoe");
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(names));
+    vector<FamilyTreeClass::relationship_record_t> relationships;
+    FamilyTreeClass::relationship_record_t relationship = { "Kevin", "Zoe", FamilyTreeClass::Parent_Child };
+    relationships.push_back(relationship);
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    EXPECT_EQ(SUCCESS, testTree.resetResultCacheStats());
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(5, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getResultCacheStats(stats));
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(1, stats.misses);
+
+    // A name list returned before the change is not modified
+    EXPECT_EQ(4, firstRow->size());
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", secondRow));
+    EXPECT_EQ(5, secondRow->size());
+
+    // ATTRIBUTE CHANGES KEEP THE CACHE
+
+    FamilyTreeClass::member_attributes_t attributes;
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Kevin", attributes));
+    attributes.age = 40;
+    EXPECT_EQ(SUCCESS, testTree.setMemberAttributes("Kevin", attributes));
+    EXPECT_EQ(SUCCESS, testTree.resetResultCacheStats());
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(5, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getResultCacheStats(stats));
+    EXPECT_EQ(1, stats.hits);
+    EXPECT_EQ(0, stats.misses);
+
+    // LEAST RECENTLY USED RESULTS ARE EVICTED
+
+    EXPECT_EQ(SUCCESS, testTree.enableResultCache(1, 1));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(SUCCESS, testTree.getResultCacheStats(stats));
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(3, stats.misses);
+    EXPECT_EQ(2, stats.evictions);
+    EXPECT_EQ(1, stats.entries);
+
+    // RELOADING THE TREE INVALIDATES THE CACHE
+
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(4, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getResultCacheStats(stats));
+    EXPECT_EQ(0, stats.hits);
+    EXPECT_EQ(1, stats.invalidations);
+}
+
+// Test the FamilyTreeNameFilter and the unknown name fast path of the FamilyTreeClass
+TEST_F(FamilyTreeTest, FamilyTreeNameFilter) {
+	FamilyTreeNameFilter filter;
+	char name[32];
+
+	// Added names are always reported
+	for(unsigned int i = 0; i < FamilyTreeNameFilter::MIN_CAPACITY; i++) {
+		snprintf(name, sizeof(name), "Member%u", i);
+		filter.add(name);
+	}
+	EXPECT_EQ(false, filter.isFull());
+	for(unsigned int i = 0; i < FamilyTreeNameFilter::MIN_CAPACITY; i++) {
+		snprintf(name, sizeof(name), "Member%u", i);
+		EXPECT_EQ(true, filter.mayContain(name));
+	}
+
+	// Few of the other names are reported
+	unsigned int falsePositives = 0;
+	for(unsigned int i = 0; i < 100000; i++) {
+		snprintf(name, sizeof(name), "Unknown%u", i);
+		if(filter.mayContain(name)) {
+			falsePositives++;
+		}
+	}
+	EXPECT_GT(1000, falsePositives);
+
+	filter.reset(0);
+	EXPECT_EQ(FamilyTreeNameFilter::MIN_CAPACITY, filter.getCapacity());
+	EXPECT_EQ(false, filter.mayContain("Member0"));
+
+	// The filter of the tree grows with the tree
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> names;
+    vector<string> nameList;
+    for(unsigned int i = 0; i < 3 * FamilyTreeNameFilter::MIN_CAPACITY; i++) {
+    	snprintf(name, sizeof(name), "Extra%u", i);
+    	names.push_back(name);
+    }
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(names));
+    for(unsigned int i = 0; i < names.size(); i++) {
+    	EXPECT_EQ(SUCCESS, testTree.getChildrenNameList(names[i], nameList));
+    }
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Kevin", nameList));
+    EXPECT_EQ(4, nameList.size());
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getChildrenNameList("Kevn", nameList));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getGrandparentNameList("Kevn", nameList));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getSiblingNameList("Kevn", nameList));
+
+    // Removed names are not found even though the filter still has them
+    names.resize(1);
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(names));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getChildrenNameList(names[0], nameList));
+}
+
+// Test the FamilyTreeNameDictionary
+TEST_F(FamilyTreeTest, FamilyTreeNameDictionary) {
+	FamilyTreeNameDictionary dictionary;
+	vector<string> names;
+	vector<string> page;
+	char name[32];
+
+	// Names that share long prefixes and span several blocks
+	for(unsigned int i = 0; i < 1000; i++) {
+		snprintf(name, sizeof(name), "Member%04u", 999 - i);
+		names.push_back(name);
+	}
+	names.push_back("Member0001");
+	names.push_back("");
+	dictionary.build(names);
+	EXPECT_EQ(1001, dictionary.size());
+
+	dictionary.getNames(0, 3, page);
+	EXPECT_EQ(3, page.size());
+	EXPECT_EQ("", page[0]);
+	EXPECT_EQ("Member0000", page[1]);
+	EXPECT_EQ("Member0001", page[2]);
+
+	dictionary.getNames(999, 10, page);
+	EXPECT_EQ(2, page.size());
+	EXPECT_EQ("Member0998", page[0]);
+	EXPECT_EQ("Member0999", page[1]);
+
+	EXPECT_EQ(1, dictionary.lowerBound("Member0000"));
+	EXPECT_EQ(2, dictionary.upperBound("Member0000"));
+	EXPECT_EQ(18, dictionary.lowerBound("Member0016x"));
+	EXPECT_EQ(1001, dictionary.lowerBound("Z"));
+
+	uint32_t first;
+	uint32_t end;
+	dictionary.getPrefixRange("Member05", first, end);
+	EXPECT_EQ(100, end - first);
+	dictionary.getNames(first, 1, page);
+	EXPECT_EQ("Member0500", page[0]);
+	dictionary.getPrefixRange("Member1", first, end);
+	EXPECT_EQ(0, end - first);
+	dictionary.getPrefixRange("", first, end);
+	EXPECT_EQ(1001, end - first);
+
+	EXPECT_GT(names.size() * 10, dictionary.getEncodedSize());
+}
+
+// Test the FamilyTreeClass::getMembersWithNamePrefix and
+// FamilyTreeClass::getMembersInNameRange methods
+TEST_F(FamilyTreeTest, getMembersWithNamePrefix) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    uint32_t numberOfMatches;
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithNamePrefix("", 0, 100, nameList, numberOfMatches));
+    EXPECT_EQ(14, numberOfMatches);
+    EXPECT_EQ(14, nameList.size());
+    EXPECT_EQ(true, is_sorted(nameList.begin(), nameList.end()));
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithNamePrefix("Ca", 0, 100, nameList, numberOfMatches));
+    EXPECT_EQ(2, numberOfMatches);
+    EXPECT_EQ("Carl", nameList[0]);
+    EXPECT_EQ("Catherine", nameList[1]);
+
+    // Pages
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithNamePrefix("", 12, 5, nameList, numberOfMatches));
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Robert", nameList[0]);
+    EXPECT_EQ("Samuel", nameList[1]);
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithNamePrefix("", 20, 5, nameList, numberOfMatches));
+    EXPECT_EQ(0, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithNamePrefix("Zo", 0, 100, nameList, numberOfMatches));
+    EXPECT_EQ(0, numberOfMatches);
+
+    // The dictionary follows changes to the members
+    vector<string> names;
+    names.push_back("Zoe");
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(names));
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithNamePrefix("Zo", 0, 100, nameList, numberOfMatches));
+    EXPECT_EQ(1, numberOfMatches);
+    names[0] = "Carl";
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(names));
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithNamePrefix("Ca", 0, 100, nameList, numberOfMatches));
+    EXPECT_EQ(1, numberOfMatches);
+    EXPECT_EQ("Catherine", nameList[0]);
+
+    // Ranges
+    EXPECT_EQ(SUCCESS, testTree.getMembersInNameRange("George", "Kevin", 0, 100, nameList, numberOfMatches));
+    EXPECT_EQ(5, numberOfMatches);
+    EXPECT_EQ("George", nameList[0]);
+    EXPECT_EQ("Kevin", nameList[4]);
+    EXPECT_EQ(SUCCESS, testTree.getMembersInNameRange("H", "Jz", 1, 100, nameList, numberOfMatches));
+    EXPECT_EQ(3, numberOfMatches);
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Jill", nameList[0]);
+    EXPECT_EQ(INVALID_ARG, testTree.getMembersInNameRange("Kevin", "George", 0, 100, nameList, numberOfMatches));
+}
+
+// Test the FamilyTreeTrigramIndex
+TEST_F(FamilyTreeTest, FamilyTreeTrigramIndex) {
+	vector<uint32_t> trigrams;
+	FamilyTreeTrigramIndex::getTrigrams("Anna", 4, trigrams);
+	EXPECT_EQ(5, trigrams.size());
+	FamilyTreeTrigramIndex::getTrigrams("nanana", 6, trigrams);
+	EXPECT_EQ(5, trigrams.size());
+
+	EXPECT_EQ(0, FamilyTreeTrigramIndex::getBoundedEditDistance("Kevin", 5, "kevin", 5, 2));
+	EXPECT_EQ(1, FamilyTreeTrigramIndex::getBoundedEditDistance("Kevin", 5, "Kevn", 4, 2));
+	EXPECT_EQ(2, FamilyTreeTrigramIndex::getBoundedEditDistance("Kevin", 5, "Kelvn", 5, 2));
+	EXPECT_EQ(3, FamilyTreeTrigramIndex::getBoundedEditDistance("Kevin", 5, "Nancy", 5, 2));
+	EXPECT_EQ(3, FamilyTreeTrigramIndex::getBoundedEditDistance("Kevin", 5, "Ke", 2, 2));
+
+	FamilyTreeTrigramIndex index;
+	vector<uint32_t> memberIds;
+	vector<string> names;
+	memberIds.push_back(7);
+	names.push_back("Catherine");
+	memberIds.push_back(3);
+	names.push_back("Katherine");
+	memberIds.push_back(5);
+	names.push_back("Carl");
+	index.build(memberIds, names);
+
+	vector<FamilyTreeTrigramIndex::candidate_t> candidates;
+	index.findCandidates("Catharine", 1, candidates);
+	EXPECT_EQ(3, candidates.size());
+	EXPECT_EQ(3, candidates[0].memberId);
+	EXPECT_EQ(7, candidates[2].memberId);
+	EXPECT_EQ(7, candidates[2].sharedTrigrams);
+	index.findCandidates("Catharine", 4, candidates);
+	EXPECT_EQ(2, candidates.size());
+	index.findCandidates("Zzz", 1, candidates);
+	EXPECT_EQ(0, candidates.size());
+}
+
+// Test the FamilyTreeClass::getClosestMemberNames method
+TEST_F(FamilyTreeTest, getClosestMemberNames) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    vector<string> nameList;
+    vector<uint32_t> distances;
+
+    EXPECT_EQ(SUCCESS, testTree.getClosestMemberNames("Kevn", 3, 2, nameList, distances));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Kevin", nameList[0]);
+    EXPECT_EQ(1, distances[0]);
+
+    EXPECT_EQ(SUCCESS, testTree.getClosestMemberNames("catherine", 3, 2, nameList, distances));
+    EXPECT_EQ("Catherine", nameList[0]);
+    EXPECT_EQ(0, distances[0]);
+
+    // Short names check every member
+    EXPECT_EQ(SUCCESS, testTree.getClosestMemberNames("Jil", 3, 2, nameList, distances));
+    EXPECT_EQ("Jill", nameList[0]);
+
+    // Ties are ordered by name and only maxCount names are returned
+    EXPECT_EQ(SUCCESS, testTree.getClosestMemberNames("Jxxx", 10, 4, nameList, distances));
+    EXPECT_EQ(true, is_sorted(distances.begin(), distances.end()));
+    EXPECT_EQ(SUCCESS, testTree.getClosestMemberNames("Jxxx", 2, 4, nameList, distances));
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Jill", nameList[0]);
+    EXPECT_EQ("Adam", nameList[1]);
+
+    EXPECT_EQ(SUCCESS, testTree.getClosestMemberNames("Zebede", 3, 2, nameList, distances));
+    EXPECT_EQ(0, nameList.size());
+
+    // The index follows changes to the members
+    vector<string> names;
+    names.push_back("Zebedee");
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(names));
+    EXPECT_EQ(SUCCESS, testTree.getClosestMemberNames("Zebede", 3, 2, nameList, distances));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ(1, distances[0]);
+}
+
+// Test the FamilyTreeClass::getDescendantSet method
+TEST_F(FamilyTreeTest, getDescendantSet) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet founders;
+    FamilyTreeMemberSet descendants;
+    vector<string> names;
+    vector<string> nameList;
+
+    names.push_back("Nancy");
+    EXPECT_EQ(SUCCESS, testTree.getDescendantSet(names, descendants));
+    EXPECT_EQ(13, descendants.size());
+
+    // Kevin descends from Jill so he is one of the descendants
+    names.clear();
+    names.push_back("Jill");
+    names.push_back("Kevin");
+    EXPECT_EQ(SUCCESS, testTree.getDescendantSet(names, descendants));
+    EXPECT_EQ(8, descendants.size());
+
+    names.clear();
+    names.push_back("Carl");
+    names.push_back("James");
+    EXPECT_EQ(SUCCESS, testTree.getDescendantSet(names, descendants));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(descendants, nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(3, nameList.size());
+    EXPECT_EQ("Catherine", nameList[0]);
+    EXPECT_EQ("Joseph", nameList[1]);
+    EXPECT_EQ("Mary", nameList[2]);
+
+    names.push_back("Zoe");
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getDescendantSet(names, descendants));
+    EXPECT_EQ(true, descendants.empty());
+
+    // Large tree where member i is the child of members i / 3 and
+    // (i + 1) / 3, so every branch overlaps its neighbor
+    const uint32_t numberOfMembers = 30000;
+    FamilyTreeClass largeTree;
+    EXPECT_EQ(SUCCESS, largeTree.initialize(g_validInputFilePath));
+    names.clear();
+    for(uint32_t i = 0; i < numberOfMembers; i++) {
+        names.push_back("M" + to_string(i));
+    }
+    EXPECT_EQ(SUCCESS, largeTree.addFamilyMembers(names));
+    vector<FamilyTreeClass::relationship_record_t> relationships;
+    for(uint32_t i = 1; i < numberOfMembers; i++) {
+        relationships.push_back({names[i / 3], names[i], FamilyTreeClass::Parent_Child});
+        if((i + 1) / 3 != i / 3 && (i + 1) / 3 < i) {
+            relationships.push_back({names[(i + 1) / 3], names[i], FamilyTreeClass::Parent_Child});
+        }
+    }
+    EXPECT_EQ(SUCCESS, largeTree.addRelationships(relationships));
+
+    names.clear();
+    names.push_back("M1");
+    names.push_back("M7");
+    names.push_back("M100");
+    EXPECT_EQ(SUCCESS, largeTree.getMemberSet(names, founders));
+
+    // Expected result: children of the founders until nothing changes
+    FamilyTreeMemberSet expected;
+    FamilyTreeMemberSet level = founders;
+    while(level.empty() == false) {
+        EXPECT_EQ(SUCCESS, largeTree.getChildrenSet(level, level));
+        level.differenceWith(expected);
+        expected.unionWith(level);
+    }
+
+    FamilyTreeClass::descendant_search_stats_t stats;
+    FamilyTreeParallel::setNumberOfThreads(1);
+    EXPECT_EQ(SUCCESS, largeTree.getDescendantSet(founders, descendants, stats));
+    EXPECT_EQ(true, descendants == expected);
+    EXPECT_EQ(0, stats.parallelLevels);
+
+    // Large frontiers are expanded bottom-up and split over the threads
+    FamilyTreeParallel::setNumberOfThreads(4);
+    EXPECT_EQ(SUCCESS, largeTree.getDescendantSet(founders, descendants, stats));
+    EXPECT_EQ(true, descendants == expected);
+    EXPECT_LT(0, stats.bottomUpLevels);
+    EXPECT_LT(stats.bottomUpLevels, stats.levels);
+    EXPECT_LT(0, stats.parallelLevels);
+
+    // The founders can be the output set
+    EXPECT_EQ(SUCCESS, largeTree.getDescendantSet(founders, founders));
+    EXPECT_EQ(true, founders == expected);
+    FamilyTreeParallel::setNumberOfThreads(0);
+}
+
+// Test the FamilyTreeClass::getCommonAncestorSet and FamilyTreeClass::getCommonAncestorsForPairs methods
+TEST_F(FamilyTreeTest, getCommonAncestorSet) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet ancestors;
+    vector<string> names;
+    vector<string> nameList;
+
+    EXPECT_EQ(SUCCESS, testTree.getAncestorSet("Mary", ancestors));
+    EXPECT_EQ(4, ancestors.size());
+    EXPECT_EQ(SUCCESS, testTree.getAncestorSet("Nancy", ancestors));
+    EXPECT_EQ(true, ancestors.empty());
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getAncestorSet("Zoe", ancestors));
+
+    names.push_back("Mary");
+    names.push_back("Robert");
+    EXPECT_EQ(SUCCESS, testTree.getCommonAncestorSet(names, ancestors));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(ancestors, nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(3, nameList.size());
+    EXPECT_EQ("Jill", nameList[0]);
+    EXPECT_EQ("Kevin", nameList[1]);
+    EXPECT_EQ("Nancy", nameList[2]);
+    EXPECT_EQ(SUCCESS, testTree.getMinimalCommonAncestorSet(names, ancestors));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(ancestors, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Kevin", nameList[0]);
+
+    // Kevin is an ancestor of Mary but not his own ancestor
+    names.clear();
+    names.push_back("Kevin");
+    names.push_back("Mary");
+    names.push_back("Patrick");
+    EXPECT_EQ(SUCCESS, testTree.getMinimalCommonAncestorSet(names, ancestors));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(ancestors, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Jill", nameList[0]);
+
+    names.push_back("Joseph");
+    EXPECT_EQ(SUCCESS, testTree.getMinimalCommonAncestorSet(names, ancestors));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(ancestors, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+
+    names.push_back("Nancy");
+    EXPECT_EQ(SUCCESS, testTree.getCommonAncestorSet(names, ancestors));
+    EXPECT_EQ(true, ancestors.empty());
+
+    names.push_back("Zoe");
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getCommonAncestorSet(names, ancestors));
+    names.clear();
+    EXPECT_EQ(INVALID_ARG, testTree.getCommonAncestorSet(names, ancestors));
+
+    vector<FamilyTreeClass::member_pair_t> pairs = {
+        {"Mary", "Robert"},
+        {"Joseph", "Aaron"},
+        {"Kevin", "Mary"},
+        {"Nancy", "Carl"}
+    };
+    vector<FamilyTreeMemberSet> commonAncestors;
+    EXPECT_EQ(SUCCESS, testTree.getCommonAncestorsForPairs(pairs, false, commonAncestors));
+    EXPECT_EQ(4, commonAncestors.size());
+    EXPECT_EQ(3, commonAncestors[0].size());
+    EXPECT_EQ(1, commonAncestors[1].size());
+    EXPECT_EQ(2, commonAncestors[2].size());
+    EXPECT_EQ(0, commonAncestors[3].size());
+    EXPECT_EQ(SUCCESS, testTree.getCommonAncestorsForPairs(pairs, true, commonAncestors));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(commonAncestors[0], nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Kevin", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getNameList(commonAncestors[2], nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Jill", nameList[0]);
+
+    pairs.push_back({"Mary", "Zoe"});
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getCommonAncestorsForPairs(pairs, false, commonAncestors));
+
+    // Many pairs split over several threads give the same
+    // result as the group query for each pair
+    const uint32_t numberOfMembers = 3000;
+    FamilyTreeClass largeTree;
+    EXPECT_EQ(SUCCESS, largeTree.initialize(g_validInputFilePath));
+    names.clear();
+    for(uint32_t i = 0; i < numberOfMembers; i++) {
+        names.push_back("M" + to_string(i));
+    }
+    EXPECT_EQ(SUCCESS, largeTree.addFamilyMembers(names));
+    vector<FamilyTreeClass::relationship_record_t> relationships;
+    for(uint32_t i = 1; i < numberOfMembers; i++) {
+        relationships.push_back({names[i / 3], names[i], FamilyTreeClass::Parent_Child});
+        if((i + 1) / 3 != i / 3 && (i + 1) / 3 < i) {
+            relationships.push_back({names[(i + 1) / 3], names[i], FamilyTreeClass::Parent_Child});
+        }
+    }
+    EXPECT_EQ(SUCCESS, largeTree.addRelationships(relationships));
+
+    pairs.clear();
+    for(uint32_t i = 0; i < 600; i++) {
+        pairs.push_back({names[(i * 7) % numberOfMembers], names[numberOfMembers - 1 - i]});
+    }
+    FamilyTreeParallel::setNumberOfThreads(4);
+    EXPECT_EQ(SUCCESS, largeTree.getCommonAncestorsForPairs(pairs, true, commonAncestors));
+    FamilyTreeParallel::setNumberOfThreads(0);
+
+    for(uint32_t i = 0; i < pairs.size(); i++) {
+        names.clear();
+        names.push_back(pairs[i].first);
+        names.push_back(pairs[i].second);
+        EXPECT_EQ(SUCCESS, largeTree.getMinimalCommonAncestorSet(names, ancestors));
+        EXPECT_EQ(true, ancestors == commonAncestors[i]);
+    }
+}
+
+// Test the FamilyTreeClass kinship, relationship and inbreeding coefficient methods
+TEST_F(FamilyTreeTest, getKinshipCoefficient) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    double value;
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("Nancy", "Nancy", value));
+    EXPECT_DOUBLE_EQ(0.5, value);
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("Nancy", "Carl", value));
+    EXPECT_DOUBLE_EQ(0.25, value);
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("Jill", "Carl", value));
+    EXPECT_DOUBLE_EQ(0.125, value);
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("Mary", "Nancy", value));
+    EXPECT_DOUBLE_EQ(0.03125, value);
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("Mary", "Joseph", value));
+    EXPECT_DOUBLE_EQ(0.0078125, value);
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipCoefficient("Carl", "Nancy", value));
+    EXPECT_DOUBLE_EQ(0.5, value);
+    EXPECT_EQ(SUCCESS, testTree.getInbreedingCoefficient("Mary", value));
+    EXPECT_DOUBLE_EQ(0.0, value);
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getKinshipCoefficient("Mary", "Zoe", value));
+
+    // Attribute changes keep the kinship engine
+    FamilyTreeClass::member_attributes_t attributes;
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Mary", attributes));
+    attributes.age = 12;
+    EXPECT_EQ(SUCCESS, testTree.setMemberAttributes("Mary", attributes));
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("Mary", "Joseph", value));
+    EXPECT_DOUBLE_EQ(0.0078125, value);
+
+    // Full siblings C and D have a child E
+    vector<string> names = { "A", "B", "C", "D", "E" };
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(names));
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"A", "C", FamilyTreeClass::Parent_Child},
+        {"B", "C", FamilyTreeClass::Parent_Child},
+        {"A", "D", FamilyTreeClass::Parent_Child},
+        {"B", "D", FamilyTreeClass::Parent_Child},
+        {"C", "E", FamilyTreeClass::Parent_Child},
+        {"D", "E", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipCoefficient("C", "D", value));
+    EXPECT_DOUBLE_EQ(0.5, value);
+    EXPECT_EQ(SUCCESS, testTree.getInbreedingCoefficient("E", value));
+    EXPECT_DOUBLE_EQ(0.25, value);
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("E", "E", value));
+    EXPECT_DOUBLE_EQ(0.625, value);
+    EXPECT_EQ(SUCCESS, testTree.getKinshipCoefficient("E", "C", value));
+    EXPECT_DOUBLE_EQ(0.375, value);
+    EXPECT_EQ(SUCCESS, testTree.getRelationshipCoefficient("E", "C", value));
+    EXPECT_DOUBLE_EQ(0.75 / sqrt(1.25), value);
+
+    // Members in or below a parent->child cycle have no kinship
+    relationships = { {"E", "A", FamilyTreeClass::Parent_Child} };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(INVALID_ARG, testTree.getInbreedingCoefficient("E", value));
+    EXPECT_EQ(SUCCESS, testTree.getInbreedingCoefficient("Mary", value));
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+
+    // The matrix split over several threads matches the single pair queries
+    const uint32_t numberOfMembers = 400;
+    FamilyTreeClass largeTree;
+    EXPECT_EQ(SUCCESS, largeTree.initialize(g_validInputFilePath));
+    names.clear();
+    for(uint32_t i = 0; i < numberOfMembers; i++) {
+        names.push_back("M" + to_string(i));
+    }
+    EXPECT_EQ(SUCCESS, largeTree.addFamilyMembers(names));
+    relationships.clear();
+    for(uint32_t i = 2; i < numberOfMembers; i++) {
+        relationships.push_back({names[i / 2 - 1], names[i], FamilyTreeClass::Parent_Child});
+        relationships.push_back({names[(i * 7) % (i / 2)], names[i], FamilyTreeClass::Parent_Child});
+    }
+    EXPECT_EQ(SUCCESS, largeTree.addRelationships(relationships));
+
+    vector<string> cohort;
+    for(uint32_t i = 0; i < 150; i++) {
+        cohort.push_back(names[numberOfMembers - 1 - 2 * i]);
+    }
+    vector<double> matrix;
+    FamilyTreeParallel::setNumberOfThreads(4);
+    EXPECT_EQ(SUCCESS, largeTree.getKinshipMatrix(cohort, matrix));
+    FamilyTreeParallel::setNumberOfThreads(0);
+    EXPECT_EQ(cohort.size() * cohort.size(), matrix.size());
+    for(uint32_t i = 0; i < cohort.size(); i += 7) {
+        for(uint32_t j = 0; j < cohort.size(); j += 5) {
+            EXPECT_EQ(SUCCESS, largeTree.getKinshipCoefficient(cohort[i], cohort[j], value));
+            EXPECT_DOUBLE_EQ(value, matrix[i * cohort.size() + j]);
+        }
+    }
+
+    cohort.push_back("Zoe");
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, largeTree.getKinshipMatrix(cohort, matrix));
+}
+
+// Test the FamilyTreePathExpression class
+TEST_F(FamilyTreeTest, FamilyTreePathExpression) {
+	FamilyTreePathExpression automaton;
+
+    EXPECT_EQ(true, automaton.compile("parent+"));
+    EXPECT_EQ(2, automaton.getNumberOfStates());
+    EXPECT_EQ(false, automaton.isAccepting(0));
+    EXPECT_EQ(true, automaton.isAccepting(1));
+    EXPECT_EQ(1, automaton.endTransitions(1) - automaton.beginTransitions(1));
+    EXPECT_EQ(FamilyTreePathExpression::Step_Parent, automaton.beginTransitions(1)->step);
+    EXPECT_EQ(1, automaton.beginTransitions(1)->nextState);
+
+    // The start state of an optional path is accepting
+    EXPECT_EQ(true, automaton.compile(" Children * "));
+    EXPECT_EQ(true, automaton.isAccepting(0));
+    EXPECT_EQ(true, automaton.compile("(parent | sibling).child?"));
+    EXPECT_EQ(true, automaton.compile("parent.(sibling|parent.child)+.children"));
+
+    EXPECT_EQ(false, automaton.compile(""));
+    EXPECT_EQ(0, automaton.getNumberOfStates());
+    EXPECT_EQ(false, automaton.compile("parent..child"));
+    EXPECT_EQ(false, automaton.compile("(parent"));
+    EXPECT_EQ(false, automaton.compile("parent)"));
+    EXPECT_EQ(false, automaton.compile("+parent"));
+    EXPECT_EQ(false, automaton.compile("parent.uncle"));
+    EXPECT_EQ(7, automaton.getErrorPosition());
+}
+
+// Test the FamilyTreeClass::getMembersByPath method
+TEST_F(FamilyTreeTest, getMembersByPath) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet members;
+    FamilyTreeMemberSet expected;
+    vector<string> nameList;
+
+    // Cousins
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Kevin", "parent.sibling.child", members));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(members, nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Catherine", nameList[0]);
+    EXPECT_EQ("Joseph", nameList[1]);
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Mary", "parent.sibling", members));
+    EXPECT_EQ(3, members.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Aaron", "parent.sibling", members));
+    EXPECT_EQ(0, members.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Mary", "parent.parent | parent.sibling", members));
+    EXPECT_EQ(4, members.size());
+
+    // A member is not part of the result of its own paths
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Aaron", "parent.child", members));
+    EXPECT_EQ(SUCCESS, testTree.getSiblingSet("Aaron", expected));
+    EXPECT_EQ(true, members == expected);
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Mary", "parent*", members));
+    EXPECT_EQ(SUCCESS, testTree.getAncestorSet("Mary", expected));
+    EXPECT_EQ(true, members == expected);
+
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Nancy", "child+", members));
+    EXPECT_EQ(13, members.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Nancy", "child.child", members));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenSet("Nancy", expected));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenSet(expected, expected));
+    EXPECT_EQ(true, members == expected);
+
+    EXPECT_EQ(INVALID_ARG, testTree.getMembersByPath("Mary", "parent..child", members));
+    EXPECT_EQ(INVALID_ARG, testTree.getMembersByPath("Mary", "uncle", members));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getMembersByPath("Zoe", "parent", members));
+}
+
+// Test the FamilyTreeMaterializedView class
+TEST_F(FamilyTreeTest, FamilyTreeMaterializedView) {
+    FamilyTreeMaterializedView view;
+    FamilyTreeMaterializedView::view_stats_t stats;
+    const uint32_t * pRow;
+    uint32_t count;
+
+    EXPECT_EQ(true, view.isStale());
+    EXPECT_EQ(false, view.compile("parent.."));
+    EXPECT_EQ(true, view.compile("parent.sibling"));
+    EXPECT_EQ("parent.sibling", view.getExpression());
+
+    // Rows 0: {1, 2}, 1: {}, 2: {0}
+    vector<uint32_t> offsets = { 0, 2, 2, 3 };
+    vector<uint32_t> memberIds = { 1, 2, 0 };
+    view.assign(offsets, memberIds);
+    EXPECT_EQ(false, view.isStale());
+    view.getRow(0, pRow, count);
+    EXPECT_EQ(2, count);
+    EXPECT_EQ(2, pRow[1]);
+    view.getRow(1, pRow, count);
+    EXPECT_EQ(0, count);
+    view.getRow(7, pRow, count);
+    EXPECT_EQ(0, count);
+
+    // Recomputed rows are read from the overlay until it is compacted
+    view.markDirty(1);
+    view.markDirty(5);
+    EXPECT_EQ(true, view.isDirty(1));
+    EXPECT_EQ(false, view.isDirty(0));
+    view.getStats(stats);
+    EXPECT_EQ(2, stats.dirtyRows);
+
+    view.setRow(1, vector<uint32_t>(1, 4));
+    view.setRow(5, vector<uint32_t>(1, 3));
+    EXPECT_EQ(false, view.isDirty(1));
+    view.getStats(stats);
+    EXPECT_EQ(0, stats.dirtyRows);
+    EXPECT_EQ(2, stats.overlayRows);
+    EXPECT_EQ(5, stats.entries);
+
+    view.compact();
+    view.getStats(stats);
+    EXPECT_EQ(6, stats.rows);
+    EXPECT_EQ(0, stats.overlayRows);
+    EXPECT_EQ(5, stats.entries);
+    view.getRow(1, pRow, count);
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(4, pRow[0]);
+    view.getRow(5, pRow, count);
+    EXPECT_EQ(1, count);
+    EXPECT_EQ(3, pRow[0]);
+
+    // Too many dirty rows make the view stale
+    for(uint32_t i = 0; i < 100; i++) {
+        view.markDirty(i);
+    }
+    EXPECT_EQ(true, view.isStale());
+}
+
+// Test the FamilyTreeClass::registerMaterializedView method
+TEST_F(FamilyTreeTest, registerMaterializedView) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet members;
+    FamilyTreeMemberSet expected;
+    vector<string> nameList;
+    FamilyTreeClass::materialized_view_stats_t stats;
+
+    EXPECT_EQ(INVALID_ARG, testTree.registerMaterializedView("invalid", "parent..sibling"));
+    EXPECT_EQ(INVALID_ARG, testTree.getMaterializedViewSet("invalid", "Mary", members));
+    EXPECT_EQ(SUCCESS, testTree.registerMaterializedView("auntsAndUncles", "parent.sibling"));
+    EXPECT_EQ(SUCCESS, testTree.registerMaterializedView("cousins", "parent.sibling.child"));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getMaterializedViewSet("cousins", "Zoe", members));
+
+    const char * names[] = { "Kevin", "Mary", "Aaron", "Nancy", "Adam" };
+    for(uint32_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        EXPECT_EQ(SUCCESS, testTree.getMaterializedViewSet("auntsAndUncles", names[i], members));
+        EXPECT_EQ(SUCCESS, testTree.getMembersByPath(names[i], "parent.sibling", expected));
+        EXPECT_EQ(true, members == expected);
+        EXPECT_EQ(SUCCESS, testTree.getMaterializedViewSet("cousins", names[i], members));
+        EXPECT_EQ(SUCCESS, testTree.getMembersByPath(names[i], "parent.sibling.child", expected));
+        EXPECT_EQ(true, members == expected);
+    }
+
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewNameList("cousins", "Kevin", nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Catherine", nameList[0]);
+    EXPECT_EQ("Joseph", nameList[1]);
+
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewStats("cousins", stats));
+    EXPECT_EQ(false, stats.stale);
+    EXPECT_EQ(0, stats.dirtyRows);
+    EXPECT_EQ(true, stats.memoryBytes > 0);
+
+    // The views follow the changes of the tree
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(vector<string>(1, "Zoe")));
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Adam", "Zoe", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewStats("auntsAndUncles", stats));
+    EXPECT_EQ(true, stats.dirtyRows > 0);
+
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewSet("auntsAndUncles", "Zoe", members));
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Zoe", "parent.sibling", expected));
+    EXPECT_EQ(true, members == expected);
+    EXPECT_EQ(true, members.size() > 0);
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewSet("cousins", "Kevin", members));
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Kevin", "parent.sibling.child", expected));
+    EXPECT_EQ(true, members == expected);
+
+    relationships = { {"Zoe", "Kevin", FamilyTreeClass::Sibling} };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewSet("cousins", "Catherine", members));
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Catherine", "parent.sibling.child", expected));
+    EXPECT_EQ(true, members == expected);
+
+    relationships = { {"Adam", "Zoe", FamilyTreeClass::Parent_Child} };
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewSet("auntsAndUncles", "Zoe", members));
+    EXPECT_EQ(0, members.size());
+
+    // Rebuilt from scratch on every thread
+    FamilyTreeParallel::setNumberOfThreads(4);
+    EXPECT_EQ(SUCCESS, testTree.registerMaterializedView("cousins", "parent.sibling.child"));
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewSet("cousins", "Kevin", members));
+    EXPECT_EQ(SUCCESS, testTree.getMembersByPath("Kevin", "parent.sibling.child", expected));
+    EXPECT_EQ(true, members == expected);
+    FamilyTreeParallel::setNumberOfThreads(0);
+
+    // Views survive initializing the tree again
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewStats("cousins", stats));
+    EXPECT_EQ(false, stats.stale);
+    EXPECT_EQ(SUCCESS, testTree.getMaterializedViewNameList("cousins", "Kevin", nameList));
+    EXPECT_EQ(2, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.unregisterMaterializedView("cousins"));
+    EXPECT_EQ(INVALID_ARG, testTree.unregisterMaterializedView("cousins"));
+}
+
+// Test the FamilyTreeClass::getFamilyUnitSiblingSet method
+TEST_F(FamilyTreeTest, getFamilyUnitSiblingSet) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet members;
+    FamilyTreeMemberSet expected;
+    vector<string> nameList;
+    FamilyTreeClass::family_unit_stats_t stats;
+
+    // One unit per parent with children
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitStats(stats));
+    EXPECT_EQ(6, stats.units);
+    EXPECT_EQ(6, stats.parentEntries);
+    EXPECT_EQ(13, stats.childEntries);
+    EXPECT_EQ(true, stats.memoryBytes > 0);
+
+    // The units agree with the declared relationships
+    const char * names[] = { "Nancy", "Carl", "Kevin", "Aaron", "Mary", "Patrick" };
+    for(uint32_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        EXPECT_EQ(SUCCESS, testTree.getFamilyUnitSiblingSet(names[i], members));
+        EXPECT_EQ(SUCCESS, testTree.getSiblingSet(names[i], expected));
+        EXPECT_EQ(true, members == expected);
+        EXPECT_EQ(SUCCESS, testTree.getFamilyUnitChildrenSet(names[i], members));
+        EXPECT_EQ(SUCCESS, testTree.getChildrenSet(names[i], expected));
+        EXPECT_EQ(true, members == expected);
+    }
+
+    // A child of Kevin and Adam is a half sibling of Kevin's other children
+    // without any declared sibling relationship
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(vector<string>(1, "Zoe")));
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Kevin", "Zoe", FamilyTreeClass::Parent_Child},
+        {"Adam", "Zoe", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitStats(stats));
+    EXPECT_EQ(7, stats.units);
+    EXPECT_EQ(8, stats.parentEntries);
+    EXPECT_EQ(14, stats.childEntries);
+
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitSiblingSet("Zoe", members));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(members, nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(4, nameList.size());
+    EXPECT_EQ("Aaron", nameList[0]);
+    EXPECT_EQ("Samuel", nameList[3]);
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitSiblingSet("George", members));
+    EXPECT_EQ(4, members.size());
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitChildrenSet("Kevin", members));
+    EXPECT_EQ(5, members.size());
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitChildrenSet("Adam", members));
+    EXPECT_EQ(1, members.size());
+
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitSiblingSet("Nancy", members));
+    EXPECT_EQ(0, members.size());
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getFamilyUnitSiblingSet("Yuri", members));
+}
+
+// Test the FamilyTreeClass::getFullAndHalfSiblingSets method
+TEST_F(FamilyTreeTest, getFullAndHalfSiblingSets) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeMemberSet fullSiblings;
+    FamilyTreeMemberSet halfSiblings;
+    FamilyTreeMemberSet expected;
+    vector<string> nameList;
+
+    EXPECT_EQ(SUCCESS, testTree.getFullAndHalfSiblingSets("George", fullSiblings, halfSiblings));
+    EXPECT_EQ(SUCCESS, testTree.getSiblingSet("George", expected));
+    EXPECT_EQ(true, fullSiblings == expected);
+    EXPECT_EQ(0, halfSiblings.size());
+
+    // Counts agree with the declared siblings before any half siblings exist
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(3, FamilyTreeClass::Siblings_Full, nameList));
+    EXPECT_EQ(4, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(1, FamilyTreeClass::Siblings_Half, nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // Zoe (Kevin and Adam) and Yuri (Kevin and Adam) are full siblings of
+    // each other and half siblings of Kevin's other children.  Xavier (Adam)
+    // is a half sibling of both of them but not of Kevin's other children.
+    vector<string> newMembers = { "Zoe", "Yuri", "Xavier" };
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(newMembers));
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Kevin", "Zoe", FamilyTreeClass::Parent_Child},
+        {"Adam", "Zoe", FamilyTreeClass::Parent_Child},
+        {"Yuri", "Adam", FamilyTreeClass::Child_Parent},
+        {"Yuri", "Kevin", FamilyTreeClass::Child_Parent},
+        {"Adam", "Xavier", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    EXPECT_EQ(SUCCESS, testTree.getFullAndHalfSiblingSets("Zoe", fullSiblings, halfSiblings));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(fullSiblings, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Yuri", nameList[0]);
+    EXPECT_EQ(5, halfSiblings.size());
+
+    EXPECT_EQ(SUCCESS, testTree.getFullAndHalfSiblingSets("Aaron", fullSiblings, halfSiblings));
+    EXPECT_EQ(3, fullSiblings.size());
+    EXPECT_EQ(SUCCESS, testTree.getNameList(halfSiblings, nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Yuri", nameList[0]);
+    EXPECT_EQ("Zoe", nameList[1]);
+
+    EXPECT_EQ(SUCCESS, testTree.getFullAndHalfSiblingSets("Xavier", fullSiblings, halfSiblings));
+    EXPECT_EQ(0, fullSiblings.size());
+    EXPECT_EQ(2, halfSiblings.size());
+
+    // Zoe and Yuri share both parents with each other but are only counted once
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(5, FamilyTreeClass::Siblings_Half, nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Yuri", nameList[0]);
+    EXPECT_EQ("Zoe", nameList[1]);
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(2, FamilyTreeClass::Siblings_Half, nameList));
+    EXPECT_EQ(5, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(1, FamilyTreeClass::Siblings_Full, nameList));
+    EXPECT_EQ(6, nameList.size());
+
+    // Declared siblings are unchanged
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(3, FamilyTreeClass::Siblings_Declared, nameList));
+    EXPECT_EQ(4, nameList.size());
+
+    // Removing Kevin as a parent of Zoe moves her to Xavier's unit
+    vector<FamilyTreeClass::relationship_record_t> removedRelationships = {
+        {"Kevin", "Zoe", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(removedRelationships));
+    EXPECT_EQ(SUCCESS, testTree.getFullAndHalfSiblingSets("Zoe", fullSiblings, halfSiblings));
+    EXPECT_EQ(SUCCESS, testTree.getNameList(fullSiblings, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Xavier", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getNameList(halfSiblings, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Yuri", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(6, FamilyTreeClass::Siblings_Half, nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Yuri", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(5, FamilyTreeClass::Siblings_Half, nameList));
+    EXPECT_EQ(0, nameList.size());
+
+    // Removing Adam leaves Zoe and Xavier without parents and makes
+    // Yuri a full sibling of Kevin's other children
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(vector<string>(1, "Adam")));
+    EXPECT_EQ(SUCCESS, testTree.getFullAndHalfSiblingSets("Zoe", fullSiblings, halfSiblings));
+    EXPECT_EQ(0, fullSiblings.size());
+    EXPECT_EQ(0, halfSiblings.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(4, FamilyTreeClass::Siblings_Full, nameList));
+    EXPECT_EQ(5, nameList.size());
+    EXPECT_EQ(SUCCESS, testTree.getMembersWithSiblingCount(0, FamilyTreeClass::Siblings_Half, nameList));
+    EXPECT_EQ(16, nameList.size());
+
+    FamilyTreeClass::family_unit_stats_t stats;
+    EXPECT_EQ(SUCCESS, testTree.getFamilyUnitStats(stats));
+    EXPECT_EQ(6, stats.units);
+    EXPECT_EQ(6, stats.parentEntries);
+    EXPECT_EQ(13, stats.childEntries);
+
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.getFullAndHalfSiblingSets("Wendy", fullSiblings, halfSiblings));
+}
+
+// Test the FamilyTreeConnectedFamilies class
+TEST_F(FamilyTreeTest, FamilyTreeConnectedFamilies) {
+    FamilyTreeConnectedFamilies families;
+    vector<uint32_t> memberIds;
+    vector<uint32_t> roots;
+    vector<uint32_t> sizes;
+
+    for(uint32_t i = 0; i < 6; i++) {
+        if(i != 3) {
+            families.addMember(i);
+        }
+    }
+    EXPECT_EQ(5, families.getNumberOfFamilies());
+    EXPECT_EQ(false, families.contains(3));
+
+    EXPECT_EQ(true, families.unite(0, 1));
+    EXPECT_EQ(true, families.unite(2, 4));
+    EXPECT_EQ(true, families.unite(1, 4));
+    EXPECT_EQ(false, families.unite(0, 2));
+    EXPECT_EQ(2, families.getNumberOfFamilies());
+    EXPECT_EQ(true, families.isSameFamily(0, 4));
+    EXPECT_EQ(false, families.isSameFamily(0, 5));
+    EXPECT_EQ(4, families.getFamilySize(2));
+
+    families.getFamilyMembers(4, memberIds);
+    EXPECT_EQ(4, memberIds.size());
+    EXPECT_EQ(4, memberIds[0]);
+    sort(memberIds.begin(), memberIds.end());
+    EXPECT_EQ(0, memberIds[0]);
+    EXPECT_EQ(4, memberIds[3]);
+
+    families.getFamilies(roots, sizes);
+    EXPECT_EQ(2, roots.size());
+    EXPECT_EQ(5, sizes[0] + sizes[1]);
+
+    families.addMember(3);
+    EXPECT_EQ(3, families.getNumberOfFamilies());
+    families.clear();
+    EXPECT_EQ(0, families.getNumberOfFamilies());
+}
+
+// Test the FamilyTreeClass::isSameFamily method
+TEST_F(FamilyTreeTest, isSameFamily) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    bool sameFamily;
+    uint32_t size;
+    FamilyTreeMemberSet members;
+    vector<FamilyTreeClass::family_info_t> families;
+
+    EXPECT_EQ(SUCCESS, testTree.isSameFamily("Mary", "Catherine", sameFamily));
+    EXPECT_EQ(true, sameFamily);
+    EXPECT_EQ(SUCCESS, testTree.getFamilySize("Nancy", size));
+    EXPECT_EQ(14, size);
+    EXPECT_EQ(SUCCESS, testTree.getFamilyList(families));
+    EXPECT_EQ(1, families.size());
+
+    // A second family joins the first one through a new relationship
+    vector<string> newMembers = { "Zoe", "Yuri", "Xavier" };
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(newMembers));
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Zoe", "Yuri", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+
+    EXPECT_EQ(SUCCESS, testTree.isSameFamily("Zoe", "Yuri", sameFamily));
+    EXPECT_EQ(true, sameFamily);
+    EXPECT_EQ(SUCCESS, testTree.isSameFamily("Zoe", "Mary", sameFamily));
+    EXPECT_EQ(false, sameFamily);
+    EXPECT_EQ(SUCCESS, testTree.getFamilyList(families));
+    EXPECT_EQ(3, families.size());
+    EXPECT_EQ(14, families[0].size);
+    EXPECT_EQ(2, families[1].size);
+    EXPECT_EQ(1, families[2].size);
+    EXPECT_EQ("Xavier", families[2].representative);
+
+    relationships = { {"Yuri", "Mary", FamilyTreeClass::Sibling} };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.isSameFamily("Zoe", "Nancy", sameFamily));
+    EXPECT_EQ(true, sameFamily);
+    EXPECT_EQ(SUCCESS, testTree.getFamilySet("Zoe", members));
+    EXPECT_EQ(16, members.size());
+
+    // Removing the relationship splits the family again
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.isSameFamily("Zoe", "Nancy", sameFamily));
+    EXPECT_EQ(false, sameFamily);
+    EXPECT_EQ(SUCCESS, testTree.getFamilySize("Yuri", size));
+    EXPECT_EQ(2, size);
+
+    // Removing a member that connects the family
+    EXPECT_EQ(SUCCESS, testTree.removeFamilyMembers(vector<string>(1, "James")));
+    EXPECT_EQ(SUCCESS, testTree.isSameFamily("Mary", "Nancy", sameFamily));
+    EXPECT_EQ(false, sameFamily);
+    EXPECT_EQ(SUCCESS, testTree.getFamilySet("Mary", members));
+    EXPECT_EQ(1, members.size());
+
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.isSameFamily("Mary", "James", sameFamily));
+}
+
+// Test the FamilyTreeClass::validateTree method
+TEST_F(FamilyTreeTest, validateTree) {
+	FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initialize(g_validInputFilePath));
+
+    FamilyTreeClass::validation_report_t report;
+    vector<string> nameList;
+
+    EXPECT_EQ(SUCCESS, testTree.validateTree(report));
+    EXPECT_EQ(true, report.valid);
+    EXPECT_EQ(14, report.members);
+    EXPECT_EQ(0, report.issues.size());
+
+    // Duplicate records, a parent->child cycle and contradicting siblings
+    string invalidFilePath = "validate_tree_test.txt";
+    ofstream invalidFile(invalidFilePath.c_str());
+    invalidFile << "MEMBERS:Ann:Bob:Cal:Dan:Eve:Fay" << endl;
+    invalidFile << "PARENT:Ann:CHILDREN:Bob:Cal" << endl;
+    invalidFile << "PARENT:Ann:CHILDREN:Bob" << endl;
+    invalidFile << "PARENT:Dan:CHILDREN:Eve" << endl;
+    invalidFile << "PARENT:Eve:CHILDREN:Fay" << endl;
+    invalidFile << "PARENT:Fay:CHILDREN:Dan" << endl;
+    invalidFile << "SIBLINGS:Bob:Cal" << endl;
+    invalidFile << "SIBLINGS:Cal:Bob" << endl;
+    invalidFile << "SIBLINGS:Bob:Eve" << endl;
+    invalidFile.close();
+
+    EXPECT_EQ(SUCCESS, testTree.initialize(invalidFilePath));
+    remove(invalidFilePath.c_str());
+
+    // Duplicates are skipped while the tree is built
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Ann", nameList));
+    EXPECT_EQ(2, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.validateTree(report));
+    EXPECT_EQ(false, report.valid);
+    EXPECT_EQ(6, report.members);
+    EXPECT_EQ(3, report.cycleMembers);
+    EXPECT_EQ(4, report.duplicatesSkipped);
+    EXPECT_EQ(0, report.duplicateRelationships);
+    EXPECT_EQ(1, report.siblingConflicts);
+    EXPECT_EQ(0, report.orphanRelationships);
+    EXPECT_EQ(4, report.issues.size());
+
+    // The same report on every thread
+    FamilyTreeParallel::setNumberOfThreads(4);
+    EXPECT_EQ(SUCCESS, testTree.validateTree(report));
+    EXPECT_EQ(3, report.cycleMembers);
+    EXPECT_EQ(1, report.siblingConflicts);
+    FamilyTreeParallel::setNumberOfThreads(0);
+
+    // Removing the conflicting sibling relationship and breaking the cycle
+    vector<FamilyTreeClass::relationship_record_t> relationships = {
+        {"Bob", "Eve", FamilyTreeClass::Sibling},
+        {"Fay", "Dan", FamilyTreeClass::Parent_Child}
+    };
+    EXPECT_EQ(SUCCESS, testTree.removeRelationships(relationships));
+    EXPECT_EQ(SUCCESS, testTree.validateTree(report));
+    EXPECT_EQ(true, report.valid);
+}
+
+// Test the FamilyTreeClass::initializeFromGedcom method
+TEST_F(FamilyTreeTest, initializeFromGedcom) {
+    string gedcomFilePath = "initialize_from_gedcom_test.ged";
+    ofstream gedcomFile(gedcomFilePath.c_str());
+    gedcomFile << "0 HEAD\r\n1 SOUR TEST\r\n1 GEDC\r\n2 VERS 5.5.1\r\n";
+    // A family before its individuals
+    gedcomFile << "0 @F2@ FAM\r\n1 HUSB @I3@\r\n1 CHIL @I5@\r\n";
+    gedcomFile << "0 @I1@ INDI\r\n1 NAME John /Smith/\r\n1 SEX M\r\n1 BIRT\r\n2 DATE 12 JAN 1920\r\n1 FAMS @F1@\r\n";
+    gedcomFile << "0 @I2@ INDI\r\n1 NAME Mary  /Jones/\r\n1 SEX F\r\n1 DEAT\r\n2 DATE 1999\r\n";
+    gedcomFile << "0 @I3@ INDI\r\n1 NAME Paul /Smith/\r\n1 BIRT\r\n2 DATE ABT 1950\r\n";
+    gedcomFile << "0 @I4@ INDI\r\n1 NAME Anne /Smith/\r\n";
+    gedcomFile << "0 @I5@ INDI\r\n1 NAME John /Smith/\r\n";
+    gedcomFile << "0 @N1@ NOTE Skipped\r\n1 CONT note\r\n";
+    gedcomFile << "0 @F1@ FAM\r\n1 HUSB @I1@\r\n1 WIFE @I2@\r\n1 CHIL @I3@\r\n1 CHIL @I4@\r\n1 MARR\r\n2 DATE 1945\r\n";
+    gedcomFile << "0 TRLR\r\n";
+    gedcomFile.close();
+
+    FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initializeFromGedcom(gedcomFilePath));
+
+    vector<string> nameList;
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(5, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("John Smith", nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Anne Smith", nameList[0]);
+    EXPECT_EQ("Paul Smith", nameList[1]);
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Anne Smith", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Paul Smith", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("John Smith (I5)", nameList));
+    EXPECT_EQ(2, nameList.size());
+
+    FamilyTreeClass::member_attributes_t attributes;
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("John Smith", attributes));
+    EXPECT_EQ(FamilyMemberClass::Male, attributes.gender);
+    EXPECT_EQ(1920, attributes.birthYear);
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Mary Jones", attributes));
+    EXPECT_EQ(FamilyMemberClass::Female, attributes.gender);
+    EXPECT_EQ(FamilyTreeAttributeColumns::INVALID_BIRTH_YEAR, attributes.birthYear);
+    EXPECT_EQ(SUCCESS, testTree.getMemberAttributes("Paul Smith", attributes));
+    EXPECT_EQ(1950, attributes.birthYear);
+
+    // A family that refers to a missing individual
+    gedcomFile.open(gedcomFilePath.c_str());
+    gedcomFile << "0 @I1@ INDI\n1 NAME A\n0 @F1@ FAM\n1 HUSB @I1@\n1 CHIL @I9@\n";
+    gedcomFile.close();
+    EXPECT_EQ(TREE_CONSTRUCTION_ERROR, testTree.initializeFromGedcom(gedcomFilePath));
+
+    // A line that is not a GEDCOM line
+    gedcomFile.open(gedcomFilePath.c_str());
+    gedcomFile << "0 @I1@ INDI\n1 NAME A\nMEMBERS:A:B\n";
+    gedcomFile.close();
+    EXPECT_EQ(INPUT_FILE_FORMAT_ERROR, testTree.initializeFromGedcom(gedcomFilePath));
+
+    remove(gedcomFilePath.c_str());
+    EXPECT_EQ(INPUT_FILE_OPEN_ERROR, testTree.initializeFromGedcom(gedcomFilePath));
+}
+
+// Test the FamilyTreeClass::initializeFromGraphFile method
+TEST_F(FamilyTreeTest, initializeFromGraphFile) {
+    string tgfFilePath = "initialize_from_graph_test.tgf";
+    ofstream graphFile(tgfFilePath.c_str());
+    graphFile << "1 Nancy\n2 Carl\n3 Jill\n4 Adam\n5 Nancy\n6\n#\n";
+    graphFile << "1 2 parent\n1 3 Parent\n2 3 sibling\n4 2 child\n1 2 parent\n6 5 child\n";
+    graphFile.close();
+
+    FamilyTreeClass testTree;
+    EXPECT_EQ(SUCCESS, testTree.initializeFromGraphFile(tgfFilePath));
+
+    vector<string> nameList;
+    EXPECT_EQ(SUCCESS, testTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(6, nameList.size());
+
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Carl", nameList[0]);
+    EXPECT_EQ("Jill", nameList[1]);
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Jill", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Carl", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getGrandparentNameList("Adam", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Nancy", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy (5)", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("6", nameList[0]);
+
+    // Unlabeled directed edges are parent->child
+    string gmlFilePath = "initialize_from_graph_test.gml";
+    graphFile.open(gmlFilePath.c_str());
+    graphFile << "graph [\n directed 1\n node [ id 1 label \"Nancy\" ]\n node [ id 2 label \"Carl\" ]\n";
+    graphFile << " node [ id 3 label \"Jill\" ]\n edge [ source 1 target 2 ]\n edge [ source 3 target 2 label \"SIBLING\" ]\n]\n";
+    graphFile.close();
+    EXPECT_EQ(SUCCESS, testTree.initializeFromGraphFile(gmlFilePath, "GML"));
+    EXPECT_EQ(SUCCESS, testTree.getChildrenNameList("Nancy", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Carl", nameList[0]);
+    EXPECT_EQ(SUCCESS, testTree.getSiblingNameList("Carl", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Jill", nameList[0]);
+
+    // An edge that is not a relationship
+    graphFile.open(tgfFilePath.c_str());
+    graphFile << "1 Nancy\n2 Carl\n#\n1 2 spouse\n";
+    graphFile.close();
+    EXPECT_EQ(INPUT_FILE_FORMAT_ERROR, testTree.initializeFromGraphFile(tgfFilePath));
+
+    // A file that is not in the format
+    EXPECT_EQ(INPUT_FILE_FORMAT_ERROR, testTree.initializeFromGraphFile(tgfFilePath, "gml"));
+    EXPECT_EQ(INPUT_FILE_FORMAT_ERROR, testTree.initializeFromGraphFile(tgfFilePath, "unknown"));
+
+    remove(tgfFilePath.c_str());
+    remove(gmlFilePath.c_str());
+    EXPECT_EQ(INPUT_FILE_OPEN_ERROR, testTree.initializeFromGraphFile(tgfFilePath));
+}
+
+// Test the FamilyTreeClass::exportGraphFile method
+TEST_F(FamilyTreeTest, exportGraphFile) {
+    FamilyTreeClass testTree;
+    const char * names[] = {"Ann", "Bob Smith", "Cat", "Dan", "Eve", "Al & <Jo>"};
+    EXPECT_EQ(SUCCESS, testTree.addFamilyMembers(vector<string>(names, names + 6)));
+    FamilyTreeClass::relationship_record_t records[] = {
+        {"Ann", "Bob Smith", FamilyTreeClass::Parent_Child},
+        {"Ann", "Cat", FamilyTreeClass::Parent_Child},
+        {"Bob Smith", "Cat", FamilyTreeClass::Sibling},
+        {"Bob Smith", "Dan", FamilyTreeClass::Parent_Child},
+        {"Dan", "Eve", FamilyTreeClass::Parent_Child},
+        {"Eve", "Al & <Jo>", FamilyTreeClass::Sibling}
+    };
+    EXPECT_EQ(SUCCESS, testTree.addRelationships(vector<FamilyTreeClass::relationship_record_t>(records, records + 6)));
+
+    // The whole tree read back through the graph file import
+    string tgfFilePath = "export_graph_test.tgf";
+    EXPECT_EQ(SUCCESS, testTree.exportGraphFile(tgfFilePath));
+    FamilyTreeClass importedTree;
+    EXPECT_EQ(SUCCESS, importedTree.initializeFromGraphFile(tgfFilePath));
+    vector<string> nameList;
+    EXPECT_EQ(SUCCESS, importedTree.getFamilyMembersNameList(nameList));
+    EXPECT_EQ(6, nameList.size());
+    EXPECT_EQ(SUCCESS, importedTree.getChildrenNameList("Ann", nameList));
+    sort(nameList.begin(), nameList.end());
+    EXPECT_EQ(2, nameList.size());
+    EXPECT_EQ("Bob Smith", nameList[0]);
+    EXPECT_EQ("Cat", nameList[1]);
+    EXPECT_EQ(SUCCESS, importedTree.getSiblingNameList("Eve", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Al & <Jo>", nameList[0]);
+    EXPECT_EQ(SUCCESS, importedTree.getGrandparentNameList("Eve", nameList));
+    EXPECT_EQ(1, nameList.size());
+    EXPECT_EQ("Bob Smith", nameList[0]);
+
+    // One generation below Bob Smith.  Cat is not a descendant so
+    // the sibling relationship is not exported.
+    string dotFilePath = "export_graph_test.gv";
+    EXPECT_EQ(SUCCESS, testTree.exportGraphFile(dotFilePath, "", "Bob Smith", 1));
+    ifstream graphFile(dotFilePath.c_str());
+    string line;
+    uint32_t members = 0;
+    uint32_t relationships = 0;
+    while(getline(graphFile, line)) {
+        if(line.find("->") != string::npos) {
+            relationships++;
+        }
+        else if(line.find("label=") != string::npos) {
+            members++;
+        }
+    }
+    graphFile.close();
+    EXPECT_EQ(2, members);
+    EXPECT_EQ(1, relationships);
+
+    // Names are escaped
+    string graphmlFilePath = "export_graph_test.xml";
+    EXPECT_EQ(SUCCESS, testTree.exportGraphFile(graphmlFilePath, "GraphML", "Dan"));
+    graphFile.open(graphmlFilePath.c_str());
+    string contents((istreambuf_iterator<char>(graphFile)), istreambuf_iterator<char>());
+    graphFile.close();
+    EXPECT_NE(string::npos, contents.find(">Eve</data>"));
+    EXPECT_NE(string::npos, contents.find("<data key=\"relationship\">parent</data>"));
+    EXPECT_EQ(string::npos, contents.find("Jo"));
+
+    EXPECT_EQ(INVALID_ARG, testTree.exportGraphFile(graphmlFilePath));
+    EXPECT_EQ(FAMILY_MEMBER_NOT_FOUND, testTree.exportGraphFile(tgfFilePath, "", "Zoe"));
+    EXPECT_EQ(OUTPUT_FILE_OPEN_ERROR, testTree.exportGraphFile("no_such_directory/export_graph_test.tgf"));
+
+    remove(tgfFilePath.c_str());
+    remove(dotFilePath.c_str());
+    remove(graphmlFilePath.c_str());
+}
+
 // Main method for running all of the tests
 
 int main(int argc, char **argv) {